@@ -0,0 +1,18 @@
+#=============================================================================
+# - Try to find LZ4
+# Once done this will define
+#
+#  LZ4_FOUND        - system has LZ4
+#  LZ4_INCLUDE_DIRS - include directories for LZ4
+#  LZ4_LIBRARIES    - libraries for LZ4
+#
+#=============================================================================
+
+find_path(LZ4_INCLUDE_DIRS lz4.h HINTS ${LZ4_DIR}/include $ENV{LZ4_DIR}/include)
+find_library(LZ4_LIBRARIES lz4 HINTS ${LZ4_DIR}/lib $ENV{LZ4_DIR}/lib)
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(
+  LZ4 "LZ4 could not be found." LZ4_INCLUDE_DIRS LZ4_LIBRARIES
+)
+mark_as_advanced(LZ4_INCLUDE_DIRS LZ4_LIBRARIES)
@@ -0,0 +1,271 @@
+// Copyright (C) 2026 agent
+//
+// This file is part of DOLFINx (https://www.fenicsproject.org)
+//
+// SPDX-License-Identifier:    LGPL-3.0-or-later
+
+#include "Distributor.h"
+#include <algorithm>
+#include <utility>
+
+using namespace dolfinx;
+
+namespace
+{
+/// Create a neighbourhood communicator, exchange the number of items
+/// and then the items (int64) with neighbourhood ranks.
+/// @return (0) received items, (1) number of items received from each
+/// source rank, (2) neighbourhood communicator
+std::tuple<std::vector<std::int64_t>, std::vector<int>, MPI_Comm>
+exchange(MPI_Comm comm, std::span<const int> src, std::span<const int> dest,
+         std::span<const std::int64_t> send_data, std::span<const int> sizes,
+         common::Distributor::Statistics& stats)
+{
+  MPI_Comm neigh_comm;
+  int err = MPI_Dist_graph_create_adjacent(
+      comm, src.size(), src.data(), MPI_UNWEIGHTED, dest.size(), dest.data(),
+      MPI_UNWEIGHTED, MPI_INFO_NULL, false, &neigh_comm);
+  dolfinx::MPI::check_error(comm, err);
+
+  std::vector<int> send_sizes(sizes.begin(), sizes.end());
+  std::vector<int> recv_sizes(src.size());
+  send_sizes.reserve(1);
+  recv_sizes.reserve(1);
+  err = MPI_Neighbor_alltoall(send_sizes.data(), 1, MPI_INT,
+                              recv_sizes.data(), 1, MPI_INT, neigh_comm);
+  dolfinx::MPI::check_error(comm, err);
+
+  std::vector<int> send_disp(dest.size() + 1, 0);
+  std::partial_sum(send_sizes.begin(), send_sizes.end(),
+                   std::next(send_disp.begin()));
+  std::vector<int> recv_disp(src.size() + 1, 0);
+  std::partial_sum(recv_sizes.begin(), recv_sizes.end(),
+                   std::next(recv_disp.begin()));
+
+  std::vector<std::int64_t> recv_data(recv_disp.back());
+  err = MPI_Neighbor_alltoallv(send_data.data(), send_sizes.data(),
+                               send_disp.data(), MPI_INT64_T,
+                               recv_data.data(), recv_sizes.data(),
+                               recv_disp.data(), MPI_INT64_T, neigh_comm);
+  dolfinx::MPI::check_error(comm, err);
+
+  stats.rounds += 3;
+  stats.bytes_sent += sizeof(int) * dest.size()
+                      + sizeof(std::int64_t) * send_data.size();
+  stats.bytes_received
+      += sizeof(int) * src.size() + sizeof(std::int64_t) * recv_data.size();
+
+  return {std::move(recv_data), std::move(recv_sizes), neigh_comm};
+}
+
+/// Group (rank, value) pairs, which must be sorted, by rank.
+/// @return (0) ranks, (1) number of values for each rank, (2) values
+std::tuple<std::vector<int>, std::vector<int>, std::vector<std::int64_t>>
+group_by_rank(std::span<const std::pair<int, std::int64_t>> data)
+{
+  std::vector<int> ranks, sizes;
+  std::vector<std::int64_t> values;
+  values.reserve(data.size());
+  for (auto [r, v] : data)
+  {
+    if (ranks.empty() or ranks.back() != r)
+    {
+      ranks.push_back(r);
+      sizes.push_back(0);
+    }
+    ++sizes.back();
+    values.push_back(v);
+  }
+  return {std::move(ranks), std::move(sizes), std::move(values)};
+}
+} // namespace
+
+//-----------------------------------------------------------------------------
+common::Distributor::Distributor(MPI_Comm comm0,
+                                 std::span<const std::int64_t> indices,
+                                 MPI_Comm comm1, std::int32_t num_rows)
+    : _num_rows(num_rows), _recv_disp(1, 0)
+{
+  common::Timer timer("Compute communication pattern for distributing data");
+
+  const int size = dolfinx::MPI::size(comm0);
+  const int rank = dolfinx::MPI::rank(comm0);
+  Statistics& stats = _setup_statistics;
+
+  // Global number of rows, and global index of first local row
+  const std::int64_t num_rows_local = num_rows;
+  std::int64_t shape0 = 0;
+  int err = MPI_Allreduce(&num_rows_local, &shape0, 1, MPI_INT64_T, MPI_SUM,
+                          comm0);
+  dolfinx::MPI::check_error(comm0, err);
+  ++stats.rounds;
+  std::int64_t offset = 0;
+  if (comm1 != MPI_COMM_NULL)
+  {
+    err = MPI_Exscan(&num_rows_local, &offset, 1, MPI_INT64_T, MPI_SUM,
+                     comm1);
+    dolfinx::MPI::check_error(comm1, err);
+    if (dolfinx::MPI::rank(comm1) == 0)
+      offset = 0;
+    ++stats.rounds;
+  }
+  else if (num_rows > 0)
+    throw std::runtime_error("Non-empty data on null MPI communicator");
+
+  // 1. Send the range of rows owned by the caller to the 'post office'
+  //    ranks for the rows. Each post office then knows the owner of
+  //    each row in its range.
+  std::vector<std::array<std::int64_t, 3>> owner_ranges;
+  {
+    std::vector<int> dest;
+    std::vector<std::int64_t> send_data;
+    if (num_rows > 0)
+    {
+      const int p0 = dolfinx::MPI::index_owner(size, offset, shape0);
+      const int p1
+          = dolfinx::MPI::index_owner(size, offset + num_rows - 1, shape0);
+      for (int p = p0; p <= p1; ++p)
+      {
+        if (p == rank)
+          owner_ranges.push_back({offset, offset + num_rows, rank});
+        else
+        {
+          dest.push_back(p);
+          send_data.insert(send_data.end(), {offset, offset + num_rows});
+        }
+      }
+    }
+
+    const std::vector<int> src
+        = dolfinx::MPI::compute_graph_edges_nbx(comm0, dest);
+    ++stats.rounds;
+    std::vector<int> sizes(dest.size(), 2);
+    auto [recv_data, recv_sizes, neigh_comm]
+        = exchange(comm0, src, dest, send_data, sizes, stats);
+    MPI_Comm_free(&neigh_comm);
+    for (std::size_t i = 0; i < src.size(); ++i)
+      owner_ranges.push_back({recv_data[2 * i], recv_data[2 * i + 1], src[i]});
+    std::sort(owner_ranges.begin(), owner_ranges.end());
+  }
+
+  // Find the owner of a row in the post office range of the caller
+  auto row_owner = [&owner_ranges](std::int64_t idx) -> int
+  {
+    auto it = std::upper_bound(
+        owner_ranges.begin(), owner_ranges.end(), idx,
+        [](std::int64_t a, auto& range) { return a < range[0]; });
+    assert(it != owner_ranges.begin());
+    --it;
+    assert(idx >= (*it)[0] and idx < (*it)[1]);
+    return (*it)[2];
+  };
+
+  // Unique required indices that are not owned by the caller
+  std::vector<std::int64_t> required;
+  required.reserve(indices.size());
+  std::copy_if(indices.begin(), indices.end(), std::back_inserter(required),
+               [offset, num_rows](auto idx)
+               { return idx < offset or idx >= offset + num_rows; });
+  std::sort(required.begin(), required.end());
+  required.erase(std::unique(required.begin(), required.end()),
+                 required.end());
+
+  // 2. Ask the post office ranks for the owner of each required row
+  std::vector<std::pair<int, std::int64_t>> owner_to_index;
+  owner_to_index.reserve(required.size());
+  {
+    std::vector<std::pair<int, std::int64_t>> po_to_index;
+    po_to_index.reserve(required.size());
+    for (std::int64_t idx : required)
+    {
+      assert(idx >= 0 and idx < shape0);
+      const int p = dolfinx::MPI::index_owner(size, idx, shape0);
+      if (p == rank)
+        owner_to_index.push_back({row_owner(idx), idx});
+      else
+        po_to_index.push_back({p, idx});
+    }
+    std::sort(po_to_index.begin(), po_to_index.end());
+    auto [dest, sizes, send_data] = group_by_rank(po_to_index);
+
+    const std::vector<int> src
+        = dolfinx::MPI::compute_graph_edges_nbx(comm0, dest);
+    ++stats.rounds;
+    auto [recv_data, recv_sizes, neigh_comm0]
+        = exchange(comm0, src, dest, send_data, sizes, stats);
+    MPI_Comm_free(&neigh_comm0);
+
+    // Send owners back to the ranks that asked for them
+    std::vector<std::int64_t> owners(recv_data.size());
+    std::transform(recv_data.begin(), recv_data.end(), owners.begin(),
+                   row_owner);
+    auto [recv_owners, recv_owner_sizes, neigh_comm1]
+        = exchange(comm0, dest, src, owners, recv_sizes, stats);
+    MPI_Comm_free(&neigh_comm1);
+    assert(recv_owners.size() == send_data.size());
+
+    for (std::size_t i = 0; i < send_data.size(); ++i)
+      owner_to_index.push_back({(int)recv_owners[i], send_data[i]});
+    std::sort(owner_to_index.begin(), owner_to_index.end());
+  }
+
+  // 3. Send the required indices to the owning ranks, and create the
+  //    neighbourhood communicator for sending rows from owners to the
+  //    ranks that require them
+  auto [src, sizes, send_data] = group_by_rank(owner_to_index);
+  const std::vector<int> dest
+      = dolfinx::MPI::compute_graph_edges_nbx(comm0, src);
+  ++stats.rounds;
+  auto [recv_data, recv_sizes, neigh_comm]
+      = exchange(comm0, dest, src, send_data, sizes, stats);
+  MPI_Comm_free(&neigh_comm);
+
+  MPI_Comm comm;
+  err = MPI_Dist_graph_create_adjacent(
+      comm0, src.size(), src.data(), MPI_UNWEIGHTED, dest.size(), dest.data(),
+      MPI_UNWEIGHTED, MPI_INFO_NULL, false, &comm);
+  dolfinx::MPI::check_error(comm0, err);
+  _comm = dolfinx::MPI::Comm(comm, false);
+  ++stats.rounds;
+
+  _send_rows.resize(recv_data.size());
+  std::transform(recv_data.begin(), recv_data.end(), _send_rows.begin(),
+                 [offset](auto idx) { return idx - offset; });
+  _send_sizes = std::move(recv_sizes);
+  _send_disp.assign(_send_sizes.size() + 1, 0);
+  std::partial_sum(_send_sizes.begin(), _send_sizes.end(),
+                   std::next(_send_disp.begin()));
+  _recv_sizes = std::move(sizes);
+  _recv_disp.assign(_recv_sizes.size() + 1, 0);
+  std::partial_sum(_recv_sizes.begin(), _recv_sizes.end(),
+                   std::next(_recv_disp.begin()));
+  _send_sizes.reserve(1);
+  _send_disp.reserve(1);
+  _recv_sizes.reserve(1);
+
+  // Position of each required row in the receive buffer, which holds
+  // rows grouped by owner and sorted by index for each owner
+  std::vector<std::pair<std::int64_t, std::int32_t>> index_to_pos;
+  index_to_pos.reserve(owner_to_index.size());
+  for (std::size_t i = 0; i < owner_to_index.size(); ++i)
+    index_to_pos.push_back({owner_to_index[i].second, i});
+  std::sort(index_to_pos.begin(), index_to_pos.end());
+  _pos.reserve(indices.size());
+  for (std::int64_t idx : indices)
+  {
+    if (idx >= offset and idx < offset + num_rows)
+      _pos.push_back(-(idx - offset) - 1);
+    else
+    {
+      auto it = std::lower_bound(index_to_pos.begin(), index_to_pos.end(),
+                                 std::pair<std::int64_t, std::int32_t>(idx, 0));
+      assert(it != index_to_pos.end() and it->first == idx);
+      _pos.push_back(it->second);
+    }
+  }
+
+  spdlog::info("Distributor setup (bytes sent, bytes received, rounds): {}, "
+               "{}, {}",
+               stats.bytes_sent, stats.bytes_received, stats.rounds);
+}
+//-----------------------------------------------------------------------------
@@ -0,0 +1,219 @@
+// Copyright (C) 2026 agent
+//
+// This file is part of DOLFINx (https://www.fenicsproject.org)
+//
+// SPDX-License-Identifier:    LGPL-3.0-or-later
+
+#pragma once
+
+#include "MPI.h"
+#include "Timer.h"
+#include "log.h"
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mpi.h>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace dolfinx::common
+{
+/// @brief Distributes rows of data arrays to the ranks where they are
+/// required, using a communication pattern that is computed once.
+///
+/// MPI::distribute_data computes the communication pattern every time
+/// that it is called, and sends the data via 'post office' ranks. A
+/// Distributor computes the pattern, i.e. the rank that owns each
+/// required row, when it is created. It then sends the data directly
+/// from the owning rank to the requesting rank, with a single MPI
+/// neighbourhood collective, each time Distributor::distribute is
+/// called. Rows of several arrays with the same row distribution, e.g.
+/// cell topology, cell data and original cell indices, are packed into
+/// one exchange.
+///
+/// @note Computing the pattern takes more communication rounds than a
+/// single call to MPI::distribute_data. A Distributor pays off when
+/// rows for the same indices are distributed more than once, or when
+/// several arrays are distributed together.
+class Distributor
+{
+public:
+  /// @brief Communication statistics on the calling rank.
+  struct Statistics
+  {
+    /// Number of bytes sent
+    std::int64_t bytes_sent = 0;
+
+    /// Number of bytes received
+    std::int64_t bytes_received = 0;
+
+    /// Number of communication rounds (collective operations)
+    int rounds = 0;
+  };
+
+  /// @brief Create a distributor.
+  ///
+  /// @note Collective.
+  ///
+  /// @param[in] comm0 Communicator to distribute data across.
+  /// @param[in] indices Global indices of the rows required by the
+  /// calling process. Indices may be repeated.
+  /// @param[in] comm1 Communicator across which the data arrays are
+  /// distributed. Can be `MPI_COMM_NULL` on ranks where the data
+  /// arrays are empty.
+  /// @param[in] num_rows Number of rows of the data arrays on the
+  /// calling process. The global index of local row `i` is `i` plus
+  /// the offset for this rank on `comm1`.
+  Distributor(MPI_Comm comm0, std::span<const std::int64_t> indices,
+              MPI_Comm comm1, std::int32_t num_rows);
+
+  /// @brief Distribute rows of data arrays.
+  ///
+  /// Rows of all arrays are sent in a single exchange.
+  ///
+  /// @note Collective.
+  ///
+  /// @param[in] shape1 Number of columns of each data array.
+  /// @param[in] x Data arrays (row-major) on the calling process. Each
+  /// array has the number of rows passed to the constructor.
+  /// @return The data for each index used to create the Distributor,
+  /// for each array (row-major storage).
+  template <typename... T>
+    requires(sizeof...(T) > 0 and (std::is_trivially_copyable_v<T> and ...))
+  std::tuple<std::vector<T>...>
+  distribute(std::array<int, sizeof...(T)> shape1, std::span<const T>... x)
+  {
+    common::Timer timer("Distribute row-wise data (cached pattern)");
+    constexpr std::size_t n = sizeof...(T);
+
+    // Size (bytes) of each array row, and offset of array data in a
+    // packed row
+    std::size_t k = 0;
+    const std::array<std::size_t, n> bytes = {(shape1[k++] * sizeof(T))...};
+    std::array<std::size_t, n + 1> offset = {0};
+    std::partial_sum(bytes.begin(), bytes.end(), std::next(offset.begin()));
+    const std::size_t row_bytes = offset.back();
+
+    const std::array<std::size_t, n> sizes = {x.size()...};
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      if (sizes[i] != _num_rows * std::size_t(shape1[i]))
+        throw std::runtime_error("Data array has wrong number of rows.");
+    }
+
+    // Pack rows that are sent into a byte buffer
+    const std::array<const std::byte*, n> data
+        = {reinterpret_cast<const std::byte*>(x.data())...};
+    std::vector<std::byte> send_buffer(_send_rows.size() * row_bytes);
+    for (std::size_t r = 0; r < _send_rows.size(); ++r)
+    {
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        std::memcpy(send_buffer.data() + r * row_bytes + offset[i],
+                    data[i] + _send_rows[r] * bytes[i], bytes[i]);
+      }
+    }
+
+    // Send/receive rows
+    std::vector<std::byte> recv_buffer(_recv_disp.back() * row_bytes);
+    if (_comm.comm() != MPI_COMM_NULL)
+    {
+      MPI_Datatype compound_type;
+      MPI_Type_contiguous(row_bytes, MPI_BYTE, &compound_type);
+      MPI_Type_commit(&compound_type);
+      int err = MPI_Neighbor_alltoallv(
+          send_buffer.data(), _send_sizes.data(), _send_disp.data(),
+          compound_type, recv_buffer.data(), _recv_sizes.data(),
+          _recv_disp.data(), compound_type, _comm.comm());
+      dolfinx::MPI::check_error(_comm.comm(), err);
+      MPI_Type_free(&compound_type);
+    }
+
+    _statistics.bytes_sent = send_buffer.size();
+    _statistics.bytes_received = recv_buffer.size();
+    _statistics.rounds = _comm.comm() != MPI_COMM_NULL ? 1 : 0;
+    spdlog::info("Distributor (bytes sent, bytes received, rounds): {}, {}, "
+                 "{}",
+                 _statistics.bytes_sent, _statistics.bytes_received,
+                 _statistics.rounds);
+
+    // Unpack rows, taking rows owned by the caller from the input
+    k = 0;
+    std::tuple<std::vector<T>...> x_new{
+        std::vector<T>(_pos.size() * shape1[k++])...};
+    const std::array<std::byte*, n> data_new = std::apply(
+        [](auto&... v)
+        { return std::array<std::byte*, n>{
+              reinterpret_cast<std::byte*>(v.data())...}; },
+        x_new);
+    for (std::size_t j = 0; j < _pos.size(); ++j)
+    {
+      if (std::int32_t pos = _pos[j]; pos >= 0)
+      {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+          std::memcpy(data_new[i] + j * bytes[i],
+                      recv_buffer.data() + pos * row_bytes + offset[i],
+                      bytes[i]);
+        }
+      }
+      else
+      {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+          std::memcpy(data_new[i] + j * bytes[i],
+                      data[i] + (-pos - 1) * bytes[i], bytes[i]);
+        }
+      }
+    }
+
+    return x_new;
+  }
+
+  /// @brief Number of rows of the data arrays on the calling process.
+  std::int32_t num_rows() const noexcept { return _num_rows; }
+
+  /// @brief Communication statistics for computing the communication
+  /// pattern when the Distributor was created.
+  const Statistics& setup_statistics() const noexcept
+  {
+    return _setup_statistics;
+  }
+
+  /// @brief Communication statistics for the last call to
+  /// Distributor::distribute.
+  const Statistics& statistics() const noexcept { return _statistics; }
+
+private:
+  // Number of local rows in the data arrays
+  std::int32_t _num_rows;
+
+  // Neighbourhood communicator. Sources are the ranks that own rows
+  // required by the caller, and destinations are the ranks that
+  // require rows owned by the caller.
+  dolfinx::MPI::Comm _comm{MPI_COMM_NULL};
+
+  // Local rows to send, grouped by destination rank
+  std::vector<std::int32_t> _send_rows;
+
+  // Number of rows sent to each destination, and displacements
+  std::vector<int> _send_sizes, _send_disp;
+
+  // Number of rows received from each source, and displacements
+  std::vector<int> _recv_sizes, _recv_disp;
+
+  // Position in the receive buffer of the row for each required index.
+  // If negative, the row is owned by the caller and is local row
+  // `-pos - 1`.
+  std::vector<std::int32_t> _pos;
+
+  // Communication statistics
+  Statistics _setup_statistics, _statistics;
+};
+} // namespace dolfinx::common
@@ -11,6 +11,9 @@
 #include <functional>
 #include <numeric>
 #include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -44,6 +47,71 @@ std::array<std::vector<int>, 2> build_src_dest(MPI_Comm comm,
   return {std::move(src), std::move(dest)};
 }
 
+/// @brief Given ghost owners that lie in a known neighbourhood,
+/// compute the source and destination ranks.
+///
+/// The source ranks are computed locally. The destination ranks are
+/// computed by sending a flag to each candidate source rank, which is
+/// much cheaper than the consensus algorithm when the neighbourhood is
+/// small.
+/// @param comm MPI communicator.
+/// @param owners List of ranks that own each ghost index.
+/// @param neighbourhood Candidate [0] source and [1] destination ranks.
+/// @return (src ranks, destination ranks). Both lists are sorted.
+std::array<std::vector<int>, 2>
+build_src_dest(MPI_Comm comm, std::span<const int> owners,
+               std::array<std::span<const int>, 2> neighbourhood)
+{
+  if (dolfinx::MPI::size(comm) == 1)
+  {
+    assert(owners.empty());
+    return std::array<std::vector<int>, 2>();
+  }
+
+  std::vector<int> src(owners.begin(), owners.end());
+  std::sort(src.begin(), src.end());
+  src.erase(std::unique(src.begin(), src.end()), src.end());
+  src.shrink_to_fit();
+
+  std::array<std::vector<int>, 2> nbr;
+  for (std::size_t i = 0; i < 2; ++i)
+  {
+    nbr[i].assign(neighbourhood[i].begin(), neighbourhood[i].end());
+    std::sort(nbr[i].begin(), nbr[i].end());
+    nbr[i].erase(std::unique(nbr[i].begin(), nbr[i].end()), nbr[i].end());
+  }
+
+  // Flag candidate source ranks that own ghosts of the caller
+  std::vector<std::uint8_t> send_flag(nbr[0].size(), 0);
+  for (int r : src)
+  {
+    auto it = std::lower_bound(nbr[0].begin(), nbr[0].end(), r);
+    if (it == nbr[0].end() or *it != r)
+    {
+      throw std::runtime_error("Ghost owner rank " + std::to_string(r)
+                               + " is not in the candidate source ranks.");
+    }
+    send_flag[std::distance(nbr[0].begin(), it)] = 1;
+  }
+
+  // Send flags to candidate source ranks, and receive flags from
+  // candidate destination ranks
+  std::vector<std::uint8_t> recv_flag(nbr[1].size());
+  send_flag.reserve(1);
+  recv_flag.reserve(1);
+  MPI_Comm comm0 = dolfinx::MPI::neighbourhood_comm(comm, nbr[1], nbr[0]);
+  int ierr = MPI_Neighbor_alltoall(send_flag.data(), 1, MPI_UINT8_T,
+                                   recv_flag.data(), 1, MPI_UINT8_T, comm0);
+  dolfinx::MPI::check_error(comm, ierr);
+
+  std::vector<int> dest;
+  for (std::size_t i = 0; i < recv_flag.size(); ++i)
+    if (recv_flag[i] != 0)
+      dest.push_back(nbr[1][i]);
+
+  return {std::move(src), std::move(dest)};
+}
+
 /// @brief Helper function that sends ghost indices on a given process
 /// to their owning rank, and receives indices owned by this process
 /// that are ghosts on other processes.
@@ -613,16 +681,11 @@ common::stack_index_maps(
   std::vector<int> src(src_set.begin(), src_set.end());
   std::vector<int> dest(dest_set.begin(), dest_set.end());
 
-  // Create neighbour comms (0: ghost -> owner, 1: (owner -> ghost)
-  MPI_Comm comm0, comm1;
-  int ierr = MPI_Dist_graph_create_adjacent(
-      maps.at(0).first.get().comm(), dest.size(), dest.data(), MPI_UNWEIGHTED,
-      src.size(), src.data(), MPI_UNWEIGHTED, MPI_INFO_NULL, false, &comm0);
-  dolfinx::MPI::check_error(maps.at(0).first.get().comm(), ierr);
-  ierr = MPI_Dist_graph_create_adjacent(
-      maps.at(0).first.get().comm(), src.size(), src.data(), MPI_UNWEIGHTED,
-      dest.size(), dest.data(), MPI_UNWEIGHTED, MPI_INFO_NULL, false, &comm1);
-  dolfinx::MPI::check_error(maps.at(0).first.get().comm(), ierr);
+  // Get neighbour comms (0: ghost -> owner, 1: (owner -> ghost)
+  MPI_Comm comm = maps.at(0).first.get().comm();
+  MPI_Comm comm0 = dolfinx::MPI::neighbourhood_comm(comm, dest, src);
+  MPI_Comm comm1 = dolfinx::MPI::neighbourhood_comm(comm, src, dest);
+  int ierr;
 
   // NOTE: We could perform each MPI call just once rather than per map,
   // but the complexity may not be worthwhile since this function is
@@ -736,13 +799,6 @@ common::stack_index_maps(
     }
   }
 
-  // Destroy communicators
-  ierr = MPI_Comm_free(&comm0);
-  dolfinx::MPI::check_error(maps.at(0).first.get().comm(), ierr);
-
-  ierr = MPI_Comm_free(&comm1);
-  dolfinx::MPI::check_error(maps.at(0).first.get().comm(), ierr);
-
   return {process_offset, std::move(local_offset), std::move(ghosts_new),
           std::move(ghost_owners_new)};
 }
@@ -822,6 +878,16 @@ IndexMap::IndexMap(MPI_Comm comm, std::int32_t local_size,
   // Do nothing
 }
 //-----------------------------------------------------------------------------
+IndexMap::IndexMap(MPI_Comm comm, std::int32_t local_size,
+                   std::span<const std::int64_t> ghosts,
+                   std::span<const int> owners,
+                   std::array<std::span<const int>, 2> neighbourhood)
+    : IndexMap(comm, local_size, build_src_dest(comm, owners, neighbourhood),
+               ghosts, owners)
+{
+  // Do nothing
+}
+//-----------------------------------------------------------------------------
 IndexMap::IndexMap(MPI_Comm comm, std::int32_t local_size,
                    const std::array<std::vector<int>, 2>& src_dest,
                    std::span<const std::int64_t> ghosts,
@@ -897,31 +963,71 @@ void IndexMap::local_to_global(std::span<const std::int32_t> local,
 }
 //-----------------------------------------------------------------------------
 void IndexMap::global_to_local(std::span<const std::int64_t> global,
-                               std::span<std::int32_t> local) const
+                               std::span<std::int32_t> local,
+                               int num_threads) const
 {
-  const std::int32_t local_size = _local_range[1] - _local_range[0];
-  std::vector<std::pair<std::int64_t, std::int32_t>> global_to_local(
-      _ghosts.size());
-  for (std::size_t i = 0; i < _ghosts.size(); ++i)
-    global_to_local[i] = {_ghosts[i], i + local_size};
-
-  std::sort(global_to_local.begin(), global_to_local.end());
-  std::transform(global.begin(), global.end(), local.begin(),
-                 [range = _local_range,
-                  &global_to_local](std::int64_t index) -> std::int32_t
-                 {
-                   if (index >= range[0] and index < range[1])
-                     return index - range[0];
-                   else
-                   {
-                     auto it = std::lower_bound(
-                         global_to_local.begin(), global_to_local.end(), index,
-                         [](auto a, auto b) { return a.first < b; });
-                     return (it != global_to_local.end() and it->first == index)
-                                ? it->second
-                                : -1;
-                   }
-                 });
+  assert(global.size() <= local.size());
+
+  // Build the sorted (ghost, local) lookup once. It is reused by all
+  // later calls.
+  assert(_ghosts_sorted_flag);
+  std::call_once(
+      *_ghosts_sorted_flag,
+      [this]()
+      {
+        const std::int32_t local_size = _local_range[1] - _local_range[0];
+        std::vector<std::int32_t> perm(_ghosts.size());
+        std::iota(perm.begin(), perm.end(), 0);
+        dolfinx::argsort_radix<std::int64_t>(_ghosts, perm);
+        _ghosts_sorted.resize(_ghosts.size());
+        _ghosts_sorted_local.resize(_ghosts.size());
+        for (std::size_t i = 0; i < perm.size(); ++i)
+        {
+          _ghosts_sorted[i] = _ghosts[perm[i]];
+          _ghosts_sorted_local[i] = perm[i] + local_size;
+        }
+      });
+
+  auto translate = [range = _local_range, &keys = _ghosts_sorted,
+                    &pos = _ghosts_sorted_local, global,
+                    local](std::size_t i0, std::size_t i1)
+  {
+    for (std::size_t i = i0; i < i1; ++i)
+    {
+      if (std::int64_t index = global[i];
+          index >= range[0] and index < range[1])
+      {
+        local[i] = index - range[0];
+      }
+      else
+      {
+        auto it = std::lower_bound(keys.begin(), keys.end(), index);
+        local[i] = (it != keys.end() and *it == index)
+                       ? pos[std::distance(keys.begin(), it)]
+                       : -1;
+      }
+    }
+  };
+
+  // Only use threads when there is enough work to amortise the thread
+  // start-up cost
+  constexpr std::size_t min_size_per_thread = 1 << 16;
+  num_threads = std::min<std::size_t>(
+      std::max(num_threads, 1),
+      std::max<std::size_t>(global.size() / min_size_per_thread, 1));
+  if (num_threads == 1)
+    translate(0, global.size());
+  else
+  {
+    std::vector<std::thread> threads;
+    for (int i = 0; i < num_threads; ++i)
+    {
+      auto [i0, i1] = dolfinx::MPI::local_range(i, global.size(), num_threads);
+      threads.emplace_back(translate, i0, i1);
+    }
+    for (auto& t : threads)
+      t.join();
+  }
 }
 //-----------------------------------------------------------------------------
 std::vector<std::int64_t> IndexMap::global_indices() const
@@ -1270,3 +1376,44 @@ std::array<double, 2> IndexMap::imbalance() const
   return imbalance;
 }
 //-----------------------------------------------------------------------------
+std::array<std::int64_t, 2> IndexMap::node_ghost_volume(int node_size) const
+{
+  MPI_Comm comm_node;
+  int err;
+  if (node_size > 0)
+  {
+    const int rank = dolfinx::MPI::rank(_comm.comm());
+    err = MPI_Comm_split(_comm.comm(), rank / node_size, rank, &comm_node);
+  }
+  else
+  {
+    err = MPI_Comm_split_type(_comm.comm(), MPI_COMM_TYPE_SHARED, 0,
+                              MPI_INFO_NULL, &comm_node);
+  }
+  dolfinx::MPI::check_error(_comm.comm(), err);
+
+  // Find the ranks that own ghosts and are on the same compute node
+  MPI_Group group, group_node;
+  MPI_Comm_group(_comm.comm(), &group);
+  MPI_Comm_group(comm_node, &group_node);
+  std::vector<int> src_node(_src.size());
+  MPI_Group_translate_ranks(group, _src.size(), _src.data(), group_node,
+                            src_node.data());
+  MPI_Group_free(&group);
+  MPI_Group_free(&group_node);
+  MPI_Comm_free(&comm_node);
+
+  std::array<std::int64_t, 2> volume = {0, 0};
+  for (int owner : _owners)
+  {
+    auto it = std::lower_bound(_src.begin(), _src.end(), owner);
+    assert(it != _src.end() and *it == owner);
+    if (src_node[std::distance(_src.begin(), it)] != MPI_UNDEFINED)
+      ++volume[0];
+    else
+      ++volume[1];
+  }
+
+  return volume;
+}
+//-----------------------------------------------------------------------------
@@ -10,6 +10,7 @@
 #include <cstdint>
 #include <dolfinx/common/MPI.h>
 #include <memory>
+#include <mutex>
 #include <span>
 #include <utility>
 #include <vector>
@@ -145,6 +146,37 @@ public:
            const std::array<std::vector<int>, 2>& src_dest,
            std::span<const std::int64_t> ghosts, std::span<const int> owners);
 
+  /// @brief Create an overlapping (ghosted) index map when the owners
+  /// of ghosts are known to lie in a given neighbourhood.
+  ///
+  /// This constructor is for the common case where the new map is
+  /// derived from existing map(s), e.g. a stacked map or a dof map
+  /// built on top of mesh entity maps, so the caller already knows a
+  /// neighbourhood that contains the communication graph of the new
+  /// map. The 'source' ranks are computed locally from `owners`, and
+  /// the 'destination' ranks are computed by a single neighbourhood
+  /// exchange. This avoids the 'consensus' algorithm used by the
+  /// constructor that takes only `ghosts` and `owners`.
+  ///
+  /// @note Collective
+  ///
+  /// @param[in] comm MPI communicator that the index map is distributed
+  /// across.
+  /// @param[in] local_size Local size of the index map, i.e. the number
+  /// of owned entries
+  /// @param[in] ghosts The global indices of ghost entries
+  /// @param[in] owners Owner rank (on `comm`) of each entry in `ghosts`
+  /// @param[in] neighbourhood Lists of [0] candidate src and [1]
+  /// candidate dest ranks, e.g. the union of `src()` and `dest()` of
+  /// the parent map(s). The lists can be unsorted and contain
+  /// duplicates. Every entry of `owners` must be in the candidate src
+  /// ranks, and rank `q` must be a candidate dest rank on rank `p` if
+  /// and only if `p` is a candidate src rank on rank `q`. An exception
+  /// is thrown if an entry of `owners` is not a candidate src rank.
+  IndexMap(MPI_Comm comm, std::int32_t local_size,
+           std::span<const std::int64_t> ghosts, std::span<const int> owners,
+           std::array<std::span<const int>, 2> neighbourhood);
+
   // Copy constructor
   IndexMap(const IndexMap& map) = delete;
 
@@ -187,12 +219,19 @@ public:
                        std::span<std::int64_t> global) const;
 
   /// @brief Compute local indices for array of global indices.
+  ///
+  /// Ghost indices are found using a sorted lookup table that is built
+  /// on the first call and reused by later calls.
+  ///
   /// @param[in] global Global indices
   /// @param[out] local The local of the corresponding global index in
   /// 'global'. Returns -1 if the local index does not exist on this
   /// process.
+  /// @param[in] num_threads Number of threads used to translate the
+  /// indices. Threads are used only for large arrays.
   void global_to_local(std::span<const std::int64_t> global,
-                       std::span<std::int32_t> local) const;
+                       std::span<std::int32_t> local,
+                       int num_threads = 1) const;
 
   /// @brief Build list of indices with global indexing.
   /// @return The global index for all local indices `(0, 1, 2, ...)` on
@@ -251,6 +290,26 @@ public:
   /// element) and the imbalance in ghost indices (second element).
   std::array<double, 2> imbalance() const;
 
+  /// @brief Number of ghost indices that are owned by a rank on the
+  /// same compute node as the caller, and on other compute nodes.
+  ///
+  /// Ranks are on the same compute node if they share memory, as
+  /// determined by `MPI_Comm_split_type` with `MPI_COMM_TYPE_SHARED`.
+  /// Ghost updates with ranks on the same compute node do not use the
+  /// network, so a small inter-node ghost volume is desirable.
+  ///
+  /// @note This is a collective operation and must be called by all
+  /// processes in the communicator associated with the IndexMap.
+  ///
+  /// @param[in] node_size If positive, consecutive blocks of
+  /// `node_size` ranks are treated as a compute node, in place of the
+  /// ranks that share memory (see
+  /// graph::create_hierarchical_partitioner).
+  /// @return Number of ghost indices on the caller that are owned on
+  /// the same compute node (first element) and on other compute nodes
+  /// (second element).
+  std::array<std::int64_t, 2> node_ghost_volume(int node_size = -1) const;
+
 private:
   // Range of indices (global) owned by this process
   std::array<std::int64_t, 2> _local_range;
@@ -272,5 +331,12 @@ private:
 
   // Set of ranks ghost owned indices
   std::vector<int> _dest;
+
+  // Ghost global indices sorted in ascending order and the local index
+  // of each. Built on the first call to global_to_local.
+  mutable std::vector<std::int64_t> _ghosts_sorted;
+  mutable std::vector<std::int32_t> _ghosts_sorted_local;
+  std::unique_ptr<std::once_flag> _ghosts_sorted_flag
+      = std::make_unique<std::once_flag>();
 };
 } // namespace dolfinx::common
@@ -5,9 +5,51 @@
 // SPDX-License-Identifier:    LGPL-3.0-or-later
 
 #include "MPI.h"
+#include <bit>
+#include <deque>
 #include <dolfinx/common/log.h>
 #include <iostream>
 
+namespace
+{
+/// Cache of neighbourhood communicators created from a communicator.
+/// Entries are added, used and removed in the same order on all ranks,
+/// so the id and position of an entry are the same on all ranks. The
+/// least recently used entry is at the front.
+struct NeighbourhoodCache
+{
+  struct Entry
+  {
+    std::vector<int> src, dest;
+    MPI_Comm comm;
+  };
+
+  ~NeighbourhoodCache()
+  {
+    for (Entry& e : entries)
+      MPI_Comm_free(&e.comm);
+  }
+
+  // Maximum number of cached communicators
+  static constexpr std::size_t max_size = 16;
+
+  // Cached entries, least recently used first. Entries are added,
+  // moved and removed only collectively, so the i-th entry refers to
+  // the same communicator on all ranks.
+  std::deque<Entry> entries;
+};
+
+/// MPI attribute key for the neighbourhood communicator cache
+int neighbourhood_cache_keyval = MPI_KEYVAL_INVALID;
+
+/// Delete the cache when the communicator it is attached to is freed
+int delete_neighbourhood_cache(MPI_Comm, int, void* attr, void*)
+{
+  delete static_cast<NeighbourhoodCache*>(attr);
+  return MPI_SUCCESS;
+}
+} // namespace
+
 //-----------------------------------------------------------------------------
 dolfinx::MPI::Comm::Comm(MPI_Comm comm, bool duplicate)
 {
@@ -239,3 +281,68 @@ dolfinx::MPI::compute_graph_edges_nbx(MPI_Comm comm, std::span<const int> edges)
   return other_ranks;
 }
 //-----------------------------------------------------------------------------
+MPI_Comm dolfinx::MPI::neighbourhood_comm(MPI_Comm comm,
+                                          std::span<const int> src,
+                                          std::span<const int> dest)
+{
+  if (neighbourhood_cache_keyval == MPI_KEYVAL_INVALID)
+  {
+    int err = MPI_Comm_create_keyval(
+        MPI_COMM_NULL_COPY_FN, delete_neighbourhood_cache,
+        &neighbourhood_cache_keyval, nullptr);
+    dolfinx::MPI::check_error(comm, err);
+  }
+
+  // Get cache attached to the communicator, creating it if required
+  NeighbourhoodCache* cache = nullptr;
+  int flag = 0;
+  int err = MPI_Comm_get_attr(comm, neighbourhood_cache_keyval, &cache, &flag);
+  dolfinx::MPI::check_error(comm, err);
+  if (!flag)
+  {
+    cache = new NeighbourhoodCache;
+    err = MPI_Comm_set_attr(comm, neighbourhood_cache_keyval, cache);
+    dolfinx::MPI::check_error(comm, err);
+  }
+
+  // Flag the entries that match the neighbourhood of the caller. An
+  // entry can be used only if it matches on all ranks. Ranks can match
+  // different entries, e.g. ranks with an empty neighbourhood, so the
+  // flags for all entries are reduced.
+  static_assert(NeighbourhoodCache::max_size <= 32);
+  std::uint32_t match = 0;
+  for (std::size_t i = 0; i < cache->entries.size(); ++i)
+  {
+    const NeighbourhoodCache::Entry& e = cache->entries[i];
+    if (std::ranges::equal(e.src, src) and std::ranges::equal(e.dest, dest))
+      match |= std::uint32_t(1) << i;
+  }
+  err = MPI_Allreduce(MPI_IN_PLACE, &match, 1, MPI_UINT32_T, MPI_BAND, comm);
+  dolfinx::MPI::check_error(comm, err);
+  if (match != 0)
+  {
+    // Use the most recently used match and move it to the back, so the
+    // least recently used entry is at the front
+    auto e = std::next(cache->entries.begin(), std::bit_width(match) - 1);
+    std::rotate(e, std::next(e), cache->entries.end());
+    return cache->entries.back().comm;
+  }
+
+  // Create communicator and add to cache
+  MPI_Comm neigh_comm;
+  err = MPI_Dist_graph_create_adjacent(
+      comm, src.size(), src.data(), MPI_UNWEIGHTED, dest.size(), dest.data(),
+      MPI_UNWEIGHTED, MPI_INFO_NULL, false, &neigh_comm);
+  dolfinx::MPI::check_error(comm, err);
+  if (cache->entries.size() == NeighbourhoodCache::max_size)
+  {
+    MPI_Comm_free(&cache->entries.front().comm);
+    cache->entries.pop_front();
+  }
+  cache->entries.push_back({std::vector<int>(src.begin(), src.end()),
+                            std::vector<int>(dest.begin(), dest.end()),
+                            neigh_comm});
+
+  return neigh_comm;
+}
+//-----------------------------------------------------------------------------
@@ -185,6 +185,32 @@ std::vector<int> compute_graph_edges_pcx(MPI_Comm comm,
 std::vector<int> compute_graph_edges_nbx(MPI_Comm comm,
                                          std::span<const int> edges);
 
+/// @brief Get a neighbourhood communicator with the given source and
+/// destination ranks from a cache.
+///
+/// The communicator is created using `MPI_Dist_graph_create_adjacent`
+/// (unweighted, no reordering) if it is not in the cache of `comm`. The
+/// cache is attached to `comm` as an attribute, and the cached
+/// communicators are freed when `comm` is freed. The cache holds a
+/// small number of communicators, and the least recently used is freed
+/// when it is full.
+///
+/// Checking the cache requires one `MPI_Allreduce` on `comm`, which is
+/// much cheaper than creating a communicator when `comm` is large.
+///
+/// @note Collective.
+/// @note The returned communicator is owned by the cache and must not
+/// be freed by the caller. It must not be used after `comm` is freed.
+/// It remains valid for at least the next 15 calls to this function
+/// for `comm`.
+///
+/// @param[in] comm MPI communicator.
+/// @param[in] src Source ranks (in-edges) of the caller.
+/// @param[in] dest Destination ranks (out-edges) of the caller.
+/// @return Neighbourhood communicator.
+MPI_Comm neighbourhood_comm(MPI_Comm comm, std::span<const int> src,
+                            std::span<const int> dest);
+
 /// @brief Distribute row data to 'post office' ranks.
 ///
 /// This function takes row-wise data that is distributed across
@@ -263,6 +289,24 @@ std::vector<typename std::remove_reference_t<typename U::value_type>>
 distribute_data(MPI_Comm comm0, std::span<const std::int64_t> indices,
                 MPI_Comm comm1, const U& x, int shape1);
 
+/// @brief Send rows of a 2D array to other ranks.
+///
+/// The caller gives the destination rank of each row, and the ranks
+/// that receive rows are determined by a consensus exchange. Unlike
+/// MPI::distribute_data, no global indices are needed.
+///
+/// @param[in] comm MPI communicator.
+/// @param[in] dest Destination rank for each row of `x`.
+/// @param[in] x Data to send (row-major storage).
+/// @param[in] shape1 Number of columns of `x`.
+/// @return Received rows (row-major storage) and the source rank of
+/// each received row. Rows from the same source are in the order that
+/// they were sent.
+template <typename V>
+std::pair<std::vector<V>, std::vector<int>>
+send_rows(MPI_Comm comm, std::span<const int> dest, std::span<const V> x,
+          std::size_t shape1);
+
 template <typename T>
 struct dependent_false : std::false_type
 {
@@ -705,5 +749,80 @@ distribute_data(MPI_Comm comm0, std::span<const std::int64_t> indices,
                                     rank_offset);
 }
 //---------------------------------------------------------------------------
+template <typename V>
+std::pair<std::vector<V>, std::vector<int>>
+send_rows(MPI_Comm comm, std::span<const int> dest, std::span<const V> x,
+          std::size_t shape1)
+{
+  assert(x.size() == dest.size() * shape1);
+
+  // Order rows by destination, and count number of rows to send to
+  // each destination
+  std::vector<std::int32_t> perm(dest.size());
+  std::iota(perm.begin(), perm.end(), 0);
+  std::stable_sort(perm.begin(), perm.end(),
+                   [&dest](auto a, auto b) { return dest[a] < dest[b]; });
+  std::vector<int> out_ranks;
+  std::vector<int> num_send;
+  for (auto p : perm)
+  {
+    if (out_ranks.empty() or out_ranks.back() != dest[p])
+    {
+      out_ranks.push_back(dest[p]);
+      num_send.push_back(0);
+    }
+    num_send.back() += shape1;
+  }
+
+  std::vector<int> in_ranks
+      = dolfinx::MPI::compute_graph_edges_nbx(comm, out_ranks);
+  std::sort(in_ranks.begin(), in_ranks.end());
+  MPI_Comm neigh_comm;
+  int err = MPI_Dist_graph_create_adjacent(
+      comm, in_ranks.size(), in_ranks.data(), MPI_UNWEIGHTED,
+      out_ranks.size(), out_ranks.data(), MPI_UNWEIGHTED, MPI_INFO_NULL,
+      false, &neigh_comm);
+  dolfinx::MPI::check_error(comm, err);
+
+  std::vector<int> num_recv(in_ranks.size());
+  num_send.reserve(1);
+  num_recv.reserve(1);
+  err = MPI_Neighbor_alltoall(num_send.data(), 1, MPI_INT, num_recv.data(), 1,
+                              MPI_INT, neigh_comm);
+  dolfinx::MPI::check_error(comm, err);
+
+  std::vector<int> send_disp = {0};
+  std::partial_sum(num_send.begin(), num_send.end(),
+                   std::back_inserter(send_disp));
+  std::vector<int> recv_disp = {0};
+  std::partial_sum(num_recv.begin(), num_recv.end(),
+                   std::back_inserter(recv_disp));
+
+  std::vector<V> send_buffer;
+  send_buffer.reserve(x.size());
+  for (auto p : perm)
+  {
+    send_buffer.insert(send_buffer.end(), std::next(x.begin(), p * shape1),
+                       std::next(x.begin(), (p + 1) * shape1));
+  }
+
+  std::vector<V> recv_buffer(recv_disp.back());
+  err = MPI_Neighbor_alltoallv(send_buffer.data(), num_send.data(),
+                               send_disp.data(), dolfinx::MPI::mpi_type<V>(),
+                               recv_buffer.data(), num_recv.data(),
+                               recv_disp.data(), dolfinx::MPI::mpi_type<V>(),
+                               neigh_comm);
+  dolfinx::MPI::check_error(comm, err);
+  err = MPI_Comm_free(&neigh_comm);
+  dolfinx::MPI::check_error(comm, err);
+
+  std::vector<int> src;
+  src.reserve(recv_buffer.size() / shape1);
+  for (std::size_t i = 0; i < in_ranks.size(); ++i)
+    src.insert(src.end(), num_recv[i] / shape1, in_ranks[i]);
+
+  return {std::move(recv_buffer), std::move(src)};
+}
+//---------------------------------------------------------------------------
 
 } // namespace dolfinx::MPI
@@ -10,6 +10,8 @@
 #include "MPI.h"
 #include "sort.h"
 #include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <mpi.h>
@@ -28,6 +30,20 @@ namespace dolfinx::common
 /// Scatter and gather operations uses MPI neighbourhood collectives.
 /// The implementation is designed is for sparse communication patterns,
 /// as it typical of patterns based on and IndexMap.
+///
+/// With Scatterer::type::shm, data is exchanged with neighbourhood
+/// ranks on the same compute node through an MPI-3 shared memory
+/// window, and point-to-point messages are used only for ranks on
+/// other compute nodes. The scatter functions that take pack/unpack
+/// functions pack directly into the window and unpack directly from
+/// the windows of the other ranks. A rank waits for the other ranks to
+/// have read its window at the start of the next scatter in the same
+/// direction, rather than at the end of a scatter. The window is
+/// created on the first scatter using Scatterer::type::shm, and is
+/// freed when the last copy of the Scatterer is destroyed. Freeing the
+/// window is collective over the ranks on a compute node, so a
+/// Scatterer that has been used with Scatterer::type::shm must be
+/// destroyed on all ranks, and before MPI is finalised.
 template <class Allocator = std::allocator<std::int32_t>>
 class Scatterer
 {
@@ -39,7 +55,9 @@ public:
   enum class type
   {
     neighbor, // use MPI neighborhood collectives
-    p2p       // use MPI Isend/Irecv for communication
+    p2p,      // use MPI Isend/Irecv for communication
+    shm // use shared memory for ranks on the same compute node, and MPI
+        // Isend/Irecv for ranks on other compute nodes
   };
 
   /// @brief Create a scatterer.
@@ -192,13 +210,22 @@ public:
   /// @param requests The MPI request handle for tracking the status of
   /// the non-blocking communication
   /// @param[in] type The type of MPI communication pattern used by the
-  /// Scatterer, either Scatterer::type::neighbor or Scatterer::type::p2p.
+  /// Scatterer, either Scatterer::type::neighbor, Scatterer::type::p2p
+  /// or Scatterer::type::shm.
+  ///
+  /// @note With Scatterer::type::shm, at most one forward scatter can
+  /// be in progress at a time, and the buffers must be in host memory.
+  /// The scatter must be completed by calling
+  /// Scatterer::scatter_fwd_end with the same `requests`.
   template <typename T>
   void scatter_fwd_begin(std::span<const T> send_buffer,
                          std::span<T> recv_buffer,
                          std::span<MPI_Request> requests,
                          Scatterer::type type = type::neighbor) const
   {
+    if (type == type::shm)
+      init_shm(sizeof(T));
+
     // Return early if there are no incoming or outgoing edges
     if (_sizes_local.empty() and _sizes_remote.empty())
       return;
@@ -221,7 +248,7 @@ public:
       for (std::size_t i = 0; i < _src.size(); i++)
       {
         MPI_Irecv(recv_buffer.data() + _displs_remote[i], _sizes_remote[i],
-                  dolfinx::MPI::mpi_type<T>(), _src[i], MPI_ANY_TAG,
+                  dolfinx::MPI::mpi_type<T>(), _src[i], 0,
                   _comm0.comm(), &requests[i]);
       }
 
@@ -233,6 +260,50 @@ public:
       }
       break;
     }
+    case type::shm:
+    {
+      assert(requests.size() == _dest.size() + _src.size());
+      assert(_shm);
+      check_shm_idle(_shm->fwd);
+      shm_wait_read(_shm->fwd_read);
+      T* window = reinterpret_cast<T*>(_shm->base);
+      _shm->fwd = {requests.data(),
+                   reinterpret_cast<std::byte*>(recv_buffer.data()),
+                   sizeof(T)};
+
+      // Receive data from owners on other compute nodes, and a notice
+      // that the data is ready from owners on this compute node
+      for (std::size_t i = 0; i < _src.size(); i++)
+      {
+        const bool on_node = _shm->src[i] != MPI_UNDEFINED;
+        MPI_Irecv(recv_buffer.data() + _displs_remote[i],
+                  on_node ? 0 : _sizes_remote[i], dolfinx::MPI::mpi_type<T>(),
+                  _src[i], 0, _comm0.comm(), &requests[i]);
+      }
+
+      // Place data for ranks on this compute node in the window
+      if (send_buffer.data() != window)
+      {
+        for (std::size_t i = 0; i < _dest.size(); i++)
+        {
+          if (_shm->dest[i] != MPI_UNDEFINED)
+          {
+            std::copy_n(send_buffer.data() + _displs_local[i],
+                        _sizes_local[i], window + _displs_local[i]);
+          }
+        }
+      }
+      MPI_Win_sync(_shm->win);
+
+      for (std::size_t i = 0; i < _dest.size(); i++)
+      {
+        const bool on_node = _shm->dest[i] != MPI_UNDEFINED;
+        MPI_Isend(send_buffer.data() + _displs_local[i],
+                  on_node ? 0 : _sizes_local[i], dolfinx::MPI::mpi_type<T>(),
+                  _dest[i], 0, _comm0.comm(), &requests[i + _src.size()]);
+      }
+      break;
+    }
     default:
       throw std::runtime_error("Scatter::type not recognized");
     }
@@ -254,6 +325,25 @@ public:
 
     // Wait for communication to complete
     MPI_Waitall(requests.size(), requests.data(), MPI_STATUS_IGNORE);
+
+    // Copy data from the windows of owners on this compute node if
+    // the scatter was started with Scatterer::type::shm
+    if (_shm and _shm->fwd.requests == requests.data())
+    {
+      const std::size_t vs = _shm->fwd.value_size;
+      MPI_Win_sync(_shm->win);
+      for (std::size_t i = 0; i < _src.size(); i++)
+      {
+        if (_shm->src[i] != MPI_UNDEFINED)
+        {
+          std::memcpy(_shm->fwd.recv_buffer + _displs_remote[i] * vs,
+                      _shm->src_ptr[i] + _shm->offset_src[i] * vs,
+                      _sizes_remote[i] * vs);
+        }
+      }
+      _shm->fwd = {};
+      shm_post_read(_shm->src, _src, _shm->dest, _dest, 1, _shm->fwd_read);
+    }
   }
 
   /// @brief Scatter data associated with owned indices to ghosting
@@ -275,7 +365,10 @@ public:
   /// @param[in] requests The MPI request handle for tracking the status
   /// of the send
   /// @param[in] type The type of MPI communication pattern used by the
-  /// Scatterer, either Scatterer::type::neighbor or Scatterer::type::p2p.
+  /// Scatterer, either Scatterer::type::neighbor, Scatterer::type::p2p
+  /// or Scatterer::type::shm. With Scatterer::type::shm the data is
+  /// packed directly into the shared memory window, and `local_buffer`
+  /// is not used.
   template <typename T, typename F>
     requires std::is_invocable_v<F, std::span<const T>,
                                  std::span<const std::int32_t>, std::span<T>>
@@ -286,6 +379,14 @@ public:
   {
     assert(local_buffer.size() == _local_inds.size());
     assert(remote_buffer.size() == _remote_inds.size());
+    if (type == type::shm and _comm0.comm() != MPI_COMM_NULL)
+    {
+      init_shm(sizeof(T));
+      check_shm_idle(_shm->fwd);
+      shm_wait_read(_shm->fwd_read);
+      local_buffer = std::span(reinterpret_cast<T*>(_shm->base),
+                               _local_inds.size());
+    }
     pack_fn(local_data, _local_inds, local_buffer);
     scatter_fwd_begin(std::span<const T>(local_buffer), remote_buffer, requests,
                       type);
@@ -320,9 +421,34 @@ public:
   {
     assert(remote_buffer.size() == _remote_inds.size());
     assert(remote_data.size() == _remote_inds.size());
-    scatter_fwd_end(requests);
-    unpack_fn(remote_buffer, _remote_inds, remote_data,
-              [](T /*a*/, T b) { return b; });
+    if (_shm and _shm->fwd.requests == requests.data())
+    {
+      // Unpack data from owners on this compute node directly from
+      // their windows, and data from other owners from `remote_buffer`
+      assert(_shm->fwd.value_size == sizeof(T));
+      MPI_Waitall(requests.size(), requests.data(), MPI_STATUS_IGNORE);
+      MPI_Win_sync(_shm->win);
+      for (std::size_t i = 0; i < _src.size(); i++)
+      {
+        std::span<const T> in
+            = _shm->src[i] == MPI_UNDEFINED
+                  ? remote_buffer.subspan(_displs_remote[i], _sizes_remote[i])
+                  : std::span(reinterpret_cast<const T*>(_shm->src_ptr[i])
+                                  + _shm->offset_src[i],
+                              _sizes_remote[i]);
+        std::span<const std::int32_t> inds(
+            _remote_inds.data() + _displs_remote[i], _sizes_remote[i]);
+        unpack_fn(in, inds, remote_data, [](T /*a*/, T b) { return b; });
+      }
+      _shm->fwd = {};
+      shm_post_read(_shm->src, _src, _shm->dest, _dest, 1, _shm->fwd_read);
+    }
+    else
+    {
+      scatter_fwd_end(requests);
+      unpack_fn(remote_buffer, _remote_inds, remote_data,
+                [](T /*a*/, T b) { return b; });
+    }
   }
 
   /// @brief Scatter data associated with owned indices to ghosting
@@ -387,13 +513,22 @@ public:
   /// @param requests The MPI request handle for tracking the status of
   /// the non-blocking communication
   /// @param[in] type The type of MPI communication pattern used by the
-  /// Scatterer, either Scatterer::type::neighbor or Scatterer::type::p2p.
+  /// Scatterer, either Scatterer::type::neighbor, Scatterer::type::p2p
+  /// or Scatterer::type::shm.
+  ///
+  /// @note With Scatterer::type::shm, at most one reverse scatter can
+  /// be in progress at a time, and the buffers must be in host memory.
+  /// The scatter must be completed by calling
+  /// Scatterer::scatter_rev_end with the same `requests`.
   template <typename T>
   void scatter_rev_begin(std::span<const T> send_buffer,
                          std::span<T> recv_buffer,
                          std::span<MPI_Request> requests,
                          Scatterer::type type = type::neighbor) const
   {
+    if (type == type::shm)
+      init_shm(sizeof(T));
+
     // Return early if there are no incoming or outgoing edges
     if (_sizes_local.empty() and _sizes_remote.empty())
       return;
@@ -419,7 +554,7 @@ public:
       for (std::size_t i = 0; i < _dest.size(); i++)
       {
         MPI_Irecv(recv_buffer.data() + _displs_local[i], _sizes_local[i],
-                  dolfinx::MPI::mpi_type<T>(), _dest[i], MPI_ANY_TAG,
+                  dolfinx::MPI::mpi_type<T>(), _dest[i], 0,
                   _comm0.comm(), &requests[i]);
       }
 
@@ -433,6 +568,51 @@ public:
       }
       break;
     }
+    case type::shm:
+    {
+      assert(requests.size() == _dest.size() + _src.size());
+      assert(_shm);
+      check_shm_idle(_shm->rev);
+      shm_wait_read(_shm->rev_read);
+      T* window = reinterpret_cast<T*>(_shm->base) + _local_inds.size();
+      _shm->rev = {requests.data(),
+                   reinterpret_cast<std::byte*>(recv_buffer.data()),
+                   sizeof(T)};
+
+      // Receive data from ghosting ranks on other compute nodes, and a
+      // notice that the data is ready from ghosting ranks on this
+      // compute node
+      for (std::size_t i = 0; i < _dest.size(); i++)
+      {
+        const bool on_node = _shm->dest[i] != MPI_UNDEFINED;
+        MPI_Irecv(recv_buffer.data() + _displs_local[i],
+                  on_node ? 0 : _sizes_local[i], dolfinx::MPI::mpi_type<T>(),
+                  _dest[i], 2, _comm0.comm(), &requests[i]);
+      }
+
+      // Place data for ranks on this compute node in the window
+      if (send_buffer.data() != window)
+      {
+        for (std::size_t i = 0; i < _src.size(); i++)
+        {
+          if (_shm->src[i] != MPI_UNDEFINED)
+          {
+            std::copy_n(send_buffer.data() + _displs_remote[i],
+                        _sizes_remote[i], window + _displs_remote[i]);
+          }
+        }
+      }
+      MPI_Win_sync(_shm->win);
+
+      for (std::size_t i = 0; i < _src.size(); i++)
+      {
+        const bool on_node = _shm->src[i] != MPI_UNDEFINED;
+        MPI_Isend(send_buffer.data() + _displs_remote[i],
+                  on_node ? 0 : _sizes_remote[i], dolfinx::MPI::mpi_type<T>(),
+                  _src[i], 2, _comm0.comm(), &requests[i + _dest.size()]);
+      }
+      break;
+    }
     default:
       throw std::runtime_error("Scatter::type not recognized");
     }
@@ -454,6 +634,25 @@ public:
 
     // Wait for communication to complete
     MPI_Waitall(request.size(), request.data(), MPI_STATUS_IGNORE);
+
+    // Copy data from the windows of ghosting ranks on this compute
+    // node if the scatter was started with Scatterer::type::shm
+    if (_shm and _shm->rev.requests == request.data())
+    {
+      const std::size_t vs = _shm->rev.value_size;
+      MPI_Win_sync(_shm->win);
+      for (std::size_t i = 0; i < _dest.size(); i++)
+      {
+        if (_shm->dest[i] != MPI_UNDEFINED)
+        {
+          std::memcpy(_shm->rev.recv_buffer + _displs_local[i] * vs,
+                      _shm->dest_ptr[i] + _shm->offset_dest[i] * vs,
+                      _sizes_local[i] * vs);
+        }
+      }
+      _shm->rev = {};
+      shm_post_read(_shm->dest, _dest, _shm->src, _src, 3, _shm->rev_read);
+    }
   }
 
   /// @brief Scatter data associated with ghost indices to owning ranks.
@@ -478,8 +677,10 @@ public:
   /// @param request MPI request handles for tracking the status of the
   /// non-blocking communication.
   /// @param[in] type Type of MPI communication pattern used by the
-  /// Scatterer, either Scatterer::type::neighbor or
-  /// Scatterer::type::p2p.
+  /// Scatterer, either Scatterer::type::neighbor,
+  /// Scatterer::type::p2p or Scatterer::type::shm. With
+  /// Scatterer::type::shm the data is packed directly into the shared
+  /// memory window, and `remote_buffer` is not used.
   template <typename T, typename F>
     requires std::is_invocable_v<F, std::span<const T>,
                                  std::span<const std::int32_t>, std::span<T>>
@@ -490,6 +691,15 @@ public:
   {
     assert(local_buffer.size() == _local_inds.size());
     assert(remote_buffer.size() == _remote_inds.size());
+    if (type == type::shm and _comm0.comm() != MPI_COMM_NULL)
+    {
+      init_shm(sizeof(T));
+      check_shm_idle(_shm->rev);
+      shm_wait_read(_shm->rev_read);
+      remote_buffer = std::span(reinterpret_cast<T*>(_shm->base)
+                                    + _local_inds.size(),
+                                _remote_inds.size());
+    }
     pack_fn(remote_data, _remote_inds, remote_buffer);
     scatter_rev_begin(std::span<const T>(remote_buffer), local_buffer, request,
                       type);
@@ -520,7 +730,8 @@ public:
                                  BinaryOp>
              and std::is_invocable_r_v<T, BinaryOp, T, T>
   void scatter_rev_end(std::span<const T> local_buffer, std::span<T> local_data,
-                       F unpack_fn, BinaryOp op, std::span<MPI_Request> request)
+                       F unpack_fn, BinaryOp op,
+                       std::span<MPI_Request> request) const
   {
     assert(local_buffer.size() == _local_inds.size());
     if (!_local_inds.empty())
@@ -528,8 +739,34 @@ public:
       assert(*std::max_element(_local_inds.begin(), _local_inds.end())
              < std::int32_t(local_data.size()));
     }
-    scatter_rev_end(request);
-    unpack_fn(local_buffer, _local_inds, local_data, op);
+    if (_shm and _shm->rev.requests == request.data())
+    {
+      // Unpack data from ghosting ranks on this compute node directly
+      // from their windows, and data from other ghosting ranks from
+      // `local_buffer`
+      assert(_shm->rev.value_size == sizeof(T));
+      MPI_Waitall(request.size(), request.data(), MPI_STATUS_IGNORE);
+      MPI_Win_sync(_shm->win);
+      for (std::size_t i = 0; i < _dest.size(); i++)
+      {
+        std::span<const T> in
+            = _shm->dest[i] == MPI_UNDEFINED
+                  ? local_buffer.subspan(_displs_local[i], _sizes_local[i])
+                  : std::span(reinterpret_cast<const T*>(_shm->dest_ptr[i])
+                                  + _shm->offset_dest[i],
+                              _sizes_local[i]);
+        std::span<const std::int32_t> inds(
+            _local_inds.data() + _displs_local[i], _sizes_local[i]);
+        unpack_fn(in, inds, local_data, op);
+      }
+      _shm->rev = {};
+      shm_post_read(_shm->dest, _dest, _shm->src, _src, 3, _shm->rev_read);
+    }
+    else
+    {
+      scatter_rev_end(request);
+      unpack_fn(local_buffer, _local_inds, local_data, op);
+    }
   }
 
   /// @brief Scatter data associated with ghost indices to ranks that
@@ -594,7 +831,7 @@ public:
   /// @brief Create a vector of MPI_Requests for a given Scatterer::type
   /// @return A vector of MPI requests
   std::vector<MPI_Request> create_request_vector(Scatterer::type type
-                                                 = type::neighbor)
+                                                 = type::neighbor) const
   {
     std::vector<MPI_Request> requests;
     switch (type)
@@ -603,6 +840,7 @@ public:
       requests = {MPI_REQUEST_NULL};
       break;
     case type::p2p:
+    case type::shm:
       requests.resize(_dest.size() + _src.size(), MPI_REQUEST_NULL);
       break;
     default:
@@ -612,6 +850,208 @@ public:
   }
 
 private:
+  // A scatter through shared memory that is in progress
+  struct shm_scatter
+  {
+    // Request vector passed to the begin function, which identifies
+    // the scatter in the end function
+    const MPI_Request* requests = nullptr;
+
+    // Receive buffer and value size
+    std::byte* recv_buffer = nullptr;
+    std::size_t value_size = 0;
+  };
+
+  // Data for communication through shared memory with neighbourhood
+  // ranks on the same compute node
+  struct shm_data
+  {
+    // Frees the window. Collective over `comm`.
+    ~shm_data()
+    {
+      shm_wait_read(fwd_read);
+      shm_wait_read(rev_read);
+      if (win != MPI_WIN_NULL)
+      {
+        MPI_Win_unlock_all(win);
+        MPI_Win_free(&win);
+      }
+    }
+
+    // Communicator of ranks that share memory
+    dolfinx::MPI::Comm comm{MPI_COMM_NULL};
+
+    // Rank in `comm` of each src/dest rank, or MPI_UNDEFINED if the
+    // rank is on another compute node
+    std::vector<int> src, dest;
+
+    // Position of the data for the caller in the window of each
+    // src/dest rank
+    std::vector<std::int32_t> offset_src, offset_dest;
+
+    // Window holding the caller's packed owned data (first
+    // Scatterer::local_buffer_size entries) and packed ghost data (next
+    // Scatterer::remote_buffer_size entries)
+    MPI_Win win = MPI_WIN_NULL;
+    std::byte* base = nullptr;
+    std::size_t value_size = 0;
+
+    // Start of the window of each src/dest rank on this compute node
+    std::vector<std::byte*> src_ptr, dest_ptr;
+
+    // Forward and reverse scatters in progress
+    shm_scatter fwd, rev;
+
+    // Notices from the ranks on this compute node that they have read
+    // the data of the last forward and reverse scatter from the window
+    std::vector<MPI_Request> fwd_read, rev_read;
+  };
+
+  // Create the shared memory data and a window that can hold values of
+  // size `value_size` bytes, if not already created. Collective.
+  void init_shm(std::size_t value_size) const
+  {
+    if (_comm0.comm() == MPI_COMM_NULL)
+      return;
+
+    if (!_shm)
+    {
+      auto shm = std::make_shared<shm_data>();
+      MPI_Comm comm;
+      int err = MPI_Comm_split_type(_comm0.comm(), MPI_COMM_TYPE_SHARED, 0,
+                                    MPI_INFO_NULL, &comm);
+      dolfinx::MPI::check_error(_comm0.comm(), err);
+      shm->comm = dolfinx::MPI::Comm(comm, false);
+
+      // Find neighbourhood ranks on the same compute node
+      MPI_Group group, group_node;
+      MPI_Comm_group(_comm0.comm(), &group);
+      MPI_Comm_group(comm, &group_node);
+      shm->src.resize(_src.size());
+      MPI_Group_translate_ranks(group, _src.size(), _src.data(), group_node,
+                                shm->src.data());
+      shm->dest.resize(_dest.size());
+      MPI_Group_translate_ranks(group, _dest.size(), _dest.data(),
+                                group_node, shm->dest.data());
+      MPI_Group_free(&group);
+      MPI_Group_free(&group_node);
+
+      // Send the position of the data for each neighbourhood rank in
+      // the caller's window to the neighbourhood rank
+      std::vector<std::int32_t> offset_local(_displs_local.begin(),
+                                             std::prev(_displs_local.end()));
+      std::vector<std::int32_t> offset_remote(_src.size());
+      for (std::size_t i = 0; i < _src.size(); ++i)
+        offset_remote[i] = _local_inds.size() + _displs_remote[i];
+      shm->offset_src.resize(_src.size());
+      shm->offset_dest.resize(_dest.size());
+      offset_local.reserve(1);
+      offset_remote.reserve(1);
+      shm->offset_src.reserve(1);
+      shm->offset_dest.reserve(1);
+      MPI_Neighbor_alltoall(offset_local.data(), 1, MPI_INT32_T,
+                            shm->offset_src.data(), 1, MPI_INT32_T,
+                            _comm0.comm());
+      MPI_Neighbor_alltoall(offset_remote.data(), 1, MPI_INT32_T,
+                            shm->offset_dest.data(), 1, MPI_INT32_T,
+                            _comm1.comm());
+      _shm = shm;
+    }
+
+    if (_shm->value_size < value_size)
+    {
+      check_shm_idle(_shm->fwd);
+      check_shm_idle(_shm->rev);
+      shm_wait_read(_shm->fwd_read);
+      shm_wait_read(_shm->rev_read);
+      if (_shm->win != MPI_WIN_NULL)
+      {
+        MPI_Win_unlock_all(_shm->win);
+        MPI_Win_free(&_shm->win);
+      }
+
+      // Allocate window. Memory for each rank need not be contiguous
+      // with the memory of the other ranks, which allows it to be
+      // placed close to the rank.
+      MPI_Info info;
+      MPI_Info_create(&info);
+      MPI_Info_set(info, "alloc_shared_noncontig", "true");
+      const std::size_t size
+          = (_local_inds.size() + _remote_inds.size()) * value_size;
+      int err = MPI_Win_allocate_shared(size, 1, info, _shm->comm.comm(),
+                                        &_shm->base, &_shm->win);
+      dolfinx::MPI::check_error(_comm0.comm(), err);
+      MPI_Info_free(&info);
+      MPI_Win_lock_all(MPI_MODE_NOCHECK, _shm->win);
+      _shm->value_size = value_size;
+
+      // Get start of the window of neighbourhood ranks on this compute
+      // node
+      auto query = [win = _shm->win](auto& ranks, auto& ptrs)
+      {
+        ptrs.assign(ranks.size(), nullptr);
+        for (std::size_t i = 0; i < ranks.size(); ++i)
+        {
+          if (ranks[i] != MPI_UNDEFINED)
+          {
+            MPI_Aint size;
+            int disp_unit;
+            MPI_Win_shared_query(win, ranks[i], &size, &disp_unit, &ptrs[i]);
+          }
+        }
+      };
+      query(_shm->src, _shm->src_ptr);
+      query(_shm->dest, _shm->dest_ptr);
+    }
+  }
+
+  // Throw if a scatter through shared memory is in progress
+  static void check_shm_idle(const shm_scatter& scatter)
+  {
+    if (scatter.requests)
+    {
+      throw std::runtime_error(
+          "A scatter using shared memory is already in progress.");
+    }
+  }
+
+  // Send a notice to ranks in `ranks0` on the same compute node that
+  // the data in their window has been read, and start receiving the
+  // notices from ranks in `ranks1` on the same compute node. The
+  // requests are completed by shm_wait_read before the window is next
+  // written, so that the end of a scatter does not wait for the other
+  // ranks.
+  void shm_post_read(std::span<const int> node0, std::span<const int> ranks0,
+                     std::span<const int> node1, std::span<const int> ranks1,
+                     int tag, std::vector<MPI_Request>& requests) const
+  {
+    assert(requests.empty());
+    requests.reserve(ranks0.size() + ranks1.size());
+    for (std::size_t i = 0; i < ranks0.size(); ++i)
+    {
+      if (node0[i] != MPI_UNDEFINED)
+      {
+        MPI_Isend(nullptr, 0, MPI_BYTE, ranks0[i], tag, _comm0.comm(),
+                  &requests.emplace_back());
+      }
+    }
+    for (std::size_t i = 0; i < ranks1.size(); ++i)
+    {
+      if (node1[i] != MPI_UNDEFINED)
+      {
+        MPI_Irecv(nullptr, 0, MPI_BYTE, ranks1[i], tag, _comm0.comm(),
+                  &requests.emplace_back());
+      }
+    }
+  }
+
+  // Wait for the notices started by shm_post_read
+  static void shm_wait_read(std::vector<MPI_Request>& requests)
+  {
+    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+    requests.clear();
+  }
+
   // Block size
   int _bs;
 
@@ -656,5 +1096,9 @@ private:
   // Set of ranks ghost owned indices
   // FIXME: Should we store the index map instead?
   std::vector<int> _dest;
+
+  // Shared memory data, created on the first scatter that uses
+  // Scatterer::type::shm. Shared by copies of the Scatterer.
+  mutable std::shared_ptr<shm_data> _shm;
 };
 } // namespace dolfinx::common
@@ -10,6 +10,7 @@ namespace dolfinx::common
 
 // DOLFINx common
 
+#include <dolfinx/common/Distributor.h>
 #include <dolfinx/common/MPI.h>
 #include <dolfinx/common/Table.h>
 #include <dolfinx/common/Timer.h>
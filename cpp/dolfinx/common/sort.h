@@ -8,81 +8,154 @@
 
 #include "Timer.h"
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <bitset>
+#include <cassert>
 #include <cstdint>
 #include <numeric>
 #include <span>
+#include <thread>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace dolfinx
 {
-
-/// Sort a vector of integers with radix sorting algorithm. The bucket
-/// size is determined by the number of bits to sort at a time (2^BITS).
-/// @tparam T Integral type
-/// @tparam BITS The number of bits to sort at a time.
-/// @param[in, out] array The array to sort.
-template <typename T, int BITS = 8>
-void radix_sort(std::span<T> array)
+namespace impl
 {
-  static_assert(std::is_integral<T>(), "This function only sorts integers.");
-
-  if (array.size() <= 1)
+/// @brief Stable LSD radix sort of an array using an unsigned integer
+/// key for each item.
+///
+/// The number of passes is the minimum required to sort `num_bits`
+/// bits with at most `max_bits` bits per pass, and the bits are then
+/// split evenly between the passes (adaptive digit width). For
+/// example, 20-bit keys with `max_bits = 16` are sorted in two passes
+/// of 10 bits rather than one pass of 16 bits and one of 4 bits.
+///
+/// Each pass computes a histogram of the digits, an exclusive prefix
+/// sum and a scatter. With more than one thread, each thread computes
+/// the histogram of a contiguous block of the array. Its scatter
+/// offsets come from a prefix sum in (bucket, thread) order, which
+/// keeps the sort stable.
+///
+/// @param[in,out] data Array to sort.
+/// @param[in] key Function that returns the key of an item, which must
+/// be less than `2^num_bits`.
+/// @param[in] num_bits Number of significant bits in the keys.
+/// @param[in] max_bits Maximum number of bits to sort per pass.
+/// @param[in] num_threads Number of threads. Threads are used only for
+/// large arrays.
+template <typename V, typename KeyFn>
+void radix_sort_by_digits(std::span<V> data, KeyFn key, int num_bits,
+                          int max_bits, int num_threads)
+{
+  if (data.size() <= 1 or num_bits == 0)
     return;
 
-  T max_value = *std::max_element(array.begin(), array.end());
+  const int its = (num_bits + max_bits - 1) / max_bits;
+  const int bits = (num_bits + its - 1) / its;
+  const std::size_t num_buckets = std::size_t(1) << bits;
+  const std::uint64_t mask = (std::uint64_t(1) << bits) - 1;
 
-  // Sort N bits at a time
-  constexpr int bucket_size = 1 << BITS;
-  T mask = (T(1) << BITS) - 1;
+  // Use threads only when each thread has enough work to amortise the
+  // start-up cost
+  constexpr std::size_t min_size_per_thread = 1 << 16;
+  num_threads = std::clamp<std::size_t>(
+      data.size() / min_size_per_thread, 1, std::max(num_threads, 1));
 
-  // Compute number of iterations, most significant digit (N bits) of
-  // maxvalue
-  int its = 0;
-  while (max_value)
+  // Apply fn(thread, i0, i1) to blocks of the array
+  auto run = [n = data.size(), num_threads](auto&& fn)
   {
-    max_value >>= BITS;
-    its++;
-  }
-
-  // Adjacency list arrays for computing insertion position
-  std::array<std::int32_t, bucket_size> counter;
-  std::array<std::int32_t, bucket_size + 1> offset;
+    if (num_threads == 1)
+      fn(0, 0, n);
+    else
+    {
+      std::vector<std::thread> threads;
+      for (int t = 0; t < num_threads; ++t)
+        threads.emplace_back(fn, t, t * n / num_threads,
+                             (t + 1) * n / num_threads);
+      for (auto& t : threads)
+        t.join();
+    }
+  };
 
-  std::int32_t mask_offset = 0;
-  std::vector<T> buffer(array.size());
-  std::span<T> current_perm = array;
-  std::span<T> next_perm = buffer;
-  for (int i = 0; i < its; i++)
+  std::vector<V> buffer(data.size());
+  std::span<V> current = data;
+  std::span<V> next = buffer;
+  std::vector<std::size_t> offsets(num_threads * num_buckets);
+  for (int i = 0; i < its; ++i)
   {
-    // Zero counter array
-    std::fill(counter.begin(), counter.end(), 0);
-
-    // Count number of elements per bucket
-    for (T c : current_perm)
-      counter[(c & mask) >> mask_offset]++;
-
-    // Prefix sum to get the inserting position
-    offset[0] = 0;
-    std::partial_sum(counter.begin(), counter.end(), std::next(offset.begin()));
-    for (T c : current_perm)
+    const int shift = i * bits;
+
+    // Count number of elements per bucket for each block
+    run(
+        [&](int t, std::size_t i0, std::size_t i1)
+        {
+          std::span counter(offsets.data() + t * num_buckets, num_buckets);
+          std::fill(counter.begin(), counter.end(), 0);
+          for (std::size_t j = i0; j < i1; ++j)
+            counter[(key(current[j]) >> shift) & mask]++;
+        });
+
+    // Exclusive prefix sum to get the insertion position for each
+    // bucket and block
+    std::size_t offset = 0;
+    for (std::size_t b = 0; b < num_buckets; ++b)
     {
-      std::int32_t bucket = (c & mask) >> mask_offset;
-      std::int32_t new_pos = offset[bucket + 1] - counter[bucket];
-      next_perm[new_pos] = c;
-      counter[bucket]--;
+      for (int t = 0; t < num_threads; ++t)
+      {
+        std::size_t count = offsets[t * num_buckets + b];
+        offsets[t * num_buckets + b] = offset;
+        offset += count;
+      }
     }
 
-    mask = mask << BITS;
-    mask_offset += BITS;
+    // Scatter each block to the new positions
+    run(
+        [&](int t, std::size_t i0, std::size_t i1)
+        {
+          std::span pos(offsets.data() + t * num_buckets, num_buckets);
+          for (std::size_t j = i0; j < i1; ++j)
+            next[pos[(key(current[j]) >> shift) & mask]++] = current[j];
+        });
 
-    std::swap(current_perm, next_perm);
+    std::swap(current, next);
   }
 
   // Copy data back to array
   if (its % 2 != 0)
-    std::copy(buffer.begin(), buffer.end(), array.begin());
+    std::copy(buffer.begin(), buffer.end(), data.begin());
+}
+
+/// @brief Offset of an integer from the minimum value of a range, as
+/// an unsigned integer.
+template <typename T>
+std::uint64_t key_offset(T value, T min)
+{
+  return static_cast<std::uint64_t>(value) - static_cast<std::uint64_t>(min);
+}
+} // namespace impl
+
+/// Sort a vector of integers with radix sorting algorithm. The bucket
+/// size is determined by the number of bits to sort at a time (2^BITS).
+/// @tparam T Integral type
+/// @tparam BITS The maximum number of bits to sort at a time.
+/// @param[in, out] array The array to sort.
+/// @param[in] num_threads Number of threads to use for large arrays.
+template <typename T, int BITS = 8>
+void radix_sort(std::span<T> array, int num_threads = 1)
+{
+  static_assert(std::is_integral<T>(), "This function only sorts integers.");
+
+  if (array.size() <= 1)
+    return;
+
+  const auto [min, max] = std::minmax_element(array.begin(), array.end());
+  const T min_value = *min;
+  impl::radix_sort_by_digits(
+      array, [min_value](T c) { return impl::key_offset(c, min_value); },
+      std::bit_width(impl::key_offset(*max, min_value)), BITS, num_threads);
 }
 
 /// Returns the indices that would sort (lexicographic) a vector of
@@ -90,11 +163,14 @@ void radix_sort(std::span<T> array)
 /// @tparam T The size of the bitset, which corresponds to the number of
 /// bits necessary to represent a set of integers. For example, N = 96
 /// for mapping three std::int32_t.
-/// @tparam BITS The number of bits to sort at a time
+/// @tparam BITS The maximum number of bits to sort at a time
 /// @param[in] array The array to sort
-/// @param[in] perm FIXME
+/// @param[in,out] perm Permutation of `array`. On exit it is stably
+/// sorted by the values of `array`.
+/// @param[in] num_threads Number of threads to use for large arrays.
 template <typename T, int BITS = 16>
-void argsort_radix(std::span<const T> array, std::span<std::int32_t> perm)
+void argsort_radix(std::span<const T> array, std::span<std::int32_t> perm,
+                   int num_threads = 1)
 {
   static_assert(std::is_integral_v<T>, "Integral required.");
 
@@ -102,64 +178,62 @@ void argsort_radix(std::span<const T> array, std::span<std::int32_t> perm)
     return;
 
   const auto [min, max] = std::minmax_element(array.begin(), array.end());
-  T range = *max - *min + 1;
+  const T min_value = *min;
+  impl::radix_sort_by_digits(
+      perm, [min_value, array](std::int32_t p)
+      { return impl::key_offset(array[p], min_value); },
+      std::bit_width(impl::key_offset(*max, min_value)), BITS, num_threads);
+}
+
+/// @brief Sort rows of integer keys lexicographically, together with a
+/// value for each row.
+///
+/// The keys and values are moved directly, rather than computing a
+/// permutation array and applying it afterwards. Each column is radix
+/// sorted, starting from the last column.
+///
+/// @tparam T Integral type of the keys
+/// @tparam N Number of columns in a key
+/// @tparam V Value type
+/// @tparam BITS The maximum number of bits to sort at a time
+/// @param[in,out] keys The keys to sort
+/// @param[in,out] values The values, which are permuted in the same way
+/// as `keys`. Must be the same size as `keys`.
+/// @param[in] num_threads Number of threads to use for large arrays.
+template <typename T, std::size_t N, typename V, int BITS = 16>
+void sort_by_key(std::span<std::array<T, N>> keys, std::span<V> values,
+                 int num_threads = 1)
+{
+  static_assert(std::is_integral_v<T>, "Integral required.");
+  assert(keys.size() == values.size());
+  if (keys.size() <= 1)
+    return;
 
-  // Sort N bits at a time
-  constexpr int bucket_size = 1 << BITS;
-  T mask = (T(1) << BITS) - 1;
-  std::int32_t mask_offset = 0;
+  std::vector<std::pair<std::array<T, N>, V>> data(keys.size());
+  for (std::size_t i = 0; i < keys.size(); ++i)
+    data[i] = {keys[i], values[i]};
 
-  // Compute number of iterations, most significant digit (N bits) of
-  // maxvalue
-  int its = 0;
-  while (range)
+  // Sort by each column, right to left. Col 0 has the most significant
+  // "digit".
+  for (std::size_t i = 0; i < N; ++i)
   {
-    range >>= BITS;
-    its++;
+    const std::size_t col = N - 1 - i;
+    const auto [min, max] = std::minmax_element(
+        data.begin(), data.end(),
+        [col](auto& a, auto& b) { return a.first[col] < b.first[col]; });
+    const T min_value = min->first[col];
+    impl::radix_sort_by_digits(
+        std::span(data), [col, min_value](auto& d)
+        { return impl::key_offset(d.first[col], min_value); },
+        std::bit_width(impl::key_offset(max->first[col], min_value)), BITS,
+        num_threads);
   }
 
-  // Adjacency list arrays for computing insertion position
-  std::array<std::int32_t, bucket_size> counter;
-  std::array<std::int32_t, bucket_size + 1> offset;
-
-  std::vector<std::int32_t> perm2(perm.size());
-  std::span<std::int32_t> current_perm = perm;
-  std::span<std::int32_t> next_perm = perm2;
-  for (int i = 0; i < its; i++)
+  for (std::size_t i = 0; i < keys.size(); ++i)
   {
-    // Zero counter
-    std::fill(counter.begin(), counter.end(), 0);
-
-    // Count number of elements per bucket
-    for (auto cp : current_perm)
-    {
-      T value = array[cp] - *min;
-      std::int32_t bucket = (value & mask) >> mask_offset;
-      counter[bucket]++;
-    }
-
-    // Prefix sum to get the inserting position
-    offset[0] = 0;
-    std::partial_sum(counter.begin(), counter.end(), std::next(offset.begin()));
-
-    // Sort py permutation
-    for (auto cp : current_perm)
-    {
-      T value = array[cp] - *min;
-      std::int32_t bucket = (value & mask) >> mask_offset;
-      std::int32_t pos = offset[bucket + 1] - counter[bucket];
-      next_perm[pos] = cp;
-      counter[bucket]--;
-    }
-
-    std::swap(current_perm, next_perm);
-
-    mask = mask << BITS;
-    mask_offset += BITS;
+    keys[i] = data[i].first;
+    values[i] = data[i].second;
   }
-
-  if (its % 2 == 1)
-    std::copy(perm2.begin(), perm2.end(), perm.begin());
 }
 
 /// @brief Compute the permutation array that sorts a 2D array by row.
@@ -167,12 +241,14 @@ void argsort_radix(std::span<const T> array, std::span<std::int32_t> perm)
 /// @param[in] x The flattened 2D array to compute the permutation array
 /// for.
 /// @param[in] shape1 The number of columns of `x`.
+/// @param[in] num_threads Number of threads to use for large arrays.
 /// @return The permutation array such that `x[perm[i]] <= x[perm[i +1]].
 /// @pre `x.size()` must be a multiple of `shape1`.
 /// @note This function is suitable for small values of `shape1`. Each
 /// column of `x` is copied into an array that is then sorted.
 template <typename T, int BITS = 16>
-std::vector<std::int32_t> sort_by_perm(std::span<const T> x, std::size_t shape1)
+std::vector<std::int32_t> sort_by_perm(std::span<const T> x, std::size_t shape1,
+                                       int num_threads = 1)
 {
   static_assert(std::is_integral_v<T>, "Integral required.");
   assert(shape1 > 0);
@@ -189,7 +265,7 @@ std::vector<std::int32_t> sort_by_perm(std::span<const T> x, std::size_t shape1)
     int col = shape1 - 1 - i;
     for (std::size_t j = 0; j < shape0; ++j)
       column[j] = x[j * shape1 + col];
-    argsort_radix<T, BITS>(column, perm);
+    argsort_radix<T, BITS>(column, perm, num_threads);
   }
 
   return perm;
@@ -14,5 +14,6 @@ namespace dolfinx
 #include <dolfinx/io/dolfinx_io.h>
 #include <dolfinx/la/dolfinx_la.h>
 #include <dolfinx/mesh/dolfinx_mesh.h>
+#include <dolfinx/multigrid/dolfinx_multigrid.h>
 #include <dolfinx/nls/dolfinx_nls.h>
 #include <dolfinx/refinement/dolfinx_refinement.h>
@@ -184,6 +184,41 @@ get_remote_dofs(MPI_Comm comm, const common::IndexMap& map, int bs_map,
 //-----------------------------------------------------------------------------
 } // namespace
 
+//-----------------------------------------------------------------------------
+std::vector<std::int32_t>
+fem::impl::add_remote_dofs(const DofMap& dofmap,
+                           std::span<const std::int32_t> dofs)
+{
+  auto map = dofmap.index_map;
+  assert(map);
+
+  // Create 'symmetric' neighbourhood communicator
+  MPI_Comm comm;
+  {
+    std::span src = map->src();
+    std::span dest = map->dest();
+    std::vector<int> ranks;
+    std::set_union(src.begin(), src.end(), dest.begin(), dest.end(),
+                   std::back_inserter(ranks));
+    ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+    comm = dolfinx::MPI::neighbourhood_comm(map->comm(), ranks, ranks);
+  }
+
+  std::vector<std::int32_t> dofs_remote;
+  if (int map_bs = dofmap.index_map_bs(); map_bs == dofmap.bs())
+    dofs_remote = get_remote_dofs(comm, *map, 1, dofs);
+  else
+    dofs_remote = get_remote_dofs(comm, *map, map_bs, dofs);
+
+  // Add received bc indices to dofs_local, sort, and remove
+  // duplicates
+  std::vector<std::int32_t> dofs_all(dofs.begin(), dofs.end());
+  dofs_all.insert(dofs_all.end(), dofs_remote.begin(), dofs_remote.end());
+  std::sort(dofs_all.begin(), dofs_all.end());
+  dofs_all.erase(std::unique(dofs_all.begin(), dofs_all.end()),
+                 dofs_all.end());
+  return dofs_all;
+}
 //-----------------------------------------------------------------------------
 std::vector<std::int32_t> fem::locate_dofs_topological(
     const mesh::Topology& topology, const DofMap& dofmap, int dim,
@@ -257,36 +292,7 @@ std::vector<std::int32_t> fem::locate_dofs_topological(
     // Get bc dof indices (local) in V spaces on this process that were
     // found by other processes, e.g. a vertex dof on this process that
     // has no connected facets on the boundary.
-    auto map = dofmap.index_map;
-    assert(map);
-
-    // Create 'symmetric' neighbourhood communicator
-    MPI_Comm comm;
-    {
-      std::span src = map->src();
-      std::span dest = map->dest();
-      std::vector<int> ranks;
-      std::set_union(src.begin(), src.end(), dest.begin(), dest.end(),
-                     std::back_inserter(ranks));
-      ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
-      MPI_Dist_graph_create_adjacent(
-          map->comm(), ranks.size(), ranks.data(), MPI_UNWEIGHTED, ranks.size(),
-          ranks.data(), MPI_UNWEIGHTED, MPI_INFO_NULL, false, &comm);
-    }
-
-    std::vector<std::int32_t> dofs_remote;
-    if (int map_bs = dofmap.index_map_bs(); map_bs == bs)
-      dofs_remote = get_remote_dofs(comm, *map, 1, dofs);
-    else
-      dofs_remote = get_remote_dofs(comm, *map, map_bs, dofs);
-
-    MPI_Comm_free(&comm);
-
-    // Add received bc indices to dofs_local, sort, and remove
-    // duplicates
-    dofs.insert(dofs.end(), dofs_remote.begin(), dofs_remote.end());
-    std::sort(dofs.begin(), dofs.end());
-    dofs.erase(std::unique(dofs.begin(), dofs.end()), dofs.end());
+    dofs = impl::add_remote_dofs(dofmap, dofs);
   }
 
   return dofs;
@@ -388,10 +394,7 @@ std::array<std::vector<std::int32_t>, 2> fem::locate_dofs_topological(
       std::set_union(src.begin(), src.end(), dest.begin(), dest.end(),
                      std::back_inserter(ranks));
       ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
-      MPI_Dist_graph_create_adjacent(map0->comm(), ranks.size(), ranks.data(),
-                                     MPI_UNWEIGHTED, ranks.size(), ranks.data(),
-                                     MPI_UNWEIGHTED, MPI_INFO_NULL, false,
-                                     &comm);
+      comm = dolfinx::MPI::neighbourhood_comm(map0->comm(), ranks, ranks);
     }
 
     std::vector<std::int32_t> dofs_remote = get_remote_dofs(
@@ -407,8 +410,6 @@ std::array<std::vector<std::int32_t>, 2> fem::locate_dofs_topological(
                              dofs_remote.end());
     assert(sorted_bc_dofs[0].size() == sorted_bc_dofs[1].size());
 
-    MPI_Comm_free(&comm);
-
     // Remove duplicates and sort
     perm.resize(sorted_bc_dofs[0].size());
     std::iota(perm.begin(), perm.end(), 0);
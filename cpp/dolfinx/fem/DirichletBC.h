@@ -11,6 +11,7 @@
 #include "DofMap.h"
 #include "Function.h"
 #include "FunctionSpace.h"
+#include <algorithm>
 #include <array>
 #include <concepts>
 #include <dolfinx/common/types.h>
@@ -24,6 +25,80 @@
 
 namespace dolfinx::fem
 {
+namespace impl
+{
+/// @brief Evaluate a marking function at a list of points.
+///
+/// The marker is evaluated on blocks of at most `batch_size` points,
+/// which bounds the size of the temporary arrays created by the
+/// marker, e.g. by a vectorised Python function.
+///
+/// @param[in] x Point coordinates with shape `(3, num_points)`.
+/// Storage is row-major.
+/// @param[in] marker_fn Function marking points.
+/// @param[in] batch_size Maximum number of points passed to a single
+/// call of `marker_fn`.
+/// @return Sorted indices (positions in `x`) of the marked points.
+template <std::floating_point T, typename U>
+std::vector<std::int32_t> mark_points(std::span<const T> x, U marker_fn,
+                                      std::size_t batch_size = 1 << 14)
+{
+  using cmdspan3x_t = MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
+      const T,
+      MDSPAN_IMPL_STANDARD_NAMESPACE::extents<
+          std::size_t, 3, MDSPAN_IMPL_STANDARD_NAMESPACE::dynamic_extent>>;
+
+  const std::size_t num_points = x.size() / 3;
+  if (num_points <= batch_size)
+  {
+    cmdspan3x_t _x(x.data(), 3, num_points);
+    const std::vector<std::int8_t> marked = marker_fn(_x);
+    std::vector<std::int32_t> points;
+    points.reserve(std::count(marked.begin(), marked.end(), true));
+    for (std::size_t i = 0; i < marked.size(); ++i)
+    {
+      if (marked[i])
+        points.push_back(i);
+    }
+    return points;
+  }
+
+  // Pack each batch of points and evaluate the marker
+  std::vector<std::int32_t> points;
+  std::vector<T> x_b(3 * batch_size);
+  for (std::size_t p0 = 0; p0 < num_points; p0 += batch_size)
+  {
+    const std::size_t n = std::min(batch_size, num_points - p0);
+    for (std::size_t j = 0; j < 3; ++j)
+    {
+      std::copy_n(std::next(x.begin(), j * num_points + p0), n,
+                  std::next(x_b.begin(), j * n));
+    }
+
+    cmdspan3x_t _x(x_b.data(), 3, n);
+    const std::vector<std::int8_t> marked = marker_fn(_x);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      if (marked[i])
+        points.push_back(p0 + i);
+    }
+  }
+
+  return points;
+}
+
+/// @brief Add the degree-of-freedom indices on this process that have
+/// been found by other processes.
+///
+/// @param[in] dofmap Dofmap that the dof indices belong to.
+/// @param[in] dofs Degree-of-freedom indices found on this process.
+/// Uses the same block convention as ::locate_dofs_topological.
+/// @return Sorted and unique indices that have been found by this
+/// process or by a neighbouring process.
+/// @note Collective.
+std::vector<std::int32_t> add_remote_dofs(const DofMap& dofmap,
+                                          std::span<const std::int32_t> dofs);
+} // namespace impl
 
 /// @brief Find degrees-of-freedom which belong to the provided mesh
 /// entities (topological).
@@ -90,6 +165,8 @@ std::array<std::vector<std::int32_t>, 2> locate_dofs_topological(
 /// for the provided marking function.
 ///
 /// @attention This function is slower than the topological version.
+/// If the marked degrees of freedom lie on the boundary, use
+/// ::locate_boundary_dofs_geometrical.
 ///
 /// @param[in] V The function (sub)space on which degrees of freedom
 /// will be located.
@@ -101,10 +178,6 @@ template <std::floating_point T, typename U>
 std::vector<std::int32_t> locate_dofs_geometrical(const FunctionSpace<T>& V,
                                                   U marker_fn)
 {
-  // FIXME: Calling V.tabulate_dof_coordinates() is very expensive,
-  // especially when we usually want the boundary dofs only. Add
-  // interface that computes dofs coordinates only for specified cell.
-
   assert(V.element());
   if (V.element()->is_mixed())
   {
@@ -112,27 +185,91 @@ std::vector<std::int32_t> locate_dofs_geometrical(const FunctionSpace<T>& V,
         "Cannot locate dofs geometrically for mixed space. Use subspaces.");
   }
 
-  // Compute dof coordinates
+  // Compute dof coordinates and evaluate the marker. Dofs are numbered
+  // contiguously, so the marked point indices are the dof indices.
   const std::vector<T> dof_coordinates = V.tabulate_dof_coordinates(true);
+  return impl::mark_points(std::span<const T>(dof_coordinates), marker_fn);
+}
 
-  using cmdspan3x_t = MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
-      const T,
-      MDSPAN_IMPL_STANDARD_NAMESPACE::extents<
-          std::size_t, 3, MDSPAN_IMPL_STANDARD_NAMESPACE::dynamic_extent>>;
+/// @brief Find degrees of freedom in the closure of a subset of cells
+/// whose geometric coordinate is true for the provided marking
+/// function.
+///
+/// Only the dof coordinates of the cells in `cells` are computed. This
+/// is much cheaper than ::locate_dofs_geometrical on all cells when the
+/// cells that can contain marked dofs are known, e.g. the cells that
+/// intersect a bounding box of the marked region.
+///
+/// @param[in] V The function (sub)space on which degrees of freedom
+/// will be located.
+/// @param[in] marker_fn Function marking tabulated degrees of freedom
+/// @param[in] cells Candidate cells (local to process).
+/// @return Sorted array of DOF index blocks (local to the MPI rank) in
+/// the space V. Only degrees of freedom in the closure of `cells` on
+/// this process are returned. The array uses the block size of the
+/// dofmap associated with V.
+template <std::floating_point T, typename U>
+std::vector<std::int32_t>
+locate_dofs_geometrical(const FunctionSpace<T>& V, U marker_fn,
+                        std::span<const std::int32_t> cells)
+{
+  assert(V.element());
+  if (V.element()->is_mixed())
+  {
+    throw std::runtime_error(
+        "Cannot locate dofs geometrically for mixed space. Use subspaces.");
+  }
 
-  // Compute marker for each dof coordinate
-  cmdspan3x_t x(dof_coordinates.data(), 3, dof_coordinates.size() / 3);
-  const std::vector<std::int8_t> marked_dofs = marker_fn(x);
+  auto [dofs, x] = V.tabulate_dof_coordinates(cells);
+  std::vector<std::int32_t> marked
+      = impl::mark_points(std::span<const T>(x), marker_fn);
+  for (std::int32_t& p : marked)
+    p = dofs[p];
+  return marked;
+}
 
-  std::vector<std::int32_t> dofs;
-  dofs.reserve(std::count(marked_dofs.begin(), marked_dofs.end(), true));
-  for (std::size_t i = 0; i < marked_dofs.size(); ++i)
+/// @brief Find degrees of freedom on the boundary whose geometric
+/// coordinate is true for the provided marking function.
+///
+/// The marker is evaluated only at the dofs of the cells that are
+/// attached to an exterior facet (see
+/// FunctionSpace::boundary_dof_coordinates). These cells and dofs are
+/// computed once per space, and only the coordinates are recomputed on
+/// repeated calls. Dofs found on other
+/// processes are communicated, as with the `remote` option of
+/// ::locate_dofs_topological.
+///
+/// @pre The facet-to-cell connectivity of the mesh topology must have
+/// been computed.
+/// @note The result is the same as ::locate_dofs_geometrical if
+/// `marker_fn` marks points on the boundary only.
+/// @note Collective.
+///
+/// @param[in] V The function space on which degrees of freedom will be
+/// located.
+/// @param[in] marker_fn Function marking tabulated degrees of freedom
+/// @return Sorted array of DOF index blocks (local to the MPI rank) in
+/// the space V. The array uses the block size of the dofmap associated
+/// with V.
+template <std::floating_point T, typename U>
+std::vector<std::int32_t>
+locate_boundary_dofs_geometrical(const FunctionSpace<T>& V, U marker_fn)
+{
+  assert(V.element());
+  if (V.element()->is_mixed())
   {
-    if (marked_dofs[i])
-      dofs.push_back(i);
+    throw std::runtime_error(
+        "Cannot locate dofs geometrically for mixed space. Use subspaces.");
   }
 
-  return dofs;
+  auto [dofs, x] = V.boundary_dof_coordinates();
+  std::vector<std::int32_t> marked
+      = impl::mark_points(std::span<const T>(x), marker_fn);
+  for (std::int32_t& p : marked)
+    p = dofs[p];
+
+  assert(V.dofmap());
+  return impl::add_remote_dofs(*V.dofmap(), marked);
 }
 
 /// Finds degrees of freedom whose geometric coordinate is true for the
@@ -279,6 +416,89 @@ private:
     return dofs_unrolled;
   }
 
+  /// Compute the (sorted) indices of cells with at least one
+  /// constrained dof.
+  static std::vector<std::int32_t>
+  constrained_cells(const DofMap& dofmap, std::span<const std::int32_t> dofs)
+  {
+    if (dofs.empty())
+      return {};
+
+    const int bs = dofmap.bs();
+    std::vector<std::int8_t> marker(dofs.back() + 1, false);
+    for (std::int32_t dof : dofs)
+      marker[dof] = true;
+
+    auto dmap = dofmap.map();
+    const std::int32_t num_markers = marker.size();
+    std::vector<std::int32_t> cells;
+    for (std::size_t c = 0; c < dmap.extent(0); ++c)
+    {
+      for (std::size_t i = 0; i < dmap.extent(1); ++i)
+      {
+        const std::int32_t d = bs * dmap(c, i);
+        bool marked = false;
+        for (int k = 0; k < bs; ++k)
+          marked = marked or (d + k < num_markers and marker[d + k]);
+        if (marked)
+        {
+          cells.push_back(c);
+          break;
+        }
+      }
+    }
+
+    return cells;
+  }
+
+  /// Number of constrained dofs with index less than `size`.
+  std::size_t num_dofs_below(std::int32_t size) const
+  {
+    auto it = std::lower_bound(_dofs0.begin(), _dofs0.end(), size);
+    return std::distance(_dofs0.begin(), it);
+  }
+
+  /// Call `op(dof, g)` for the first `n` constrained dofs, where `g` is
+  /// the boundary value for `dof`. For a Constant the constrained dofs
+  /// are unrolled blocks, so the value is looked up per block entry.
+  template <typename Op>
+  void for_each_value(std::size_t n, Op op) const
+  {
+    if (std::holds_alternative<std::shared_ptr<const Function<T, U>>>(_g))
+    {
+      auto g = std::get<std::shared_ptr<const Function<T, U>>>(_g);
+      assert(g);
+      std::span<const T> values = g->x()->array();
+      if (_dofs1_g.empty())
+      {
+        for (std::size_t i = 0; i < n; ++i)
+          op(_dofs0[i], values[_dofs0[i]]);
+      }
+      else
+      {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+          assert(_dofs1_g[i] < (std::int32_t)values.size());
+          op(_dofs0[i], values[_dofs1_g[i]]);
+        }
+      }
+    }
+    else if (std::holds_alternative<std::shared_ptr<const Constant<T>>>(_g))
+    {
+      auto g = std::get<std::shared_ptr<const Constant<T>>>(_g);
+      assert(g);
+      const std::vector<T>& value = g->value;
+      const std::size_t bs = _function_space->dofmap()->bs();
+      assert(_dofs0.size() % bs == 0);
+      std::size_t i = 0;
+      for (; i + bs <= n; i += bs)
+        for (std::size_t k = 0; k < bs; ++k)
+          op(_dofs0[i + k], value[k]);
+      for (; i < n; ++i)
+        op(_dofs0[i], value[_dofs0[i] % bs]);
+    }
+  }
+
 public:
   /// @brief Create a representation of a Dirichlet boundary condition
   /// constrained by a scalar- or vector-valued constant.
@@ -359,6 +579,8 @@ public:
       _owned_indices0 *= bs;
       _dofs0 = unroll_dofs(_dofs0, bs);
     }
+
+    _cells = constrained_cells(*V->dofmap(), _dofs0);
   }
 
   /// @brief Create a representation of a Dirichlet boundary condition
@@ -389,6 +611,8 @@ public:
       _owned_indices0 *= bs;
       _dofs0 = unroll_dofs(_dofs0, bs);
     }
+
+    _cells = constrained_cells(*_function_space->dofmap(), _dofs0);
   }
 
   /// @brief Create a representation of a Dirichlet boundary condition
@@ -418,7 +642,8 @@ public:
       : _function_space(V), _g(g),
         _dofs0(std::forward<typename X::value_type>(V_g_dofs[0])),
         _dofs1_g(std::forward<typename X::value_type>(V_g_dofs[1])),
-        _owned_indices0(num_owned(*_function_space->dofmap(), _dofs0))
+        _owned_indices0(num_owned(*_function_space->dofmap(), _dofs0)),
+        _cells(constrained_cells(*_function_space->dofmap(), _dofs0))
   {
   }
 
@@ -480,35 +705,8 @@ public:
   /// @param[in] scale The scaling value to apply
   void set(std::span<T> x, T scale = 1) const
   {
-    if (std::holds_alternative<std::shared_ptr<const Function<T, U>>>(_g))
-    {
-      auto g = std::get<std::shared_ptr<const Function<T, U>>>(_g);
-      assert(g);
-      std::span<const T> values = g->x()->array();
-      auto dofs1_g = _dofs1_g.empty() ? std::span(_dofs0) : std::span(_dofs1_g);
-      std::int32_t x_size = x.size();
-      for (std::size_t i = 0; i < _dofs0.size(); ++i)
-      {
-        if (_dofs0[i] < x_size)
-        {
-          assert(dofs1_g[i] < (std::int32_t)values.size());
-          x[_dofs0[i]] = scale * values[dofs1_g[i]];
-        }
-      }
-    }
-    else if (std::holds_alternative<std::shared_ptr<const Constant<T>>>(_g))
-    {
-      auto g = std::get<std::shared_ptr<const Constant<T>>>(_g);
-      std::vector<T> value = g->value;
-      int bs = _function_space->dofmap()->bs();
-      std::int32_t x_size = x.size();
-      std::for_each(_dofs0.cbegin(), _dofs0.cend(),
-                    [x_size, bs, scale, &value, &x](auto dof)
-                    {
-                      if (dof < x_size)
-                        x[dof] = scale * value[dof % bs];
-                    });
-    }
+    for_each_value(num_dofs_below(x.size()),
+                   [x, scale](std::int32_t dof, T g) { x[dof] = scale * g; });
   }
 
   /// Set bc entries in `x` to `scale * (x0 - x_bc)`
@@ -517,40 +715,12 @@ public:
   /// @param[in] scale The scaling value to apply
   void set(std::span<T> x, std::span<const T> x0, T scale = 1) const
   {
-    if (std::holds_alternative<std::shared_ptr<const Function<T, U>>>(_g))
-    {
-      auto g = std::get<std::shared_ptr<const Function<T, U>>>(_g);
-      assert(g);
-      std::span<const T> values = g->x()->array();
-      assert(x.size() <= x0.size());
-      auto dofs1_g = _dofs1_g.empty() ? std::span(_dofs0) : std::span(_dofs1_g);
-      std::int32_t x_size = x.size();
-      for (std::size_t i = 0; i < _dofs0.size(); ++i)
-      {
-        if (_dofs0[i] < x_size)
-        {
-          assert(dofs1_g[i] < (std::int32_t)values.size());
-          x[_dofs0[i]] = scale * (values[dofs1_g[i]] - x0[_dofs0[i]]);
-        }
-      }
-    }
-    else if (std::holds_alternative<std::shared_ptr<const Constant<T>>>(_g))
-    {
-      auto g = std::get<std::shared_ptr<const Constant<T>>>(_g);
-      const std::vector<T>& value = g->value;
-      std::int32_t bs = _function_space->dofmap()->bs();
-      std::for_each(_dofs0.begin(), _dofs0.end(),
-                    [&x, &x0, &value, scale, bs](auto dof)
-                    {
-                      if (dof < (std::int32_t)x.size())
-                        x[dof] = scale * (value[dof % bs] - x0[dof]);
-                    });
-    }
+    assert(x.size() <= x0.size());
+    for_each_value(num_dofs_below(x.size()),
+                   [x, x0, scale](std::int32_t dof, T g)
+                   { x[dof] = scale * (g - x0[dof]); });
   }
 
-  /// @todo Review this function - it is almost identical to the
-  /// 'DirichletBC::set' function
-  ///
   /// Set boundary condition value for entries with an applied boundary
   /// condition. Other entries are not modified.
   /// @param[out] values The array in which to set the dof values.
@@ -558,24 +728,8 @@ public:
   /// (the space of the function that provides the dof values)
   void dof_values(std::span<T> values) const
   {
-    if (std::holds_alternative<std::shared_ptr<const Function<T, U>>>(_g))
-    {
-      auto g = std::get<std::shared_ptr<const Function<T, U>>>(_g);
-      assert(g);
-      std::span<const T> g_values = g->x()->array();
-      auto dofs1_g = _dofs1_g.empty() ? std::span(_dofs0) : std::span(_dofs1_g);
-      for (std::size_t i = 0; i < dofs1_g.size(); ++i)
-        values[_dofs0[i]] = g_values[dofs1_g[i]];
-    }
-    else if (std::holds_alternative<std::shared_ptr<const Constant<T>>>(_g))
-    {
-      auto g = std::get<std::shared_ptr<const Constant<T>>>(_g);
-      assert(g);
-      const std::vector<T>& g_value = g->value;
-      const std::int32_t bs = _function_space->dofmap()->bs();
-      for (std::size_t i = 0; i < _dofs0.size(); ++i)
-        values[_dofs0[i]] = g_value[_dofs0[i] % bs];
-    }
+    for_each_value(_dofs0.size(),
+                   [values](std::int32_t dof, T g) { values[dof] = g; });
   }
 
   /// Set markers[i] = true if dof i has a boundary condition applied.
@@ -593,6 +747,27 @@ public:
     }
   }
 
+  /// @brief Cells with at least one degree-of-freedom to which the
+  /// boundary condition is applied.
+  /// @return Sorted (process-local) cell indices, including ghost
+  /// cells, of the mesh of the constrained function space.
+  std::span<const std::int32_t> cells() const { return _cells; }
+
+  /// Set markers[c] = true if cell c has at least one dof with a
+  /// boundary condition applied. Value of markers[c] is not changed
+  /// otherwise.
+  /// @param[in,out] markers Cell markers. Assemblers use the markers to
+  /// skip the boundary condition dof checks on cells without boundary
+  /// conditions.
+  void mark_cells(std::span<std::int8_t> markers) const
+  {
+    for (std::int32_t c : _cells)
+    {
+      assert(c < (std::int32_t)markers.size());
+      markers[c] = true;
+    }
+  }
+
 private:
   // The function space (possibly a sub function space)
   std::shared_ptr<const FunctionSpace<U>> _function_space;
@@ -608,5 +783,8 @@ private:
 
   // The first _owned_indices in _dofs are owned by this process
   std::int32_t _owned_indices0 = -1;
+
+  // Cells with at least one constrained dof
+  std::vector<std::int32_t> _cells;
 };
 } // namespace dolfinx::fem
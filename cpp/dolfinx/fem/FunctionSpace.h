@@ -9,6 +9,8 @@
 #include "CoordinateElement.h"
 #include "DofMap.h"
 #include "FiniteElement.h"
+#include <algorithm>
+#include <array>
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_generators.hpp>
 #include <concepts>
@@ -18,8 +20,12 @@
 #include <dolfinx/mesh/Geometry.h>
 #include <dolfinx/mesh/Mesh.h>
 #include <dolfinx/mesh/Topology.h>
+#include <dolfinx/mesh/utils.h>
 #include <map>
 #include <memory>
+#include <numeric>
+#include <span>
+#include <utility>
 #include <vector>
 
 namespace dolfinx::fem
@@ -188,6 +194,202 @@ public:
   /// if `transpose` is false, and otherwise the returned data is
   /// transposed. Storage is row-major.
   std::vector<geometry_type> tabulate_dof_coordinates(bool transpose) const
+  {
+    // Get dofmap local size
+    assert(_dofmap);
+    std::shared_ptr<const common::IndexMap> index_map = _dofmap->index_map;
+    assert(index_map);
+    const int index_map_bs = _dofmap->index_map_bs();
+    const int dofmap_bs = _dofmap->bs();
+    const std::int32_t num_dofs
+        = index_map_bs * (index_map->size_local() + index_map->num_ghosts())
+          / dofmap_bs;
+
+    // Array to hold coordinates to return
+    const std::size_t shape_c0 = transpose ? 3 : num_dofs;
+    const std::size_t shape_c1 = transpose ? num_dofs : 3;
+    std::vector<geometry_type> coords(shape_c0 * shape_c1, 0);
+
+    assert(_mesh);
+    auto map = _mesh->topology()->index_map(_mesh->topology()->dim());
+    assert(map);
+    std::vector<std::int32_t> cells(map->size_local() + map->num_ghosts());
+    std::iota(cells.begin(), cells.end(), 0);
+
+    // Copy dof coordinates into vector
+    tabulate_cell_dof_coordinates(
+        cells,
+        [&coords, num_dofs, transpose](auto dofs, auto x)
+        {
+          const std::size_t gdim = x.extent(1);
+          if (!transpose)
+          {
+            for (std::size_t i = 0; i < dofs.size(); ++i)
+              for (std::size_t j = 0; j < gdim; ++j)
+                coords[dofs[i] * 3 + j] = x(i, j);
+          }
+          else
+          {
+            for (std::size_t i = 0; i < dofs.size(); ++i)
+              for (std::size_t j = 0; j < gdim; ++j)
+                coords[j * num_dofs + dofs[i]] = x(i, j);
+          }
+        });
+
+    return coords;
+  }
+
+  /// @brief Tabulate the physical coordinates of the dofs in the
+  /// closure of a subset of cells.
+  ///
+  /// Only the cells in `cells` are visited. This is much cheaper than
+  /// tabulating the coordinates of all dofs when the dofs of interest
+  /// are restricted to a small part of the mesh, e.g. the boundary.
+  ///
+  /// @param[in] cells Cell indices (local to process).
+  /// @return Sorted dof (block) indices in the closure of `cells` and
+  /// the dof coordinates, which have shape `(3, num_dofs)`. Storage is
+  /// row-major.
+  std::pair<std::vector<std::int32_t>, std::vector<geometry_type>>
+  tabulate_dof_coordinates(std::span<const std::int32_t> cells) const
+  {
+    std::vector<std::int32_t> dofs = closure_dofs(cells);
+    std::vector<geometry_type> coords
+        = tabulate_closure_coordinates(cells, dofs);
+    return {std::move(dofs), std::move(coords)};
+  }
+
+  /// @brief Physical coordinates of the dofs in the closure of the
+  /// cells that are attached to an exterior facet owned by this
+  /// process.
+  ///
+  /// The boundary cells and their dofs depend only on the topology,
+  /// and are computed on the first call and stored on the space. The
+  /// coordinates are computed on each call, so they follow changes to
+  /// the mesh geometry.
+  ///
+  /// @pre The facet-to-cell connectivity of the mesh topology must
+  /// have been computed.
+  /// @return Sorted dof (block) indices and the dof coordinates, which
+  /// have shape `(3, num_dofs)`. Storage is row-major.
+  std::pair<std::vector<std::int32_t>, std::vector<geometry_type>>
+  boundary_dof_coordinates() const
+  {
+    if (!_boundary_cell_dofs)
+    {
+      assert(_mesh);
+      std::shared_ptr<const mesh::Topology> topology = _mesh->topology();
+      assert(topology);
+      const int tdim = topology->dim();
+      const std::vector<std::int32_t> facets
+          = mesh::exterior_facet_indices(*topology);
+
+      // Cells attached to an exterior facet
+      auto f_to_c = topology->connectivity(tdim - 1, tdim);
+      assert(f_to_c);
+      std::vector<std::int32_t> cells;
+      cells.reserve(facets.size());
+      for (std::int32_t f : facets)
+      {
+        assert(f_to_c->num_links(f) == 1);
+        cells.push_back(f_to_c->links(f).front());
+      }
+      std::sort(cells.begin(), cells.end());
+      cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+
+      std::vector<std::int32_t> dofs = closure_dofs(cells);
+      _boundary_cell_dofs = std::make_shared<
+          const std::array<std::vector<std::int32_t>, 2>>(
+          std::array{std::move(cells), std::move(dofs)});
+    }
+
+    const auto& [cells, dofs] = *_boundary_cell_dofs;
+    return {dofs, tabulate_closure_coordinates(cells, dofs)};
+  }
+
+  /// The mesh
+  std::shared_ptr<const mesh::Mesh<geometry_type>> mesh() const
+  {
+    return _mesh;
+  }
+
+  /// The finite element
+  std::shared_ptr<const FiniteElement<geometry_type>> element() const
+  {
+    return _element;
+  }
+
+  /// The dofmap
+  std::shared_ptr<const DofMap> dofmap() const { return _dofmap; }
+
+  /// The shape of the value space
+  std::span<const std::size_t> value_shape() const noexcept
+  {
+    return _value_shape;
+  }
+
+  /// The value size, e.g. 1 for a scalar-valued function, 2 for a 2D vector, 9
+  /// for a second-order tensor in 3D.
+  /// @note The return value of this function is equivalent to
+  /// `std::accumulate(value_shape().begin(), value_shape().end(), 1,
+  /// std::multiplies{})`.
+  int value_size() const
+  {
+    return std::accumulate(_value_shape.begin(), _value_shape.end(), 1,
+                           std::multiplies{});
+  }
+
+private:
+  // Sorted, unique dofs in the closure of a list of cells
+  std::vector<std::int32_t>
+  closure_dofs(std::span<const std::int32_t> cells) const
+  {
+    assert(_dofmap);
+    std::vector<std::int32_t> dofs;
+    dofs.reserve(cells.size() * _dofmap->map().extent(1));
+    for (std::int32_t c : cells)
+    {
+      auto cell_dofs = _dofmap->cell_dofs(c);
+      dofs.insert(dofs.end(), cell_dofs.begin(), cell_dofs.end());
+    }
+    std::sort(dofs.begin(), dofs.end());
+    dofs.erase(std::unique(dofs.begin(), dofs.end()), dofs.end());
+    return dofs;
+  }
+
+  // Coordinates, with shape (3, dofs.size()), of the sorted dofs
+  // `dofs` in the closure of `cells`
+  std::vector<geometry_type>
+  tabulate_closure_coordinates(std::span<const std::int32_t> cells,
+                               std::span<const std::int32_t> dofs) const
+  {
+    const std::size_t num_dofs = dofs.size();
+    std::vector<geometry_type> coords(3 * num_dofs, 0);
+    tabulate_cell_dof_coordinates(
+        cells,
+        [&dofs, &coords, num_dofs](auto cell_dofs, auto x)
+        {
+          for (std::size_t i = 0; i < cell_dofs.size(); ++i)
+          {
+            auto it = std::lower_bound(dofs.begin(), dofs.end(), cell_dofs[i]);
+            assert(it != dofs.end() and *it == cell_dofs[i]);
+            const std::size_t pos = std::distance(dofs.begin(), it);
+            for (std::size_t j = 0; j < x.extent(1); ++j)
+              coords[j * num_dofs + pos] = x(i, j);
+          }
+        });
+    return coords;
+  }
+
+  /// @brief Compute the physical coordinates of the dofs of each cell
+  /// in a list of cells.
+  /// @param[in] cells Cell indices (local to process).
+  /// @param[in] copy Function called for each cell `c` as `copy(dofs,
+  /// x)`, where `dofs` is the cell dofmap and `x(i, j)` is component
+  /// `j` of the physical coordinate of cell dof `i`.
+  template <typename Fn>
+  void tabulate_cell_dof_coordinates(std::span<const std::int32_t> cells,
+                                     Fn copy) const
   {
     if (!_component.empty())
     {
@@ -206,21 +408,10 @@ public:
     assert(_mesh);
     assert(_element);
     const std::size_t gdim = _mesh->geometry().dim();
-    const int tdim = _mesh->topology()->dim();
-
-    // Get dofmap local size
-    assert(_dofmap);
-    std::shared_ptr<const common::IndexMap> index_map = _dofmap->index_map;
-    assert(index_map);
-    const int index_map_bs = _dofmap->index_map_bs();
-    const int dofmap_bs = _dofmap->bs();
 
     const int element_block_size = _element->block_size();
     const std::size_t scalar_dofs
         = _element->space_dimension() / element_block_size;
-    const std::int32_t num_dofs
-        = index_map_bs * (index_map->size_local() + index_map->num_ghosts())
-          / dofmap_bs;
 
     // Get the dof coordinates on the reference element
     if (!_element->interpolation_ident())
@@ -238,11 +429,6 @@ public:
     const std::size_t num_dofs_g = cmap.dim();
     std::span<const geometry_type> x_g = _mesh->geometry().x();
 
-    // Array to hold coordinates to return
-    const std::size_t shape_c0 = transpose ? 3 : num_dofs;
-    const std::size_t shape_c1 = transpose ? num_dofs : 3;
-    std::vector<geometry_type> coords(shape_c0 * shape_c1, 0);
-
     using mdspan2_t = MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
         geometry_type,
         MDSPAN_IMPL_STANDARD_NAMESPACE::dextents<std::size_t, 2>>;
@@ -257,10 +443,6 @@ public:
     std::vector<geometry_type> coordinate_dofs_b(num_dofs_g * gdim);
     mdspan2_t coordinate_dofs(coordinate_dofs_b.data(), num_dofs_g, gdim);
 
-    auto map = _mesh->topology()->index_map(tdim);
-    assert(map);
-    const int num_cells = map->size_local() + map->num_ghosts();
-
     std::span<const std::uint32_t> cell_info;
     if (_element->needs_dof_transformations())
     {
@@ -284,7 +466,7 @@ public:
         = _element->template dof_transformation_fn<geometry_type>(
             doftransform::standard);
 
-    for (int c = 0; c < num_cells; ++c)
+    for (std::int32_t c : cells)
     {
       // Extract cell geometry 'dofs'
       auto x_dofs = MDSPAN_IMPL_STANDARD_NAMESPACE::submdspan(
@@ -298,60 +480,11 @@ public:
       apply_dof_transformation(
           x_b, std::span(cell_info.data(), cell_info.size()), c, x.extent(1));
 
-      // Get cell dofmap
-      auto dofs = _dofmap->cell_dofs(c);
-
-      // Copy dof coordinates into vector
-      if (!transpose)
-      {
-        for (std::size_t i = 0; i < dofs.size(); ++i)
-          for (std::size_t j = 0; j < gdim; ++j)
-            coords[dofs[i] * 3 + j] = x(i, j);
-      }
-      else
-      {
-        for (std::size_t i = 0; i < dofs.size(); ++i)
-          for (std::size_t j = 0; j < gdim; ++j)
-            coords[j * num_dofs + dofs[i]] = x(i, j);
-      }
+      // Copy dof coordinates for the cell dofmap
+      copy(_dofmap->cell_dofs(c), x);
     }
-
-    return coords;
-  }
-
-  /// The mesh
-  std::shared_ptr<const mesh::Mesh<geometry_type>> mesh() const
-  {
-    return _mesh;
-  }
-
-  /// The finite element
-  std::shared_ptr<const FiniteElement<geometry_type>> element() const
-  {
-    return _element;
-  }
-
-  /// The dofmap
-  std::shared_ptr<const DofMap> dofmap() const { return _dofmap; }
-
-  /// The shape of the value space
-  std::span<const std::size_t> value_shape() const noexcept
-  {
-    return _value_shape;
-  }
-
-  /// The value size, e.g. 1 for a scalar-valued function, 2 for a 2D vector, 9
-  /// for a second-order tensor in 3D.
-  /// @note The return value of this function is equivalent to
-  /// `std::accumulate(value_shape().begin(), value_shape().end(), 1,
-  /// std::multiplies{})`.
-  int value_size() const
-  {
-    return std::accumulate(_value_shape.begin(), _value_shape.end(), 1,
-                           std::multiplies{});
   }
 
-private:
   // The mesh
   std::shared_ptr<const mesh::Mesh<geometry_type>> _mesh;
 
@@ -369,6 +502,11 @@ private:
   boost::uuids::uuid _root_space_id;
 
   std::vector<std::size_t> _value_shape;
+
+  // Cells attached to an exterior facet and the dofs in their
+  // closure, computed on first use by boundary_dof_coordinates
+  mutable std::shared_ptr<const std::array<std::vector<std::int32_t>, 2>>
+      _boundary_cell_dofs;
 };
 
 /// Extract FunctionSpaces for (0) rows blocks and (1) columns blocks
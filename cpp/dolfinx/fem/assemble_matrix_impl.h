@@ -57,6 +57,12 @@ using mdspan2_t = MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
 /// mesh
 /// @param cell_info1 The cell permutation information for the trial function
 /// mesh
+/// @param cell_bc0 Marker for test function mesh cells with at least
+/// one Dirichlet row. If not empty, rows of unmarked cells are not
+/// checked for boundary conditions.
+/// @param cell_bc1 Marker for trial function mesh cells with at least
+/// one Dirichlet column. If not empty, columns of unmarked cells are
+/// not checked for boundary conditions.
 template <dolfinx::scalar T>
 void assemble_cells(
     la::MatSet<T> auto mat_set, mdspan2_t x_dofmap,
@@ -69,7 +75,9 @@ void assemble_cells(
     std::span<const std::int8_t> bc1, FEkernel<T> auto kernel,
     std::span<const T> coeffs, int cstride, std::span<const T> constants,
     std::span<const std::uint32_t> cell_info0,
-    std::span<const std::uint32_t> cell_info1)
+    std::span<const std::uint32_t> cell_info1,
+    std::span<const std::int8_t> cell_bc0 = {},
+    std::span<const std::int8_t> cell_bc1 = {})
 {
   if (cells.empty())
     return;
@@ -119,7 +127,7 @@ void assemble_cells(
     auto dofs0 = std::span(dmap0.data_handle() + c0 * num_dofs0, num_dofs0);
     auto dofs1 = std::span(dmap1.data_handle() + c1 * num_dofs1, num_dofs1);
 
-    if (!bc0.empty())
+    if (!bc0.empty() and (cell_bc0.empty() or cell_bc0[c0]))
     {
       for (int i = 0; i < num_dofs0; ++i)
       {
@@ -135,7 +143,7 @@ void assemble_cells(
       }
     }
 
-    if (!bc1.empty())
+    if (!bc1.empty() and (cell_bc1.empty() or cell_bc1[c1]))
     {
       for (int j = 0; j < num_dofs1; ++j)
       {
@@ -191,6 +199,12 @@ void assemble_cells(
 /// function mesh.
 /// @param[in] perms Facet permutation integer. Empty if facet
 /// permutations are not required.
+/// @param[in] cell_bc0 Marker for cells (of the test function mesh)
+/// with at least one row with a Dirichlet boundary condition. If
+/// non-empty, the row markers are not checked for unmarked cells.
+/// @param[in] cell_bc1 Marker for cells (of the trial function mesh)
+/// with at least one column with a Dirichlet boundary condition. If
+/// non-empty, the column markers are not checked for unmarked cells.
 template <dolfinx::scalar T>
 void assemble_exterior_facets(
     la::MatSet<T> auto mat_set, mdspan2_t x_dofmap,
@@ -204,7 +218,9 @@ void assemble_exterior_facets(
     std::span<const T> coeffs, int cstride, std::span<const T> constants,
     std::span<const std::uint32_t> cell_info0,
     std::span<const std::uint32_t> cell_info1,
-    std::span<const std::uint8_t> perms)
+    std::span<const std::uint8_t> perms,
+    std::span<const std::int8_t> cell_bc0 = {},
+    std::span<const std::int8_t> cell_bc1 = {})
 {
   if (facets.empty())
     return;
@@ -257,7 +273,7 @@ void assemble_exterior_facets(
     // Zero rows/columns for essential bcs
     auto dofs0 = std::span(dmap0.data_handle() + cell0 * num_dofs0, num_dofs0);
     auto dofs1 = std::span(dmap1.data_handle() + cell1 * num_dofs1, num_dofs1);
-    if (!bc0.empty())
+    if (!bc0.empty() and (cell_bc0.empty() or cell_bc0[cell0]))
     {
       for (int i = 0; i < num_dofs0; ++i)
       {
@@ -272,7 +288,7 @@ void assemble_exterior_facets(
         }
       }
     }
-    if (!bc1.empty())
+    if (!bc1.empty() and (cell_bc1.empty() or cell_bc1[cell1]))
     {
       for (int j = 0; j < num_dofs1; ++j)
       {
@@ -329,6 +345,12 @@ void assemble_exterior_facets(
 /// function mesh.
 /// @param[in] perms Facet permutation integer. Empty if facet
 /// permutations are not required.
+/// @param[in] cell_bc0 Marker for cells (of the test function mesh)
+/// with at least one row with a Dirichlet boundary condition. If
+/// non-empty, the row markers are not checked for unmarked cells.
+/// @param[in] cell_bc1 Marker for cells (of the trial function mesh)
+/// with at least one column with a Dirichlet boundary condition. If
+/// non-empty, the column markers are not checked for unmarked cells.
 template <dolfinx::scalar T>
 void assemble_interior_facets(
     la::MatSet<T> auto mat_set, mdspan2_t x_dofmap,
@@ -342,7 +364,9 @@ void assemble_interior_facets(
     std::span<const T> coeffs, int cstride, std::span<const int> offsets,
     std::span<const T> constants, std::span<const std::uint32_t> cell_info0,
     std::span<const std::uint32_t> cell_info1,
-    std::span<const std::uint8_t> perms)
+    std::span<const std::uint8_t> perms,
+    std::span<const std::int8_t> cell_bc0 = {},
+    std::span<const std::int8_t> cell_bc1 = {})
 {
   if (facets.empty())
     return;
@@ -449,7 +473,8 @@ void assemble_interior_facets(
     }
 
     // Zero rows/columns for essential bcs
-    if (!bc0.empty())
+    if (!bc0.empty()
+        and (cell_bc0.empty() or cell_bc0[cells0[0]] or cell_bc0[cells0[1]]))
     {
       for (std::size_t i = 0; i < dmapjoint0.size(); ++i)
       {
@@ -464,7 +489,8 @@ void assemble_interior_facets(
         }
       }
     }
-    if (!bc1.empty())
+    if (!bc1.empty()
+        and (cell_bc1.empty() or cell_bc1[cells1[0]] or cell_bc1[cells1[1]]))
     {
       for (std::size_t j = 0; j < dmapjoint1.size(); ++j)
       {
@@ -488,14 +514,18 @@ void assemble_interior_facets(
 /// i.e. a view into a larger matrix, and assembly is performed using
 /// local indices. Rows (bc0) and columns (bc1) with Dirichlet
 /// conditions are zeroed. Markers (bc0 and bc1) can be empty if no bcs
-/// are applied. Matrix is not finalised.
+/// are applied. The optional cell markers (cell_bc0 and cell_bc1) flag
+/// cells with at least one row (column) with a Dirichlet condition;
+/// the bc checks are skipped for other cells. Matrix is not finalised.
 template <dolfinx::scalar T, std::floating_point U>
 void assemble_matrix(
     la::MatSet<T> auto mat_set, const Form<T, U>& a, mdspan2_t x_dofmap,
     std::span<const scalar_value_type_t<T>> x, std::span<const T> constants,
     const std::map<std::pair<IntegralType, int>,
                    std::pair<std::span<const T>, int>>& coefficients,
-    std::span<const std::int8_t> bc0, std::span<const std::int8_t> bc1)
+    std::span<const std::int8_t> bc0, std::span<const std::int8_t> bc1,
+    std::span<const std::int8_t> cell_bc0 = {},
+    std::span<const std::int8_t> cell_bc1 = {})
 {
   // Integration domain mesh
   std::shared_ptr<const mesh::Mesh<U>> mesh = a.mesh();
@@ -549,7 +579,8 @@ void assemble_matrix(
         mat_set, x_dofmap, x, a.domain(IntegralType::cell, i),
         {dofs0, bs0, a.domain(IntegralType::cell, i, *mesh0)}, P0,
         {dofs1, bs1, a.domain(IntegralType::cell, i, *mesh1)}, P1T, bc0, bc1,
-        fn, coeffs, cstride, constants, cell_info0, cell_info1);
+        fn, coeffs, cstride, constants, cell_info0, cell_info1, cell_bc0,
+        cell_bc1);
   }
 
   std::span<const std::uint8_t> perms;
@@ -574,7 +605,7 @@ void assemble_matrix(
         {dofs0, bs0, a.domain(IntegralType::exterior_facet, i, *mesh0)}, P0,
         {dofs1, bs1, a.domain(IntegralType::exterior_facet, i, *mesh1)}, P1T,
         bc0, bc1, fn, coeffs, cstride, constants, cell_info0, cell_info1,
-        perms);
+        perms, cell_bc0, cell_bc1);
   }
 
   for (int i : a.integral_ids(IntegralType::interior_facet))
@@ -590,7 +621,7 @@ void assemble_matrix(
         {*dofmap0, bs0, a.domain(IntegralType::interior_facet, i, *mesh0)}, P0,
         {*dofmap1, bs1, a.domain(IntegralType::interior_facet, i, *mesh1)}, P1T,
         bc0, bc1, fn, coeffs, cstride, c_offsets, constants, cell_info0,
-        cell_info1, perms);
+        cell_info1, perms, cell_bc0, cell_bc1);
   }
 }
 
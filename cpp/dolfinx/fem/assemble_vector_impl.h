@@ -22,6 +22,7 @@
 #include <dolfinx/mesh/Topology.h>
 #include <functional>
 #include <memory>
+#include <numeric>
 #include <span>
 #include <vector>
 
@@ -34,6 +35,59 @@ using mdspan2_t = MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
     MDSPAN_IMPL_STANDARD_NAMESPACE::dextents<std::size_t, 2>>;
 /// @endcond
 
+/// @brief Pack the scaled boundary values `scale * (g - x0)` of the
+/// degrees-of-freedom of a cell, with zero for degrees-of-freedom
+/// without a boundary condition.
+/// @tparam _bs Block size of the dofmap. If less than zero the block
+/// size is determined at runtime.
+/// @param[out] w Scaled boundary values (`size = bs * dofs.size()`).
+/// @param[in] dofs Cell degrees-of-freedom (blocks).
+/// @param[in] bs Block size of the dofmap.
+/// @param[in] bc_values1 The value for entries with an applied boundary
+/// condition.
+/// @param[in] bc_markers1 Marker to identify which DOFs have boundary
+/// conditions applied.
+/// @param[in] x0 Vector used in the lifting (may be empty).
+/// @param[in] scale Scaling to apply.
+template <dolfinx::scalar T, int _bs = -1>
+void pack_bc_values(std::span<T> w, std::span<const std::int32_t> dofs,
+                    int bs, std::span<const T> bc_values1,
+                    std::span<const std::int8_t> bc_markers1,
+                    std::span<const T> x0, T scale)
+{
+  if constexpr (_bs > 0)
+    bs = _bs;
+  for (std::size_t j = 0; j < dofs.size(); ++j)
+  {
+    for (int k = 0; k < bs; ++k)
+    {
+      const std::int32_t jj = bs * dofs[j] + k;
+      assert(jj < (int)bc_markers1.size());
+      const T _x0 = x0.empty() ? 0 : x0[jj];
+      w[bs * j + k]
+          = bc_markers1[jj] ? scale * (bc_values1[jj] - _x0) : T(0);
+    }
+  }
+}
+
+/// @brief Compute the lifting contribution `be = -Ae w` of an element
+/// matrix.
+/// @param[in] Ae Element matrix (row-major, `shape=(be.size(),
+/// w.size())`).
+/// @param[in] w Scaled boundary values of the element columns.
+/// @param[out] be Element vector.
+template <dolfinx::scalar T>
+void lift_element(std::span<const T> Ae, std::span<const T> w,
+                  std::span<T> be)
+{
+  const std::size_t num_cols = w.size();
+  for (std::size_t m = 0; m < be.size(); ++m)
+  {
+    be[m] = -std::transform_reduce(w.begin(), w.end(),
+                                   std::next(Ae.begin(), m * num_cols), T(0));
+  }
+}
+
 /// @brief Apply boundary condition lifting for cell integrals.
 /// @tparam T The scalar type.
 /// @tparam _bs0 The block size of the form test function dof map. If
@@ -71,6 +125,10 @@ using mdspan2_t = MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
 /// conditions applied.
 /// @param[in] x0 Vector used in the lifting.
 /// @param[in] scale Scaling to apply.
+/// @param[in] cell_markers1 Markers for the cells of the trial
+/// function mesh with at least one constrained degree-of-freedom. If
+/// not empty, cells are skipped using the markers instead of checking
+/// `bc_markers1`.
 template <dolfinx::scalar T, int _bs0 = -1, int _bs1 = -1>
 void _lift_bc_cells(
     std::span<T> b, mdspan2_t x_dofmap,
@@ -83,7 +141,8 @@ void _lift_bc_cells(
     std::span<const T> coeffs, int cstride,
     std::span<const std::uint32_t> cell_info0,
     std::span<const std::uint32_t> cell_info1, std::span<const T> bc_values1,
-    std::span<const std::int8_t> bc_markers1, std::span<const T> x0, T scale)
+    std::span<const std::int8_t> bc_markers1, std::span<const T> x0, T scale,
+    std::span<const std::int8_t> cell_markers1 = {})
 {
   if (cells.empty())
     return;
@@ -95,7 +154,7 @@ void _lift_bc_cells(
 
   // Data structures used in bc application
   std::vector<scalar_value_type_t<T>> coordinate_dofs(3 * x_dofmap.extent(1));
-  std::vector<T> Ae, be;
+  std::vector<T> Ae, be, w;
   assert(cells0.size() == cells.size());
   assert(cells1.size() == cells.size());
   for (std::size_t index = 0; index < cells.size(); ++index)
@@ -112,29 +171,34 @@ void _lift_bc_cells(
 
     // Check if bc is applied to cell
     bool has_bc = false;
-    for (std::size_t j = 0; j < dofs1.size(); ++j)
+    if (!cell_markers1.empty())
+      has_bc = cell_markers1[c1];
+    else
     {
-      if constexpr (_bs1 > 0)
+      for (std::size_t j = 0; j < dofs1.size(); ++j)
       {
-        for (int k = 0; k < _bs1; ++k)
+        if constexpr (_bs1 > 0)
         {
-          assert(_bs1 * dofs1[j] + k < (int)bc_markers1.size());
-          if (bc_markers1[_bs1 * dofs1[j] + k])
+          for (int k = 0; k < _bs1; ++k)
           {
-            has_bc = true;
-            break;
+            assert(_bs1 * dofs1[j] + k < (int)bc_markers1.size());
+            if (bc_markers1[_bs1 * dofs1[j] + k])
+            {
+              has_bc = true;
+              break;
+            }
           }
         }
-      }
-      else
-      {
-        for (int k = 0; k < bs1; ++k)
+        else
         {
-          assert(bs1 * dofs1[j] + k < (int)bc_markers1.size());
-          if (bc_markers1[bs1 * dofs1[j] + k])
+          for (int k = 0; k < bs1; ++k)
           {
-            has_bc = true;
-            break;
+            assert(bs1 * dofs1[j] + k < (int)bc_markers1.size());
+            if (bc_markers1[bs1 * dofs1[j] + k])
+            {
+              has_bc = true;
+              break;
+            }
           }
         }
       }
@@ -167,45 +231,13 @@ void _lift_bc_cells(
     P0(Ae, cell_info0, c0, num_cols);
     P1T(Ae, cell_info1, c1, num_rows);
 
-    // Size data structure for assembly
+    // Compute be = -Ae w, where w holds the scaled boundary values of
+    // the cell columns
     be.resize(num_rows);
-    std::fill(be.begin(), be.end(), 0);
-    for (std::size_t j = 0; j < dofs1.size(); ++j)
-    {
-      if constexpr (_bs1 > 0)
-      {
-        for (int k = 0; k < _bs1; ++k)
-        {
-          const std::int32_t jj = _bs1 * dofs1[j] + k;
-          assert(jj < (int)bc_markers1.size());
-          if (bc_markers1[jj])
-          {
-            const T bc = bc_values1[jj];
-            const T _x0 = x0.empty() ? 0 : x0[jj];
-            // const T _x0 = 0;
-            // be -= Ae.col(bs1 * j + k) * scale * (bc - _x0);
-            for (int m = 0; m < num_rows; ++m)
-              be[m] -= Ae[m * num_cols + _bs1 * j + k] * scale * (bc - _x0);
-          }
-        }
-      }
-      else
-      {
-        for (int k = 0; k < bs1; ++k)
-        {
-          const std::int32_t jj = bs1 * dofs1[j] + k;
-          assert(jj < (int)bc_markers1.size());
-          if (bc_markers1[jj])
-          {
-            const T bc = bc_values1[jj];
-            const T _x0 = x0.empty() ? 0 : x0[jj];
-            // be -= Ae.col(bs1 * j + k) * scale * (bc - _x0);
-            for (int m = 0; m < num_rows; ++m)
-              be[m] -= Ae[m * num_cols + bs1 * j + k] * scale * (bc - _x0);
-          }
-        }
-      }
-    }
+    w.resize(num_cols);
+    pack_bc_values<T, _bs1>(w, std::span(dofs1.data_handle(), dofs1.size()),
+                            bs1, bc_values1, bc_markers1, x0, scale);
+    lift_element<T>(Ae, w, be);
 
     for (std::size_t i = 0; i < dofs0.size(); ++i)
     {
@@ -258,6 +290,10 @@ void _lift_bc_cells(
 /// @param[in] scale The scaling to apply.
 /// @param[in] perms Facet permutation integer. Empty if facet
 /// permutations are not required.
+/// @param[in] cell_markers1 Markers for the cells of the trial
+/// function mesh with at least one constrained degree-of-freedom. If
+/// not empty, cells are skipped using the markers instead of checking
+/// `bc_markers1`.
 template <dolfinx::scalar T, int _bs = -1>
 void _lift_bc_exterior_facets(
     std::span<T> b, mdspan2_t x_dofmap,
@@ -271,7 +307,8 @@ void _lift_bc_exterior_facets(
     std::span<const std::uint32_t> cell_info0,
     std::span<const std::uint32_t> cell_info1, std::span<const T> bc_values1,
     std::span<const std::int8_t> bc_markers1, std::span<const T> x0, T scale,
-    std::span<const std::uint8_t> perms)
+    std::span<const std::uint8_t> perms,
+    std::span<const std::int8_t> cell_markers1 = {})
 {
   if (facets.empty())
     return;
@@ -281,7 +318,7 @@ void _lift_bc_exterior_facets(
 
   // Data structures used in bc application
   std::vector<scalar_value_type_t<T>> coordinate_dofs(3 * x_dofmap.extent(1));
-  std::vector<T> Ae, be;
+  std::vector<T> Ae, be, w;
   assert(facets.size() % 2 == 0);
   assert(facets0.size() == facets.size());
   assert(facets1.size() == facets.size());
@@ -303,14 +340,19 @@ void _lift_bc_exterior_facets(
 
     // Check if bc is applied to cell
     bool has_bc = false;
-    for (std::size_t j = 0; j < dofs1.size(); ++j)
+    if (!cell_markers1.empty())
+      has_bc = cell_markers1[cell1];
+    else
     {
-      for (int k = 0; k < bs1; ++k)
+      for (std::size_t j = 0; j < dofs1.size(); ++j)
       {
-        if (bc_markers1[bs1 * dofs1[j] + k])
+        for (int k = 0; k < bs1; ++k)
         {
-          has_bc = true;
-          break;
+          if (bc_markers1[bs1 * dofs1[j] + k])
+          {
+            has_bc = true;
+            break;
+          }
         }
       }
     }
@@ -346,24 +388,13 @@ void _lift_bc_exterior_facets(
     P0(Ae, cell_info0, cell0, num_cols);
     P1T(Ae, cell_info1, cell1, num_rows);
 
-    // Size data structure for assembly
+    // Compute be = -Ae w, where w holds the scaled boundary values of
+    // the cell columns
     be.resize(num_rows);
-    std::fill(be.begin(), be.end(), 0);
-    for (std::size_t j = 0; j < dofs1.size(); ++j)
-    {
-      for (int k = 0; k < bs1; ++k)
-      {
-        const std::int32_t jj = bs1 * dofs1[j] + k;
-        if (bc_markers1[jj])
-        {
-          const T bc = bc_values1[jj];
-          const T _x0 = x0.empty() ? 0 : x0[jj];
-          // be -= Ae.col(bs1 * j + k) * scale * (bc - _x0);
-          for (int m = 0; m < num_rows; ++m)
-            be[m] -= Ae[m * num_cols + bs1 * j + k] * scale * (bc - _x0);
-        }
-      }
-    }
+    w.resize(num_cols);
+    pack_bc_values<T>(w, std::span(dofs1.data_handle(), dofs1.size()), bs1,
+                      bc_values1, bc_markers1, x0, scale);
+    lift_element<T>(Ae, w, be);
 
     for (std::size_t i = 0; i < dofs0.size(); ++i)
       for (int k = 0; k < bs0; ++k)
@@ -407,6 +438,10 @@ void _lift_bc_exterior_facets(
 /// conditions applied.
 /// @param[in] x0 The vector used in the lifting.
 /// @param[in] scale The scaling to apply
+/// @param[in] cell_markers1 Markers for the cells of the trial
+/// function mesh with at least one constrained degree-of-freedom. If
+/// not empty, cells are skipped using the markers instead of checking
+/// `bc_markers1`.
 template <dolfinx::scalar T, int _bs = -1>
 void _lift_bc_interior_facets(
     std::span<T> b, mdspan2_t x_dofmap,
@@ -420,7 +455,8 @@ void _lift_bc_interior_facets(
     std::span<const std::uint32_t> cell_info0,
     std::span<const std::uint32_t> cell_info1,
     std::span<const std::uint8_t> perms, std::span<const T> bc_values1,
-    std::span<const std::int8_t> bc_markers1, std::span<const T> x0, T scale)
+    std::span<const std::int8_t> bc_markers1, std::span<const T> x0, T scale,
+    std::span<const std::int8_t> cell_markers1 = {})
 {
   if (facets.empty())
     return;
@@ -434,7 +470,7 @@ void _lift_bc_interior_facets(
   std::span<X> cdofs0(coordinate_dofs.data(), x_dofmap.extent(1) * 3);
   std::span<X> cdofs1(coordinate_dofs.data() + x_dofmap.extent(1) * 3,
                       x_dofmap.extent(1) * 3);
-  std::vector<T> Ae, be;
+  std::vector<T> Ae, be, w;
 
   // Temporaries for joint dofmaps
   std::vector<std::int32_t> dmapjoint0, dmapjoint1;
@@ -493,32 +529,20 @@ void _lift_bc_interior_facets(
     std::copy(dmap1_cell1.begin(), dmap1_cell1.end(),
               std::next(dmapjoint1.begin(), dmap1_cell0.size()));
 
-    // Check if bc is applied to cell0
+    // Check if bc is applied to cell0 or cell1
     bool has_bc = false;
-    for (std::size_t j = 0; j < dmap1_cell0.size(); ++j)
-    {
-      for (int k = 0; k < bs1; ++k)
-      {
-        if (bc_markers1[bs1 * dmap1_cell0[j] + k])
-        {
-          has_bc = true;
-          break;
-        }
-      }
-    }
-
-    // Check if bc is applied to cell1
-    for (std::size_t j = 0; j < dmap1_cell1.size(); ++j)
+    auto marked = [bs1, bc_markers1](std::span<const std::int32_t> dofs)
     {
-      for (int k = 0; k < bs1; ++k)
-      {
-        if (bc_markers1[bs1 * dmap1_cell1[j] + k])
-        {
-          has_bc = true;
-          break;
-        }
-      }
-    }
+      for (std::int32_t dof : dofs)
+        for (int k = 0; k < bs1; ++k)
+          if (bc_markers1[bs1 * dof + k])
+            return true;
+      return false;
+    };
+    if (!cell_markers1.empty())
+      has_bc = cell_markers1[cells1[0]] or cell_markers1[cells1[1]];
+    else
+      has_bc = marked(dmap1_cell0) or marked(dmap1_cell1);
 
     if (!has_bc)
       continue;
@@ -555,46 +579,12 @@ void _lift_bc_interior_facets(
       P1T(sub_Ae1, cell_info1, cells1[1], 1);
     }
 
+    // Compute be = -Ae w, where w holds the scaled boundary values of
+    // the columns of cell0 and cell1
     be.resize(num_rows);
-    std::fill(be.begin(), be.end(), 0);
-
-    // Compute b = b - A*b for cell0
-    for (std::size_t j = 0; j < dmap1_cell0.size(); ++j)
-    {
-      for (int k = 0; k < bs1; ++k)
-      {
-        const std::int32_t jj = bs1 * dmap1_cell0[j] + k;
-        if (bc_markers1[jj])
-        {
-          const T bc = bc_values1[jj];
-          const T _x0 = x0.empty() ? 0 : x0[jj];
-          // be -= Ae.col(bs1 * j + k) * scale * (bc - _x0);
-          for (int m = 0; m < num_rows; ++m)
-            be[m] -= Ae[m * num_cols + bs1 * j + k] * scale * (bc - _x0);
-        }
-      }
-    }
-
-    // Compute b = b - A*b for cell1
-    const int offset = bs1 * dmap1_cell0.size();
-    for (std::size_t j = 0; j < dmap1_cell1.size(); ++j)
-    {
-      for (int k = 0; k < bs1; ++k)
-      {
-        const std::int32_t jj = bs1 * dmap1_cell1[j] + k;
-        if (bc_markers1[jj])
-        {
-          const T bc = bc_values1[jj];
-          const T _x0 = x0.empty() ? 0 : x0[jj];
-          // be -= Ae.col(offset + bs1 * j + k) * scale * (bc - x0[jj]);
-          for (int m = 0; m < num_rows; ++m)
-          {
-            be[m]
-                -= Ae[m * num_cols + offset + bs1 * j + k] * scale * (bc - _x0);
-          }
-        }
-      }
-    }
+    w.resize(num_cols);
+    pack_bc_values<T>(w, dmapjoint1, bs1, bc_values1, bc_markers1, x0, scale);
+    lift_element<T>(Ae, w, be);
 
     for (std::size_t i = 0; i < dmap0_cell0.size(); ++i)
       for (int k = 0; k < bs0; ++k)
@@ -924,6 +914,10 @@ void assemble_interior_facets(
 /// @param[in] x0 The array used in the lifting, typically a 'current
 /// solution' in a Newton method
 /// @param[in] scale Scaling to apply
+/// @param[in] cell_markers1 Markers for the cells of the trial
+/// function mesh with at least one constrained degree-of-freedom. If
+/// not empty, cells are skipped using the markers instead of checking
+/// `bc_markers1`.
 template <dolfinx::scalar T, std::floating_point U>
 void lift_bc(std::span<T> b, const Form<T, U>& a, mdspan2_t x_dofmap,
              std::span<const scalar_value_type_t<T>> x,
@@ -932,7 +926,7 @@ void lift_bc(std::span<T> b, const Form<T, U>& a, mdspan2_t x_dofmap,
                             std::pair<std::span<const T>, int>>& coefficients,
              std::span<const T> bc_values1,
              std::span<const std::int8_t> bc_markers1, std::span<const T> x0,
-             T scale)
+             T scale, std::span<const std::int8_t> cell_markers1 = {})
 {
   // Integration domain mesh
   std::shared_ptr<const mesh::Mesh<U>> mesh = a.mesh();
@@ -986,7 +980,7 @@ void lift_bc(std::span<T> b, const Form<T, U>& a, mdspan2_t x_dofmap,
           {dofmap0, bs0, a.domain(IntegralType::cell, i, *mesh0)}, P0,
           {dofmap1, bs1, a.domain(IntegralType::cell, i, *mesh1)}, P1T,
           constants, coeffs, cstride, cell_info0, cell_info1, bc_values1,
-          bc_markers1, x0, scale);
+          bc_markers1, x0, scale, cell_markers1);
     }
     else if (bs0 == 3 and bs1 == 3)
     {
@@ -995,7 +989,7 @@ void lift_bc(std::span<T> b, const Form<T, U>& a, mdspan2_t x_dofmap,
           {dofmap0, bs0, a.domain(IntegralType::cell, i, *mesh0)}, P0,
           {dofmap1, bs1, a.domain(IntegralType::cell, i, *mesh1)}, P1T,
           constants, coeffs, cstride, cell_info0, cell_info1, bc_values1,
-          bc_markers1, x0, scale);
+          bc_markers1, x0, scale, cell_markers1);
     }
     else
     {
@@ -1004,7 +998,7 @@ void lift_bc(std::span<T> b, const Form<T, U>& a, mdspan2_t x_dofmap,
                      P0,
                      {dofmap1, bs1, a.domain(IntegralType::cell, i, *mesh1)},
                      P1T, constants, coeffs, cstride, cell_info0, cell_info1,
-                     bc_values1, bc_markers1, x0, scale);
+                     bc_values1, bc_markers1, x0, scale, cell_markers1);
     }
   }
 
@@ -1030,7 +1024,7 @@ void lift_bc(std::span<T> b, const Form<T, U>& a, mdspan2_t x_dofmap,
         {dofmap0, bs0, a.domain(IntegralType::exterior_facet, i, *mesh0)}, P0,
         {dofmap1, bs1, a.domain(IntegralType::exterior_facet, i, *mesh1)}, P1T,
         constants, coeffs, cstride, cell_info0, cell_info1, bc_values1,
-        bc_markers1, x0, scale, perms);
+        bc_markers1, x0, scale, perms, cell_markers1);
   }
 
   for (int i : a.integral_ids(IntegralType::interior_facet))
@@ -1045,7 +1039,7 @@ void lift_bc(std::span<T> b, const Form<T, U>& a, mdspan2_t x_dofmap,
         {dofmap0, bs0, a.domain(IntegralType::interior_facet, i, *mesh0)}, P0,
         {dofmap1, bs1, a.domain(IntegralType::interior_facet, i, *mesh1)}, P1T,
         constants, coeffs, cstride, cell_info0, cell_info1, perms, bc_values1,
-        bc_markers1, x0, scale);
+        bc_markers1, x0, scale, cell_markers1);
   }
 }
 
@@ -1110,21 +1104,27 @@ void apply_lifting(
       const int crange = bs1 * (map1->size_local() + map1->num_ghosts());
       bc_markers1.assign(crange, false);
       bc_values1.assign(crange, 0);
+      auto cell_map1 = V1->mesh()->topology()->index_map(
+          V1->mesh()->topology()->dim());
+      assert(cell_map1);
+      std::vector<std::int8_t> cell_markers1(
+          cell_map1->size_local() + cell_map1->num_ghosts(), false);
       for (const std::shared_ptr<const DirichletBC<T, U>>& bc : bcs1[j])
       {
         bc->mark_dofs(bc_markers1);
+        bc->mark_cells(cell_markers1);
         bc->dof_values(bc_values1);
       }
 
       if (!x0.empty())
       {
         lift_bc<T>(b, *a[j], x_dofmap, x, constants[j], coeffs[j], bc_values1,
-                   bc_markers1, x0[j], scale);
+                   bc_markers1, x0[j], scale, cell_markers1);
       }
       else
       {
         lift_bc<T>(b, *a[j], x_dofmap, x, constants[j], coeffs[j], bc_values1,
-                   bc_markers1, std::span<const T>(), scale);
+                   bc_markers1, std::span<const T>(), scale, cell_markers1);
       }
     }
   }
@@ -246,6 +246,11 @@ void apply_lifting(
 /// @param[in] dof_marker1 Boundary condition markers for the columns.
 /// If bc[i] is true then rows i in A will be zeroed. The index i is a
 /// local index.
+/// @param[in] cell_marker0 Optional markers for the cells of the test
+/// function mesh. If not empty, `dof_marker0` is only checked on cells
+/// `c` with `cell_marker0[c]` true. See DirichletBC::mark_cells.
+/// @param[in] cell_marker1 Optional markers for the cells of the trial
+/// function mesh, used to skip checking `dof_marker1`.
 template <dolfinx::scalar T, std::floating_point U>
 void assemble_matrix(
     la::MatSet<T> auto mat_add, const Form<T, U>& a,
@@ -253,7 +258,9 @@ void assemble_matrix(
     const std::map<std::pair<IntegralType, int>,
                    std::pair<std::span<const T>, int>>& coefficients,
     std::span<const std::int8_t> dof_marker0,
-    std::span<const std::int8_t> dof_marker1)
+    std::span<const std::int8_t> dof_marker1,
+    std::span<const std::int8_t> cell_marker0 = {},
+    std::span<const std::int8_t> cell_marker1 = {})
 
 {
   std::shared_ptr<const mesh::Mesh<U>> mesh = a.mesh();
@@ -262,14 +269,16 @@ void assemble_matrix(
   {
     impl::assemble_matrix(mat_add, a, mesh->geometry().dofmap(),
                           mesh->geometry().x(), constants, coefficients,
-                          dof_marker0, dof_marker1);
+                          dof_marker0, dof_marker1, cell_marker0,
+                          cell_marker1);
   }
   else
   {
     auto x = mesh->geometry().x();
     std::vector<scalar_value_type_t<T>> _x(x.begin(), x.end());
     impl::assemble_matrix(mat_add, a, mesh->geometry().dofmap(), _x, constants,
-                          coefficients, dof_marker0, dof_marker1);
+                          coefficients, dof_marker0, dof_marker1, cell_marker0,
+                          cell_marker1);
   }
 }
 
@@ -293,8 +302,19 @@ void assemble_matrix(
   auto bs0 = a.function_spaces().at(0)->dofmap()->index_map_bs();
   auto bs1 = a.function_spaces().at(1)->dofmap()->index_map_bs();
 
-  // Build dof markers
+  // Number of cells (including ghosts) of the test and trial function
+  // meshes
+  auto num_cells = [](const mesh::Mesh<U>& mesh)
+  {
+    auto cell_map = mesh.topology()->index_map(mesh.topology()->dim());
+    assert(cell_map);
+    return cell_map->size_local() + cell_map->num_ghosts();
+  };
+
+  // Build dof markers, and markers for cells with at least one
+  // constrained dof
   std::vector<std::int8_t> dof_marker0, dof_marker1;
+  std::vector<std::int8_t> cell_marker0, cell_marker1;
   assert(map0);
   std::int32_t dim0 = bs0 * (map0->size_local() + map0->num_ghosts());
   assert(map1);
@@ -307,18 +327,22 @@ void assemble_matrix(
     {
       dof_marker0.resize(dim0, false);
       bcs[k]->mark_dofs(dof_marker0);
+      cell_marker0.resize(num_cells(*a.function_spaces()[0]->mesh()), false);
+      bcs[k]->mark_cells(cell_marker0);
     }
 
     if (a.function_spaces().at(1)->contains(*bcs[k]->function_space()))
     {
       dof_marker1.resize(dim1, false);
       bcs[k]->mark_dofs(dof_marker1);
+      cell_marker1.resize(num_cells(*a.function_spaces()[1]->mesh()), false);
+      bcs[k]->mark_cells(cell_marker1);
     }
   }
 
   // Assemble
   assemble_matrix(mat_add, a, constants, coefficients, dof_marker0,
-                  dof_marker1);
+                  dof_marker1, cell_marker0, cell_marker1);
 }
 
 /// Assemble bilinear form into a matrix
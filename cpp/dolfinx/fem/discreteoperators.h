@@ -8,14 +8,22 @@
 
 #include "DofMap.h"
 #include "FiniteElement.h"
+#include "Function.h"
 #include "FunctionSpace.h"
+#include "sparsitybuild.h"
 #include <array>
 #include <concepts>
 #include <dolfinx/common/IndexMap.h>
 #include <dolfinx/common/math.h>
+#include <dolfinx/la/MatrixCSR.h>
+#include <dolfinx/la/SparsityPattern.h>
+#include <dolfinx/la/Vector.h>
 #include <dolfinx/mesh/Mesh.h>
 #include <memory>
+#include <numeric>
 #include <span>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 namespace dolfinx::fem
@@ -406,4 +414,148 @@ void interpolation_matrix(const FunctionSpace<U>& V0,
   }
 }
 
+/// @brief Create and assemble the interpolation matrix from `V0` to
+/// `V1`.
+///
+/// The sparsity pattern is built from the cells of the mesh, with `V1`
+/// used for the rows and `V0` for the columns. The matrix uses the
+/// (compact) block structure of the dofmaps of the spaces. See
+/// fem::interpolation_matrix.
+///
+/// @param[in] V0 The space to interpolate from
+/// @param[in] V1 The space to interpolate to
+/// @return Interpolation matrix. Values are set in the owned rows only,
+/// i.e. the matrix should not be reverse scattered.
+template <dolfinx::scalar T, std::floating_point U>
+la::MatrixCSR<T> create_interpolation_matrix(const FunctionSpace<U>& V0,
+                                             const FunctionSpace<U>& V1)
+{
+  auto mesh = V0.mesh();
+  assert(mesh);
+  assert(V1.mesh());
+  if (mesh != V1.mesh())
+  {
+    throw std::runtime_error(
+        "Interpolation matrix requires spaces on the same mesh.");
+  }
+
+  auto dofmap0 = V0.dofmap();
+  assert(dofmap0);
+  auto dofmap1 = V1.dofmap();
+  assert(dofmap1);
+
+  // Create and build sparsity pattern
+  la::SparsityPattern sp(mesh->comm(), {dofmap1->index_map, dofmap0->index_map},
+                         {dofmap1->index_map_bs(), dofmap0->index_map_bs()});
+  const int tdim = mesh->topology()->dim();
+  auto cell_map = mesh->topology()->index_map(tdim);
+  assert(cell_map);
+  std::vector<std::int32_t> cells(cell_map->size_local(), 0);
+  std::iota(cells.begin(), cells.end(), 0);
+  sparsitybuild::cells(sp, {cells, cells}, {*dofmap1, *dofmap0});
+  sp.finalize();
+
+  // Build operator
+  la::MatrixCSR<T> A(sp);
+  auto [bs0, bs1] = A.block_size();
+  if (bs0 == 1 and bs1 == 1)
+    interpolation_matrix<T, U>(V0, V1, A.template mat_set_values<1, 1>());
+  else if (bs0 == 2 and bs1 == 1)
+    interpolation_matrix<T, U>(V0, V1, A.template mat_set_values<2, 1>());
+  else if (bs0 == 1 and bs1 == 2)
+    interpolation_matrix<T, U>(V0, V1, A.template mat_set_values<1, 2>());
+  else if (bs0 == 2 and bs1 == 2)
+    interpolation_matrix<T, U>(V0, V1, A.template mat_set_values<2, 2>());
+  else if (bs0 == 3 and bs1 == 1)
+    interpolation_matrix<T, U>(V0, V1, A.template mat_set_values<3, 1>());
+  else if (bs0 == 1 and bs1 == 3)
+    interpolation_matrix<T, U>(V0, V1, A.template mat_set_values<1, 3>());
+  else if (bs0 == 3 and bs1 == 3)
+    interpolation_matrix<T, U>(V0, V1, A.template mat_set_values<3, 3>());
+  else
+  {
+    throw std::runtime_error(
+        "Interpolation matrix not supported between block sizes "
+        + std::to_string(bs0) + " and " + std::to_string(bs1));
+  }
+
+  return A;
+}
+
+/// @brief Interpolation operator between two finite element spaces on
+/// the same mesh.
+///
+/// The operator is assembled once (see
+/// fem::create_interpolation_matrix) and stored as a blocked
+/// la::MatrixCSR. Interpolation is then a sparse matrix-vector product,
+/// which avoids re-computing the local interpolation matrices and dof
+/// transformations on every call. This is beneficial when
+/// interpolating repeatedly between the same pair of spaces, e.g.
+/// P2 → P1 or N1curl → DG projections in post-processing.
+///
+/// @tparam T Scalar type.
+/// @tparam U Mesh geometry scalar type.
+template <dolfinx::scalar T,
+          std::floating_point U = dolfinx::scalar_value_type_t<T>>
+class InterpolationOperator
+{
+public:
+  /// @brief Create an interpolation operator.
+  /// @param[in] V0 The space to interpolate from.
+  /// @param[in] V1 The space to interpolate to.
+  InterpolationOperator(std::shared_ptr<const FunctionSpace<U>> V0,
+                        std::shared_ptr<const FunctionSpace<U>> V1)
+      : _V0(V0), _V1(V1),
+        _A(create_interpolation_matrix<T, U>(*V0, *V1)),
+        _x(_A.index_map(1), _A.block_size()[1])
+  {
+  }
+
+  /// @brief The space interpolated from.
+  std::shared_ptr<const FunctionSpace<U>> V0() const { return _V0; }
+
+  /// @brief The space interpolated to.
+  std::shared_ptr<const FunctionSpace<U>> V1() const { return _V1; }
+
+  /// @brief The assembled interpolation matrix.
+  const la::MatrixCSR<T>& matrix() const { return _A; }
+
+  /// @brief Interpolate `u0` into `u1`.
+  /// @param[out] u1 Function to interpolate into. Must be defined on
+  /// the space `V1` used to create the operator.
+  /// @param[in] u0 Function to interpolate from. Must be defined on the
+  /// space `V0` used to create the operator.
+  void apply(Function<T, U>& u1, const Function<T, U>& u0)
+  {
+    if (u0.function_space() != _V0 or u1.function_space() != _V1)
+    {
+      throw std::runtime_error("Functions are not defined on the spaces of "
+                               "the interpolation operator.");
+    }
+
+    // Copy owned values of u0 into the work vector, which may have
+    // additional ghosts introduced by the sparsity pattern
+    std::span<const T> x0 = u0.x()->array();
+    const std::int32_t size0 = _x.index_map()->size_local() * _x.bs();
+    std::copy_n(x0.begin(), size0, _x.mutable_array().begin());
+
+    // Compute u1 = A u0
+    std::shared_ptr<la::Vector<T>> x1 = u1.x();
+    const std::int32_t size1 = x1->index_map()->size_local() * x1->bs();
+    std::fill_n(x1->mutable_array().begin(), size1, T(0));
+    _A.mult(_x, *x1);
+    x1->scatter_fwd();
+  }
+
+private:
+  // Spaces to interpolate from and to
+  std::shared_ptr<const FunctionSpace<U>> _V0, _V1;
+
+  // Interpolation matrix
+  la::MatrixCSR<T> _A;
+
+  // Work vector compatible with the column index map of the matrix
+  la::Vector<T> _x;
+};
+
 } // namespace dolfinx::fem
@@ -520,9 +520,7 @@ std::pair<std::vector<std::int64_t>, std::vector<int>> get_global_indices(
 
     std::span src = map->src();
     std::span dest = map->dest();
-    MPI_Dist_graph_create_adjacent(
-        map->comm(), src.size(), src.data(), MPI_UNWEIGHTED, dest.size(),
-        dest.data(), MPI_UNWEIGHTED, MPI_INFO_NULL, false, &comm[d]);
+    comm[d] = dolfinx::MPI::neighbourhood_comm(map->comm(), src, dest);
 
     // Number and values to send and receive
     const int num_indices = global[d].size();
@@ -604,12 +602,6 @@ std::pair<std::vector<std::int64_t>, std::vector<int>> get_global_indices(
     }
   }
 
-  for (MPI_Comm c : comm)
-  {
-    if (c != MPI_COMM_NULL)
-      MPI_Comm_free(&c);
-  }
-
   return {std::move(local_to_global_new), std::move(local_to_global_new_owner)};
 }
 //-----------------------------------------------------------------------------
@@ -648,9 +640,19 @@ fem::build_dofmap_data(
                            old_to_new, dof_entity0);
   assert(local_to_global_unowned.size() == local_to_global_owner.size());
 
+  // Owners of unowned dofs are owners of the associated mesh entities,
+  // so the communication graph of the dof map is contained in the union
+  // of the communication graphs of the mesh entity maps
+  std::vector<int> src, dest;
+  for (auto& map : topo_index_maps)
+  {
+    src.insert(src.end(), map->src().begin(), map->src().end());
+    dest.insert(dest.end(), map->dest().begin(), map->dest().end());
+  }
+
   // Create IndexMap for dofs range on this process
   common::IndexMap index_map(comm, num_owned, local_to_global_unowned,
-                             local_to_global_owner);
+                             local_to_global_owner, {src, dest});
 
   // Build re-ordered dofmaps
   std::vector<std::vector<std::int32_t>> dofmaps(node_graphs.size());
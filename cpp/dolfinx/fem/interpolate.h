@@ -11,9 +11,11 @@
 #include "DofMap.h"
 #include "FiniteElement.h"
 #include "FunctionSpace.h"
+#include <algorithm>
 #include <basix/mdspan.hpp>
 #include <concepts>
 #include <dolfinx/common/IndexMap.h>
+#include <dolfinx/common/MPI.h>
 #include <dolfinx/common/types.h>
 #include <dolfinx/geometry/utils.h>
 #include <dolfinx/mesh/Mesh.h>
@@ -131,37 +133,52 @@ template <typename T, std::size_t D>
 using mdspan_t = MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
     T, MDSPAN_IMPL_STANDARD_NAMESPACE::dextents<std::size_t, D>>;
 
-/// @brief Scatter data into non-contiguous memory.
+/// @brief Neighbourhood communication pattern for sending values at
+/// points back to the processes that requested them.
 ///
-/// Scatter blocked data `send_values` to its corresponding `src_rank` and
-/// insert the data into `recv_values`. The insert location in
-/// `recv_values` is determined by `dest_ranks`. If the j-th dest rank
-/// is -1, then `recv_values[j*block_size:(j+1)*block_size]) = 0`.
+/// Created by impl::create_scatter_pattern and used by
+/// impl::scatter_values.
+struct ScatterPattern
+{
+  /// Neighbourhood communicator (owners of values -> requesting
+  /// processes)
+  dolfinx::MPI::Comm comm;
+
+  /// Number of values in a block
+  std::size_t block_size;
+
+  /// Number of values sent to each out-neighbour, and displacements
+  std::vector<std::int32_t> send_sizes, send_offsets;
+
+  /// Number of values received from each in-neighbour, and
+  /// displacements
+  std::vector<std::int32_t> recv_sizes, recv_offsets;
+
+  /// Position in the output array of each received block of values
+  std::vector<std::int32_t> comm_to_output;
+};
+
+/// @brief Create the communication pattern for impl::scatter_values.
 ///
 /// @param[in] comm The MPI communicator
-/// @param[in] src_ranks Rank owning the values of each row in
-/// `send_values`.
+/// @param[in] src_ranks Rank owning the values of each block that is
+/// sent.
 /// @param[in] dest_ranks List of ranks receiving data. Size of array is
-/// how many values we are receiving (not unrolled for block_size).
-/// @param[in] send_values Values to send back to owner. Shape is
-/// `(src_ranks.size(), block_size)`.
-/// @param[in,out] recv_values Array to fill with values.  Shape
-/// `(dest_ranks.size(), block_size)`. Storage is row-major.
+/// how many blocks we are receiving.
+/// @param[in] block_size Number of values in a block.
+/// @return The communication pattern.
 /// @pre It is required that src_ranks are sorted.
 /// @note `dest_ranks` can contain repeated entries.
 /// @note `dest_ranks` might contain -1 (no process owns the point).
-template <dolfinx::scalar T>
-void scatter_values(MPI_Comm comm, std::span<const std::int32_t> src_ranks,
-                    std::span<const std::int32_t> dest_ranks,
-                    mdspan_t<const T, 2> send_values, std::span<T> recv_values)
+inline ScatterPattern
+create_scatter_pattern(MPI_Comm comm, std::span<const std::int32_t> src_ranks,
+                       std::span<const std::int32_t> dest_ranks,
+                       std::size_t block_size)
 {
-  const std::size_t block_size = send_values.extent(1);
-  assert(src_ranks.size() * block_size == send_values.size());
-  assert(recv_values.size() == dest_ranks.size() * block_size);
+  assert(std::is_sorted(src_ranks.begin(), src_ranks.end()));
 
   // Build unique set of the sorted src_ranks
-  std::vector<std::int32_t> out_ranks(src_ranks.size());
-  out_ranks.assign(src_ranks.begin(), src_ranks.end());
+  std::vector<std::int32_t> out_ranks(src_ranks.begin(), src_ranks.end());
   out_ranks.erase(std::unique(out_ranks.begin(), out_ranks.end()),
                   out_ranks.end());
   out_ranks.reserve(out_ranks.size() + 1);
@@ -184,84 +201,126 @@ void scatter_values(MPI_Comm comm, std::span<const std::int32_t> src_ranks,
       comm, in_ranks.size(), in_ranks.data(), MPI_UNWEIGHTED, out_ranks.size(),
       out_ranks.data(), MPI_UNWEIGHTED, MPI_INFO_NULL, false, &reverse_comm);
 
-  std::vector<std::int32_t> comm_to_output;
-  std::vector<std::int32_t> recv_sizes(in_ranks.size());
+  // Compute receive sizes and offsets
+  auto in_neighbor = [&in_ranks](auto rank)
+  {
+    auto it = std::lower_bound(in_ranks.begin(), in_ranks.end(), rank);
+    return std::distance(in_ranks.begin(), it);
+  };
+  std::vector<std::int32_t> recv_sizes(in_ranks.size(), 0);
   recv_sizes.reserve(1);
-  std::vector<std::int32_t> recv_offsets(in_ranks.size() + 1, 0);
+  for (std::int32_t rank : dest_ranks)
   {
-    // Build map from parent to neighborhood communicator ranks
-    std::map<std::int32_t, std::int32_t> rank_to_neighbor;
-    for (std::size_t i = 0; i < in_ranks.size(); i++)
-      rank_to_neighbor[in_ranks[i]] = i;
-
-    // Compute receive sizes
-    std::for_each(
-        dest_ranks.begin(), dest_ranks.end(),
-        [&dest_ranks, &rank_to_neighbor, &recv_sizes, block_size](auto rank)
-        {
-          if (rank >= 0)
-          {
-            const int neighbor = rank_to_neighbor[rank];
-            recv_sizes[neighbor] += block_size;
-          }
-        });
-
-    // Compute receiving offsets
-    std::partial_sum(recv_sizes.begin(), recv_sizes.end(),
-                     std::next(recv_offsets.begin(), 1));
+    if (rank >= 0)
+      recv_sizes[in_neighbor(rank)] += block_size;
+  }
+  std::vector<std::int32_t> recv_offsets(in_ranks.size() + 1, 0);
+  std::partial_sum(recv_sizes.begin(), recv_sizes.end(),
+                   std::next(recv_offsets.begin(), 1));
 
-    // Compute map from receiving values to position in recv_values
-    comm_to_output.resize(recv_offsets.back() / block_size);
-    std::vector<std::int32_t> recv_counter(recv_sizes.size(), 0);
-    for (std::size_t i = 0; i < dest_ranks.size(); ++i)
+  // Compute map from receiving values to position in recv_values
+  std::vector<std::int32_t> comm_to_output(recv_offsets.back() / block_size);
+  std::vector<std::int32_t> recv_counter(recv_sizes.size(), 0);
+  for (std::size_t i = 0; i < dest_ranks.size(); ++i)
+  {
+    if (const std::int32_t rank = dest_ranks[i]; rank >= 0)
     {
-      if (const std::int32_t rank = dest_ranks[i]; rank >= 0)
-      {
-        const int neighbor = rank_to_neighbor[rank];
-        int insert_pos = recv_offsets[neighbor] + recv_counter[neighbor];
-        comm_to_output[insert_pos / block_size] = i * block_size;
-        recv_counter[neighbor] += block_size;
-      }
+      const std::size_t neighbor = in_neighbor(rank);
+      int insert_pos = recv_offsets[neighbor] + recv_counter[neighbor];
+      comm_to_output[insert_pos / block_size] = i * block_size;
+      recv_counter[neighbor] += block_size;
     }
   }
 
-  std::vector<std::int32_t> send_sizes(out_ranks.size());
+  // Compute send sizes and offsets
+  std::vector<std::int32_t> send_sizes(out_ranks.size(), 0);
   send_sizes.reserve(1);
+  for (std::int32_t rank : src_ranks)
   {
-    // Compute map from parent mpi rank to neigbor rank for outgoing data
-    std::map<std::int32_t, std::int32_t> rank_to_neighbor;
-    for (std::size_t i = 0; i < out_ranks.size(); i++)
-      rank_to_neighbor[out_ranks[i]] = i;
-
-    // Compute send sizes
-    std::for_each(src_ranks.begin(), src_ranks.end(),
-                  [&rank_to_neighbor, &send_sizes, block_size](auto rank)
-                  { send_sizes[rank_to_neighbor[rank]] += block_size; });
+    auto it = std::lower_bound(out_ranks.begin(), out_ranks.end(), rank);
+    send_sizes[std::distance(out_ranks.begin(), it)] += block_size;
   }
-
-  // Compute sending offsets
   std::vector<std::int32_t> send_offsets(send_sizes.size() + 1, 0);
   std::partial_sum(send_sizes.begin(), send_sizes.end(),
                    std::next(send_offsets.begin(), 1));
 
+  return {dolfinx::MPI::Comm(reverse_comm, false),
+          block_size,
+          std::move(send_sizes),
+          std::move(send_offsets),
+          std::move(recv_sizes),
+          std::move(recv_offsets),
+          std::move(comm_to_output)};
+}
+
+/// @brief Scatter data into non-contiguous memory using a precomputed
+/// communication pattern.
+///
+/// @param[in] pattern Communication pattern, see
+/// impl::create_scatter_pattern.
+/// @param[in] send_values Values to send back to owner. Shape is
+/// `(num_src_ranks, block_size)`, with row-major storage.
+/// @param[in,out] recv_values Array to fill with values.  Shape
+/// `(num_dest_ranks, block_size)`. Storage is row-major. Blocks with
+/// no owning process are set to zero.
+template <dolfinx::scalar T>
+void scatter_values(const ScatterPattern& pattern,
+                    std::span<const T> send_values, std::span<T> recv_values)
+{
   // Send values to dest ranks
-  std::vector<T> values(recv_offsets.back());
+  std::vector<T> values(pattern.recv_offsets.back());
   values.reserve(1);
-  MPI_Neighbor_alltoallv(send_values.data_handle(), send_sizes.data(),
-                         send_offsets.data(), dolfinx::MPI::mpi_type<T>(),
-                         values.data(), recv_sizes.data(), recv_offsets.data(),
-                         dolfinx::MPI::mpi_type<T>(), reverse_comm);
-  MPI_Comm_free(&reverse_comm);
+  MPI_Neighbor_alltoallv(send_values.data(), pattern.send_sizes.data(),
+                         pattern.send_offsets.data(),
+                         dolfinx::MPI::mpi_type<T>(), values.data(),
+                         pattern.recv_sizes.data(), pattern.recv_offsets.data(),
+                         dolfinx::MPI::mpi_type<T>(), pattern.comm.comm());
 
   // Insert values received from neighborhood communicator in output span
+  const std::size_t block_size = pattern.block_size;
   std::fill(recv_values.begin(), recv_values.end(), T(0));
-  for (std::size_t i = 0; i < comm_to_output.size(); i++)
+  for (std::size_t i = 0; i < pattern.comm_to_output.size(); i++)
   {
-    auto vals = std::next(recv_values.begin(), comm_to_output[i]);
+    auto vals = std::next(recv_values.begin(), pattern.comm_to_output[i]);
     auto vals_from = std::next(values.begin(), i * block_size);
     std::copy_n(vals_from, block_size, vals);
   }
-};
+}
+
+/// @brief Scatter data into non-contiguous memory.
+///
+/// Scatter blocked data `send_values` to its corresponding `src_rank` and
+/// insert the data into `recv_values`. The insert location in
+/// `recv_values` is determined by `dest_ranks`. If the j-th dest rank
+/// is -1, then `recv_values[j*block_size:(j+1)*block_size]) = 0`.
+///
+/// @param[in] comm The MPI communicator
+/// @param[in] src_ranks Rank owning the values of each row in
+/// `send_values`.
+/// @param[in] dest_ranks List of ranks receiving data. Size of array is
+/// how many values we are receiving (not unrolled for block_size).
+/// @param[in] send_values Values to send back to owner. Shape is
+/// `(src_ranks.size(), block_size)`.
+/// @param[in,out] recv_values Array to fill with values.  Shape
+/// `(dest_ranks.size(), block_size)`. Storage is row-major.
+/// @pre It is required that src_ranks are sorted.
+/// @note `dest_ranks` can contain repeated entries.
+/// @note `dest_ranks` might contain -1 (no process owns the point).
+template <dolfinx::scalar T>
+void scatter_values(MPI_Comm comm, std::span<const std::int32_t> src_ranks,
+                    std::span<const std::int32_t> dest_ranks,
+                    mdspan_t<const T, 2> send_values, std::span<T> recv_values)
+{
+  const std::size_t block_size = send_values.extent(1);
+  assert(src_ranks.size() * block_size == send_values.size());
+  assert(recv_values.size() == dest_ranks.size() * block_size);
+  ScatterPattern pattern
+      = create_scatter_pattern(comm, src_ranks, dest_ranks, block_size);
+  scatter_values(pattern,
+                 std::span<const T>(send_values.data_handle(),
+                                    send_values.size()),
+                 recv_values);
+}
 
 /// @brief Apply interpolation operator Pi to data to evaluate the dof
 /// coefficients.
@@ -1141,6 +1200,417 @@ void interpolate(Function<T, U>& u, const Function<T, U>& v,
                       cells);
 }
 
+/// @brief Reusable plan for interpolating a finite element Function
+/// defined on one mesh into a Function defined on a different
+/// (non-matching) mesh.
+///
+/// The plan is built once from the ownership data computed by
+/// fem::create_interpolation_data. It stores, for every interpolation
+/// point owned by this process, the (dof-transformed and pushed
+/// forward) basis function values of the source space and the
+/// corresponding degree-of-freedom indices, i.e. a packed sparse matrix
+/// that maps the source coefficients to point values. It also stores
+/// the neighbourhood communicator and the displacement arrays used to
+/// return the point values to the processes that requested them.
+/// Repeated transfers with fem::interpolate then reduce to a sparse
+/// matrix-vector product followed by a single neighbourhood exchange.
+///
+/// @note A plan is valid as long as the geometry and dofmaps of both
+/// meshes are unchanged. If a mesh is moved the plan must be
+/// re-created.
+///
+/// @tparam T Function scalar type.
+/// @tparam U Mesh geometry scalar type.
+template <dolfinx::scalar T,
+          std::floating_point U = dolfinx::scalar_value_type_t<T>>
+class InterpolationPlan
+{
+public:
+  /// @brief Create an interpolation plan.
+  /// @param[in] V Function space of the Function that will be
+  /// interpolated *from*.
+  /// @param[in] mesh1 Mesh of the Function that will be interpolated
+  /// *into*.
+  /// @param[in] interpolation_data Data associating the interpolation
+  /// points of the destination space with cells of the mesh of `V`.
+  /// This is computed by fem::create_interpolation_data.
+  InterpolationPlan(const FunctionSpace<U>& V, const mesh::Mesh<U>& mesh1,
+                    const geometry::PointOwnershipData<U>& interpolation_data)
+      : _scatter(impl::create_scatter_pattern(
+            V.mesh()->comm(), interpolation_data.dest_owners,
+            interpolation_data.src_owner, V.value_size())),
+        _num_dest_points(interpolation_data.src_owner.size())
+  {
+    auto mesh = V.mesh();
+    assert(mesh);
+    {
+      int result;
+      MPI_Comm_compare(mesh->comm(), mesh1.comm(), &result);
+      if (result == MPI_UNEQUAL)
+      {
+        throw std::runtime_error("Interpolation on different meshes is only "
+                                 "supported on the same communicator.");
+      }
+    }
+
+    auto element = V.element();
+    assert(element);
+    if (int num_sub = element->num_sub_elements();
+        num_sub > 1 and num_sub != element->block_size())
+    {
+      throw std::runtime_error("InterpolationPlan is not supported for mixed "
+                               "elements. Extract subspaces.");
+    }
+
+    if (element->symmetric())
+    {
+      throw std::runtime_error(
+          "InterpolationPlan is not supported for symmetric elements.");
+    }
+
+    _value_size = V.value_size();
+    _bs = element->block_size();
+    _space_dim = element->space_dimension() / _bs;
+    _src_value_size = _value_size / _bs;
+
+    tabulate_basis(V, interpolation_data.dest_points,
+                   interpolation_data.dest_cells);
+  }
+
+  /// Copy constructor
+  InterpolationPlan(const InterpolationPlan& plan) = delete;
+
+  /// Move constructor
+  InterpolationPlan(InterpolationPlan&& plan) = default;
+
+  /// Destructor
+  ~InterpolationPlan() = default;
+
+  /// Copy assignment
+  InterpolationPlan& operator=(const InterpolationPlan& plan) = delete;
+
+  /// Move assignment
+  InterpolationPlan& operator=(InterpolationPlan&& plan) = default;
+
+  /// @brief Value size of the source space.
+  int value_size() const { return _value_size; }
+
+  /// @brief Number of interpolation points requested by this process,
+  /// i.e. the number of values received by InterpolationPlan::scatter.
+  std::size_t num_dest_points() const { return _num_dest_points; }
+
+  /// @brief Number of interpolation points owned by this process, i.e.
+  /// the number of points at which InterpolationPlan::evaluate
+  /// computes values.
+  std::size_t num_src_points() const { return _cells.size(); }
+
+  /// @brief Evaluate a Function at the interpolation points owned by
+  /// this process.
+  /// @param[in] v Function to evaluate. It must be defined on the
+  /// function space used to create the plan.
+  /// @param[out] values Function values at the owned points. Shape is
+  /// `(num_src_points, value_size)` with row-major storage.
+  void evaluate(const Function<T, U>& v, std::span<T> values) const
+  {
+    assert(values.size() == _cells.size() * _value_size);
+    std::span<const T> x = v.x()->array();
+    using X = typename dolfinx::scalar_value_type_t<T>;
+
+    std::fill(values.begin(), values.end(), T(0));
+    const std::size_t num_dofs = _space_dim * _bs;
+    for (std::size_t p = 0; p < _cells.size(); ++p)
+    {
+      if (_cells[p] < 0)
+        continue;
+
+      std::span<const std::int32_t> dofs(_dofs.data() + p * num_dofs,
+                                         num_dofs);
+      impl::mdspan_t<const U, 2> phi(
+          _basis.data() + p * _space_dim * _src_value_size, _space_dim,
+          _src_value_size);
+      std::span<T> _values = values.subspan(p * _value_size, _value_size);
+      for (std::size_t i = 0; i < _space_dim; ++i)
+      {
+        for (int k = 0; k < _bs; ++k)
+        {
+          const T xi = x[dofs[i * _bs + k]];
+          for (std::size_t j = 0; j < _src_value_size; ++j)
+            _values[j * _bs + k] += xi * static_cast<X>(phi(i, j));
+        }
+      }
+    }
+  }
+
+  /// @brief Send values computed at owned points back to the
+  /// processes that requested them.
+  ///
+  /// Values at points for which no owning process was found are set to
+  /// zero.
+  ///
+  /// @param[in] send_values Values computed by
+  /// InterpolationPlan::evaluate. Shape is `(num_src_points,
+  /// value_size)`.
+  /// @param[out] recv_values Values at the points requested by this
+  /// process, ordered as the interpolation points. Shape is
+  /// `(num_dest_points, value_size)`.
+  void scatter(std::span<const T> send_values, std::span<T> recv_values) const
+  {
+    assert(send_values.size() == _cells.size() * _value_size);
+    assert(recv_values.size() == _num_dest_points * _value_size);
+    impl::scatter_values(_scatter, send_values, recv_values);
+  }
+
+private:
+  // Compute the basis function values of the space V at the points x
+  // (shape=(num_points, 3)) located in cells
+  void tabulate_basis(const FunctionSpace<U>& V, std::span<const U> x,
+                      std::span<const std::int32_t> cells)
+  {
+    auto mesh = V.mesh();
+    auto element = V.element();
+    const std::size_t num_points = x.size() / 3;
+    assert(cells.size() == num_points);
+    _cells.assign(cells.begin(), cells.end());
+
+    const std::size_t gdim = mesh->geometry().dim();
+    const std::size_t tdim = mesh->topology()->dim();
+    const CoordinateElement<U>& cmap = mesh->geometry().cmap();
+    auto x_dofmap = mesh->geometry().dofmap();
+    const std::size_t num_dofs_g = cmap.dim();
+    std::span<const U> x_g = mesh->geometry().x();
+
+    const std::size_t reference_value_size
+        = element->reference_value_size() / _bs;
+
+    std::span<const std::uint32_t> cell_info;
+    if (element->needs_dof_transformations())
+    {
+      mesh->topology_mutable()->create_entity_permutations();
+      cell_info = std::span(mesh->topology()->get_cell_permutation_info());
+    }
+
+    std::vector<U> coord_dofs_b(num_dofs_g * gdim);
+    impl::mdspan_t<U, 2> coord_dofs(coord_dofs_b.data(), num_dofs_g, gdim);
+    std::vector<U> xp_b(1 * gdim);
+    impl::mdspan_t<U, 2> xp(xp_b.data(), 1, gdim);
+
+    // Evaluate geometry basis at point (0, 0, 0) on the reference cell.
+    // Used in affine case.
+    std::array<std::size_t, 4> phi0_shape = cmap.tabulate_shape(1, 1);
+    std::vector<U> phi0_b(std::reduce(phi0_shape.begin(), phi0_shape.end(), 1,
+                                      std::multiplies{}));
+    impl::mdspan_t<const U, 4> phi0(phi0_b.data(), phi0_shape);
+    cmap.tabulate(1, std::vector<U>(tdim), {1, tdim}, phi0_b);
+    auto dphi0 = MDSPAN_IMPL_STANDARD_NAMESPACE::submdspan(
+        phi0, std::pair(1, tdim + 1), 0,
+        MDSPAN_IMPL_STANDARD_NAMESPACE::full_extent, 0);
+
+    // Geometry basis at a specific point. Used in non-affine case.
+    std::array<std::size_t, 4> phi_shape = cmap.tabulate_shape(1, 1);
+    std::vector<U> phi_b(
+        std::reduce(phi_shape.begin(), phi_shape.end(), 1, std::multiplies{}));
+    impl::mdspan_t<const U, 4> phi(phi_b.data(), phi_shape);
+    auto dphi = MDSPAN_IMPL_STANDARD_NAMESPACE::submdspan(
+        phi, std::pair(1, tdim + 1), 0,
+        MDSPAN_IMPL_STANDARD_NAMESPACE::full_extent, 0);
+
+    // Reference coordinates and geometry data at each point
+    std::vector<U> Xb(num_points * tdim);
+    impl::mdspan_t<U, 2> X(Xb.data(), num_points, tdim);
+    std::vector<U> J_b(num_points * gdim * tdim);
+    impl::mdspan_t<U, 3> J(J_b.data(), num_points, gdim, tdim);
+    std::vector<U> K_b(num_points * tdim * gdim);
+    impl::mdspan_t<U, 3> K(K_b.data(), num_points, tdim, gdim);
+    std::vector<U> detJ(num_points);
+    std::vector<U> det_scratch(2 * gdim * tdim);
+    for (std::size_t p = 0; p < num_points; ++p)
+    {
+      const std::int32_t cell = cells[p];
+      if (cell < 0)
+        continue;
+
+      auto x_dofs = MDSPAN_IMPL_STANDARD_NAMESPACE::submdspan(
+          x_dofmap, cell, MDSPAN_IMPL_STANDARD_NAMESPACE::full_extent);
+      for (std::size_t i = 0; i < num_dofs_g; ++i)
+      {
+        const int pos = 3 * x_dofs[i];
+        for (std::size_t j = 0; j < gdim; ++j)
+          coord_dofs(i, j) = x_g[pos + j];
+      }
+
+      for (std::size_t j = 0; j < gdim; ++j)
+        xp(0, j) = x[3 * p + j];
+
+      auto _J = MDSPAN_IMPL_STANDARD_NAMESPACE::submdspan(
+          J, p, MDSPAN_IMPL_STANDARD_NAMESPACE::full_extent,
+          MDSPAN_IMPL_STANDARD_NAMESPACE::full_extent);
+      auto _K = MDSPAN_IMPL_STANDARD_NAMESPACE::submdspan(
+          K, p, MDSPAN_IMPL_STANDARD_NAMESPACE::full_extent,
+          MDSPAN_IMPL_STANDARD_NAMESPACE::full_extent);
+
+      std::array<U, 3> Xpb = {0, 0, 0};
+      MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
+          U,
+          MDSPAN_IMPL_STANDARD_NAMESPACE::extents<
+              std::size_t, 1, MDSPAN_IMPL_STANDARD_NAMESPACE::dynamic_extent>>
+          Xp(Xpb.data(), 1, tdim);
+      if (cmap.is_affine())
+      {
+        CoordinateElement<U>::compute_jacobian(dphi0, coord_dofs, _J);
+        CoordinateElement<U>::compute_jacobian_inverse(_J, _K);
+        std::array<U, 3> x0 = {0, 0, 0};
+        for (std::size_t i = 0; i < coord_dofs.extent(1); ++i)
+          x0[i] += coord_dofs(0, i);
+        CoordinateElement<U>::pull_back_affine(Xp, _K, x0, xp);
+      }
+      else
+      {
+        cmap.pull_back_nonaffine(Xp, xp, coord_dofs);
+        cmap.tabulate(1, std::span(Xpb.data(), tdim), {1, tdim}, phi_b);
+        CoordinateElement<U>::compute_jacobian(dphi, coord_dofs, _J);
+        CoordinateElement<U>::compute_jacobian_inverse(_J, _K);
+      }
+      detJ[p]
+          = CoordinateElement<U>::compute_jacobian_determinant(_J, det_scratch);
+
+      for (std::size_t j = 0; j < X.extent(1); ++j)
+        X(p, j) = Xpb[j];
+    }
+
+    // Tabulate basis on the reference cell
+    std::vector<U> basis_reference_b(num_points * _space_dim
+                                     * reference_value_size);
+    impl::mdspan_t<const U, 4> basis_reference(
+        basis_reference_b.data(), 1, num_points, _space_dim,
+        reference_value_size);
+    element->tabulate(basis_reference_b, Xb, {X.extent(0), X.extent(1)}, 0);
+
+    using xu_t = impl::mdspan_t<U, 2>;
+    using xU_t = impl::mdspan_t<const U, 2>;
+    using xJ_t = impl::mdspan_t<const U, 2>;
+    using xK_t = impl::mdspan_t<const U, 2>;
+    auto push_forward_fn
+        = element->basix_element().template map_fn<xu_t, xU_t, xJ_t, xK_t>();
+    auto apply_dof_transformation
+        = element->template dof_transformation_fn<U>(doftransform::standard);
+
+    // Apply dof transformations and push forward basis to the physical
+    // cells, and store the (unrolled) dof indices of each cell
+    auto dofmap = V.dofmap();
+    assert(dofmap);
+    const int bs_dof = dofmap->bs();
+    const std::size_t num_dofs = _space_dim * _bs;
+    _basis.resize(num_points * _space_dim * _src_value_size, 0);
+    _dofs.resize(num_points * num_dofs, -1);
+    const std::size_t num_basis_values = _space_dim * reference_value_size;
+    for (std::size_t p = 0; p < num_points; ++p)
+    {
+      const std::int32_t cell = cells[p];
+      if (cell < 0)
+        continue;
+
+      apply_dof_transformation(
+          std::span(basis_reference_b.data() + p * num_basis_values,
+                    num_basis_values),
+          cell_info, cell, reference_value_size);
+
+      impl::mdspan_t<U, 2> basis(
+          _basis.data() + p * _space_dim * _src_value_size, _space_dim,
+          _src_value_size);
+      auto _U = MDSPAN_IMPL_STANDARD_NAMESPACE::submdspan(
+          basis_reference, 0, p, MDSPAN_IMPL_STANDARD_NAMESPACE::full_extent,
+          MDSPAN_IMPL_STANDARD_NAMESPACE::full_extent);
+      auto _J = MDSPAN_IMPL_STANDARD_NAMESPACE::submdspan(
+          J, p, MDSPAN_IMPL_STANDARD_NAMESPACE::full_extent,
+          MDSPAN_IMPL_STANDARD_NAMESPACE::full_extent);
+      auto _K = MDSPAN_IMPL_STANDARD_NAMESPACE::submdspan(
+          K, p, MDSPAN_IMPL_STANDARD_NAMESPACE::full_extent,
+          MDSPAN_IMPL_STANDARD_NAMESPACE::full_extent);
+      push_forward_fn(basis, _U, _J, detJ[p], _K);
+
+      std::span<const std::int32_t> dofs = dofmap->cell_dofs(cell);
+      for (std::size_t i = 0; i < num_dofs; ++i)
+      {
+        std::div_t pos = std::div(static_cast<int>(i), bs_dof);
+        _dofs[p * num_dofs + i] = bs_dof * dofs[pos.quot] + pos.rem;
+      }
+    }
+  }
+
+  // Communication pattern for sending values at owned points back to
+  // the requesting processes
+  impl::ScatterPattern _scatter;
+
+  // Number of points requested by this process
+  std::size_t _num_dest_points;
+
+  // Value size of the space and the element block size
+  int _value_size, _bs;
+
+  // Number of scalar dofs per cell and value size of the scalar
+  // element
+  std::size_t _space_dim, _src_value_size;
+
+  // Cell containing each owned point (-1 if not found)
+  std::vector<std::int32_t> _cells;
+
+  // Pushed-forward basis values at each owned point. Shape is
+  // (num_src_points, space_dim, src_value_size).
+  std::vector<U> _basis;
+
+  // Unrolled indices of the degrees-of-freedom of the cell containing
+  // each owned point. Shape is (num_src_points, space_dim * bs).
+  std::vector<std::int32_t> _dofs;
+};
+
+/// @brief Interpolate a finite element Function defined on a mesh to a
+/// finite element Function defined on different (non-matching) mesh
+/// using a precomputed InterpolationPlan.
+/// @tparam T Function scalar type.
+/// @tparam U mesh::Mesh geometry scalar type.
+/// @param u Function to interpolate into.
+/// @param v Function to interpolate from. It must be defined on the
+/// function space that was used to create `plan`.
+/// @param cells Cells indices relative to the mesh associated with `u`
+/// that will be interpolated into. Must be the same cells used to
+/// create the interpolation data from which `plan` was built.
+/// @param plan Precomputed interpolation plan.
+template <dolfinx::scalar T, std::floating_point U>
+void interpolate(Function<T, U>& u, const Function<T, U>& v,
+                 std::span<const std::int32_t> cells,
+                 const InterpolationPlan<T, U>& plan)
+{
+  assert(u.function_space());
+  const std::size_t value_size = u.function_space()->value_size();
+  if (value_size != (std::size_t)plan.value_size())
+  {
+    throw std::runtime_error(
+        "Interpolation: elements have different value dimensions");
+  }
+
+  // Evaluate v at owned points and send values back to the requesting
+  // processes
+  std::vector<T> send_values(plan.num_src_points() * value_size);
+  plan.evaluate(v, send_values);
+  std::vector<T> values_b(plan.num_dest_points() * value_size);
+  plan.scatter(send_values, values_b);
+
+  // Transpose received data
+  using dextents2 = MDSPAN_IMPL_STANDARD_NAMESPACE::dextents<std::size_t, 2>;
+  MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<const T, dextents2> values(
+      values_b.data(), plan.num_dest_points(), value_size);
+  std::vector<T> valuesT_b(value_size * plan.num_dest_points());
+  MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<T, dextents2> valuesT(
+      valuesT_b.data(), value_size, plan.num_dest_points());
+  for (std::size_t i = 0; i < values.extent(0); ++i)
+    for (std::size_t j = 0; j < values.extent(1); ++j)
+      valuesT(j, i) = values(i, j);
+
+  // Call local interpolation operator
+  fem::interpolate<T>(u, valuesT_b, {valuesT.extent(0), valuesT.extent(1)},
+                      cells);
+}
+
 /// @brief Interpolate from one finite element Function to another
 /// Function on the same (sub)mesh.
 ///
@@ -31,9 +31,18 @@ Vec fem::petsc::create_vector_block(
   for (auto& sub_owner : ghost_new_owners)
     ghost_owners.insert(ghost_owners.end(), sub_owner.begin(), sub_owner.end());
 
+  // The communication graph of the combined map is contained in the
+  // union of the communication graphs of the blocks
+  std::vector<int> src, dest;
+  for (auto& [map, _] : maps)
+  {
+    src.insert(src.end(), map.get().src().begin(), map.get().src().end());
+    dest.insert(dest.end(), map.get().dest().begin(), map.get().dest().end());
+  }
+
   // Create map for combined problem, and create vector
   common::IndexMap index_map(maps[0].first.get().comm(), local_offset.back(),
-                             ghosts, ghost_owners);
+                             ghosts, ghost_owners, {src, dest});
 
   // NOTE: Calling
   //
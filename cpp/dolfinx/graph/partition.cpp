@@ -33,6 +33,24 @@ graph::partition_graph(MPI_Comm comm, int nparts,
 #endif
 }
 //-----------------------------------------------------------------------------
+graph::AdjacencyList<std::int32_t> graph::weighted_partition_graph(
+    MPI_Comm comm, int nparts, const AdjacencyList<std::int64_t>& local_graph,
+    const GraphWeights& weights, bool ghosting)
+{
+#if HAS_PARMETIS
+  return graph::parmetis::weighted_partitioner()(comm, nparts, local_graph,
+                                                 weights, ghosting);
+#elif HAS_PTSCOTCH
+  return graph::scotch::weighted_partitioner()(comm, nparts, local_graph,
+                                               weights, ghosting);
+#elif HAS_KAHIP
+  return graph::kahip::weighted_partitioner()(comm, nparts, local_graph,
+                                              weights, ghosting);
+#else
+// Should never reach this point
+#endif
+}
+//-----------------------------------------------------------------------------
 std::tuple<graph::AdjacencyList<std::int64_t>, std::vector<int>,
            std::vector<std::int64_t>, std::vector<int>>
 graph::build::distribute(MPI_Comm comm,
@@ -103,10 +121,7 @@ graph::build::distribute(MPI_Comm comm,
   std::sort(src.begin(), src.end());
 
   // Create neighbourhood communicator
-  MPI_Comm neigh_comm;
-  MPI_Dist_graph_create_adjacent(comm, src.size(), src.data(), MPI_UNWEIGHTED,
-                                 dest.size(), dest.data(), MPI_UNWEIGHTED,
-                                 MPI_INFO_NULL, false, &neigh_comm);
+  MPI_Comm neigh_comm = dolfinx::MPI::neighbourhood_comm(comm, src, dest);
 
   // Send number of nodes to receivers
   std::vector<int> num_items_recv(src.size());
@@ -158,7 +173,6 @@ graph::build::distribute(MPI_Comm comm,
                          num_items_recv.data(), recv_disp.data(), compound_type,
                          neigh_comm);
   MPI_Type_free(&compound_type);
-  MPI_Comm_free(&neigh_comm);
 
   // Unpack receive buffer
   std::vector<int> src_ranks0, src_ranks1, ghost_index_owner;
@@ -285,10 +299,7 @@ graph::build::distribute(MPI_Comm comm, std::span<const std::int64_t> list,
   std::sort(src.begin(), src.end());
 
   // Create neighbourhood communicator
-  MPI_Comm neigh_comm;
-  MPI_Dist_graph_create_adjacent(comm, src.size(), src.data(), MPI_UNWEIGHTED,
-                                 dest.size(), dest.data(), MPI_UNWEIGHTED,
-                                 MPI_INFO_NULL, false, &neigh_comm);
+  MPI_Comm neigh_comm = dolfinx::MPI::neighbourhood_comm(comm, src, dest);
 
   // Send number of nodes to receivers
   std::vector<int> num_items_recv(src.size());
@@ -339,7 +350,6 @@ graph::build::distribute(MPI_Comm comm, std::span<const std::int64_t> list,
                          num_items_recv.data(), recv_disp.data(), compound_type,
                          neigh_comm);
   MPI_Type_free(&compound_type);
-  MPI_Comm_free(&neigh_comm);
 
   spdlog::debug("Received {} data on {} [{}]", recv_disp.back(), rank,
                 shape[1]);
@@ -428,17 +438,11 @@ graph::build::compute_ghost_indices(MPI_Comm comm,
     }
   }
 
-  MPI_Comm neighbor_comm_fwd, neighbor_comm_rev;
-
   std::vector<int> in_edges = MPI::compute_graph_edges_pcx(comm, neighbors);
-  MPI_Dist_graph_create_adjacent(comm, in_edges.size(), in_edges.data(),
-                                 MPI_UNWEIGHTED, neighbors.size(),
-                                 neighbors.data(), MPI_UNWEIGHTED,
-                                 MPI_INFO_NULL, false, &neighbor_comm_fwd);
-  MPI_Dist_graph_create_adjacent(comm, neighbors.size(), neighbors.data(),
-                                 MPI_UNWEIGHTED, in_edges.size(),
-                                 in_edges.data(), MPI_UNWEIGHTED, MPI_INFO_NULL,
-                                 false, &neighbor_comm_rev);
+  MPI_Comm neighbor_comm_fwd
+      = dolfinx::MPI::neighbourhood_comm(comm, in_edges, neighbors);
+  MPI_Comm neighbor_comm_rev
+      = dolfinx::MPI::neighbourhood_comm(comm, neighbors, in_edges);
 
   std::vector<int> send_offsets = {0};
   send_offsets.reserve(ghost_index_count.size() + 1);
@@ -512,8 +516,6 @@ graph::build::compute_ghost_indices(MPI_Comm comm,
                          recv_offsets.data(), MPI_INT64_T, new_recv.data(),
                          ghost_index_count.data(), send_offsets.data(),
                          MPI_INT64_T, neighbor_comm_rev);
-  MPI_Comm_free(&neighbor_comm_fwd);
-  MPI_Comm_free(&neighbor_comm_rev);
 
   // Build (old id,  new id) pairs
   std::vector<std::array<std::int64_t, 2>> old_to_new1(send_data.size());
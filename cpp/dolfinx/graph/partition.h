@@ -31,6 +31,40 @@ namespace dolfinx::graph
 using partition_fn = std::function<graph::AdjacencyList<std::int32_t>(
     MPI_Comm, int, const AdjacencyList<std::int64_t>&, bool)>;
 
+/// @brief Node and edge weights of a distributed graph.
+///
+/// Weights must be non-negative. Empty weights are interpreted as unit
+/// weights.
+struct GraphWeights
+{
+  /// Node weights, with shape `(num_nodes, num_constraints)`. Storage
+  /// is row-major.
+  std::span<const std::int32_t> nodes = {};
+
+  /// Number of weights for each node. Each weight is a separate
+  /// balance constraint, e.g. the assembly cost and the number of
+  /// boundary facets of a cell.
+  int num_constraints = 1;
+
+  /// Edge weights, one for each entry of AdjacencyList::array.
+  std::span<const std::int32_t> edges = {};
+};
+
+/// @brief Signature of functions for computing the parallel
+/// partitioning of a distributed graph with weighted nodes and edges.
+/// @param[in] comm MPI Communicator that the graph is distributed
+/// across
+/// @param[in] nparts Number of partitions to divide graph nodes into
+/// @param[in] local_graph Node connectivity graph
+/// @param[in] weights Node and edge weights of `local_graph`
+/// @param[in] ghosting Flag to enable ghosting of the output node
+/// distribution
+/// @return Destination rank for each input node
+using weighted_partition_fn
+    = std::function<graph::AdjacencyList<std::int32_t>(
+        MPI_Comm, int, const AdjacencyList<std::int64_t>&,
+        const GraphWeights&, bool)>;
+
 /// @brief Partition graph across processes using the default graph
 /// partitioner.
 ///
@@ -45,6 +79,22 @@ AdjacencyList<std::int32_t>
 partition_graph(MPI_Comm comm, int nparts,
                 const AdjacencyList<std::int64_t>& local_graph, bool ghosting);
 
+/// @brief Partition a graph with weighted nodes and edges across
+/// processes using the default graph partitioner.
+///
+/// @param[in] comm MPI communicator that the graph is distributed
+/// across.
+/// @param[in] nparts Number of partitions to divide graph nodes into.
+/// @param[in] local_graph Node connectivity graph.
+/// @param[in] weights Node and edge weights of `local_graph`.
+/// @param[in] ghosting Flag to enable ghosting of the output node
+/// distribution.
+/// @return Destination rank for each input node.
+AdjacencyList<std::int32_t>
+weighted_partition_graph(MPI_Comm comm, int nparts,
+                         const AdjacencyList<std::int64_t>& local_graph,
+                         const GraphWeights& weights, bool ghosting);
+
 /// Tools for distributed graphs
 ///
 /// @todo Add a function that sends data to the 'owner'
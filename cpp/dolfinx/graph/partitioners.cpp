@@ -11,6 +11,7 @@
 #include <dolfinx/common/log.h>
 #include <map>
 #include <numeric>
+#include <optional>
 #include <set>
 #include <vector>
 
@@ -200,6 +201,60 @@ graph::AdjacencyList<int> compute_destination_ranks(
   return g;
 }
 //-----------------------------------------------------------------------------
+
+/// @brief Copy graph weights to the integer type used by a graph
+/// partitioner.
+///
+/// Partitioners require that weights are passed on all ranks or on no
+/// rank. If weights are passed on some ranks only, unit weights are
+/// used on the other ranks.
+///
+/// @param[in] comm The communicator
+/// @param[in] graph Graph, using global indices for graph edges
+/// @param[in] weights Node and edge weights of `graph`
+/// @return Node and edge weights. The weights are `std::nullopt` if
+/// they are empty on all ranks.
+template <typename T>
+std::pair<std::optional<std::vector<T>>, std::optional<std::vector<T>>>
+copy_weights(MPI_Comm comm, const graph::AdjacencyList<std::int64_t>& graph,
+             const graph::GraphWeights& weights)
+{
+  const std::size_t num_node_weights
+      = graph.num_nodes() * weights.num_constraints;
+  if (!weights.nodes.empty() and weights.nodes.size() != num_node_weights)
+    throw std::runtime_error("Number of node weights and graph nodes differ.");
+  if (!weights.edges.empty() and weights.edges.size() != graph.array().size())
+    throw std::runtime_error("Number of edge weights and graph edges differ.");
+  if (std::ranges::any_of(weights.nodes, [](auto w) { return w < 0; })
+      or std::ranges::any_of(weights.edges, [](auto w) { return w < 0; }))
+  {
+    throw std::runtime_error("Graph weights must be non-negative.");
+  }
+
+  std::array<int, 2> weighted_local
+      = {!weights.nodes.empty(), !weights.edges.empty()};
+  std::array<int, 2> weighted;
+  MPI_Allreduce(weighted_local.data(), weighted.data(), 2, MPI_INT, MPI_LOR,
+                comm);
+
+  auto copy = [](bool has_weights, std::span<const std::int32_t> w,
+                 std::size_t size) -> std::optional<std::vector<T>>
+  {
+    if (!has_weights)
+      return std::nullopt;
+
+    // Pointer to the weights must not be null, even if this rank has
+    // no graph nodes
+    std::vector<T> x(size, 1);
+    x.reserve(1);
+    std::copy(w.begin(), w.end(), x.begin());
+    return x;
+  };
+
+  return {copy(weighted[0], weights.nodes, num_node_weights),
+          copy(weighted[1], weights.edges, graph.array().size())};
+}
+//-----------------------------------------------------------------------------
 #ifdef HAS_PARMETIS
 template <typename T>
 std::vector<int> adaptive_repartition(MPI_Comm comm,
@@ -307,14 +362,31 @@ std::vector<int> refine(MPI_Comm comm, const graph::AdjacencyList<T>& adj_graph)
 #ifdef HAS_PTSCOTCH
 graph::partition_fn graph::scotch::partitioner(graph::scotch::strategy strategy,
                                                double imbalance, int seed)
+{
+  return [partfn = weighted_partitioner(strategy, imbalance, seed)](
+             MPI_Comm comm, int nparts,
+             const AdjacencyList<std::int64_t>& graph, bool ghosting)
+  { return partfn(comm, nparts, graph, {}, ghosting); };
+}
+//-----------------------------------------------------------------------------
+graph::weighted_partition_fn
+graph::scotch::weighted_partitioner(graph::scotch::strategy strategy,
+                                    double imbalance, int seed)
 {
   return [imbalance, strategy, seed](MPI_Comm comm, int nparts,
                                      const AdjacencyList<std::int64_t>& graph,
+                                     const GraphWeights& weights,
                                      bool ghosting)
   {
     spdlog::info("Compute graph partition using PT-SCOTCH");
     common::Timer timer("Compute graph partition (SCOTCH)");
 
+    if (weights.num_constraints != 1)
+    {
+      throw std::runtime_error(
+          "SCOTCH does not support multiple balance constraints.");
+    }
+
     std::int64_t offset_global = 0;
     const std::int64_t num_owned = graph.num_nodes();
     MPI_Request request_offset_scan;
@@ -336,14 +408,10 @@ graph::partition_fn graph::scotch::partitioner(graph::scotch::strategy strategy,
     if (err != 0)
       throw std::runtime_error("Error initializing SCOTCH graph");
 
-    // FIXME: If the nodes have weights but this rank has no nodes, then
-    //        SCOTCH may deadlock since vload.data() will be nullptr on
-    //        this rank but not null on all other ranks.
-    // Handle node weights (disabled for now)
-    std::vector<SCOTCH_Num> node_weights;
-    std::vector<SCOTCH_Num> vload;
-    if (!node_weights.empty())
-      vload.assign(node_weights.begin(), node_weights.end());
+    // Node and edge weights. The weight arrays are non-null on all
+    // ranks if they are non-null on any rank, otherwise SCOTCH may
+    // deadlock.
+    auto [vload, eload] = copy_weights<SCOTCH_Num>(comm, graph, weights);
 
     // Set seed and reset SCOTCH random number generator to produce
     // deterministic partitions on repeated calls
@@ -355,8 +423,9 @@ graph::partition_fn graph::scotch::partitioner(graph::scotch::strategy strategy,
     common::Timer timer1("SCOTCH: call SCOTCH_dgraphBuild");
     err = SCOTCH_dgraphBuild(
         &dgrafdat, baseval, graph.num_nodes(), graph.num_nodes(),
-        vertloctab.data(), nullptr, vload.data(), nullptr, edgeloctab.size(),
-        edgeloctab.size(), edgeloctab.data(), nullptr, nullptr);
+        vertloctab.data(), nullptr, vload ? vload->data() : nullptr, nullptr,
+        edgeloctab.size(), edgeloctab.size(), edgeloctab.data(), nullptr,
+        eload ? eload->data() : nullptr);
     if (err != 0)
       throw std::runtime_error("Error building SCOTCH graph");
     timer1.stop();
@@ -512,10 +581,20 @@ graph::partition_fn graph::scotch::partitioner(graph::scotch::strategy strategy,
 #ifdef HAS_PARMETIS
 graph::partition_fn graph::parmetis::partitioner(double imbalance,
                                                  std::array<int, 3> options)
+{
+  return [partfn = weighted_partitioner(imbalance, options)](
+             MPI_Comm comm, int nparts,
+             const graph::AdjacencyList<std::int64_t>& graph, bool ghosting)
+  { return partfn(comm, nparts, graph, {}, ghosting); };
+}
+//-----------------------------------------------------------------------------
+graph::weighted_partition_fn
+graph::parmetis::weighted_partitioner(double imbalance,
+                                      std::array<int, 3> options)
 {
   return [imbalance, options](MPI_Comm comm, idx_t nparts,
                               const graph::AdjacencyList<std::int64_t>& graph,
-                              bool ghosting)
+                              const GraphWeights& weights, bool ghosting)
   {
     spdlog::info("Compute graph partition using ParMETIS");
     common::Timer timer("Compute graph partition (ParMETIS)");
@@ -527,6 +606,9 @@ graph::partition_fn graph::parmetis::partitioner(double imbalance,
           std::vector<std::int32_t>(graph.num_nodes(), 0), 1);
     }
 
+    // Node and edge weights (collective on comm)
+    auto [vwgt, adjwgt] = copy_weights<idx_t>(comm, graph, weights);
+
     // Note: ParMETIS fails (crashes) if a rank does not have any graph
     // data. Therefore we split the communicator such that ParMETIS
     // partitioning happens only on ranks that have data. Ideallt we
@@ -561,18 +643,19 @@ graph::partition_fn graph::parmetis::partitioner(double imbalance,
 
       // Options and data for ParMETIS
       std::array<idx_t, 3> opts = {options[0], options[1], options[2]};
-      idx_t ncon = 1;
-      idx_t* elmwgt = nullptr;
-      idx_t wgtflag(0), edgecut(0), numflag(0);
+      idx_t ncon = vwgt ? weights.num_constraints : 1;
+      idx_t wgtflag = (vwgt ? 2 : 0) + (adjwgt ? 1 : 0);
+      idx_t edgecut(0), numflag(0);
       std::vector<real_t> tpwgts(ncon * nparts,
                                  1.0 / static_cast<real_t>(nparts));
-      real_t ubvec = static_cast<real_t>(imbalance);
+      std::vector<real_t> ubvec(ncon, static_cast<real_t>(imbalance));
 
       // Partition
       common::Timer timer1("ParMETIS: call ParMETIS_V3_PartKway");
       int err = ParMETIS_V3_PartKway(
-          node_disp.data(), offsets.data(), array.data(), elmwgt, nullptr,
-          &wgtflag, &numflag, &ncon, &nparts, tpwgts.data(), &ubvec,
+          node_disp.data(), offsets.data(), array.data(),
+          vwgt ? vwgt->data() : nullptr, adjwgt ? adjwgt->data() : nullptr,
+          &wgtflag, &numflag, &ncon, &nparts, tpwgts.data(), ubvec.data(),
           opts.data(), &edgecut, part.data(), &pcomm);
       if (err != METIS_OK)
       {
@@ -609,9 +692,21 @@ graph::partition_fn graph::kahip::partitioner(int mode, int seed,
                                               double imbalance,
                                               bool suppress_output)
 {
-  return [mode, seed, imbalance, suppress_output](
+  return [partfn = weighted_partitioner(mode, seed, imbalance,
+                                        suppress_output)](
              MPI_Comm comm, int nparts,
              const graph::AdjacencyList<std::int64_t>& graph, bool ghosting)
+  { return partfn(comm, nparts, graph, {}, ghosting); };
+}
+//----------------------------------------------------------------------------
+graph::weighted_partition_fn
+graph::kahip::weighted_partitioner(int mode, int seed, double imbalance,
+                                   bool suppress_output)
+{
+  return [mode, seed, imbalance, suppress_output](
+             MPI_Comm comm, int nparts,
+             const graph::AdjacencyList<std::int64_t>& graph,
+             const GraphWeights& weights, bool ghosting)
   {
     spdlog::info("Compute graph partition using (parallel) KaHIP");
 
@@ -620,9 +715,15 @@ graph::partition_fn graph::kahip::partitioner(int mode, int seed,
 
     common::Timer timer("Compute graph partition (KaHIP)");
 
-    // Graph does not have vertex or adjacency weights, so we use null
-    // pointers as arguments
-    T *vwgt(nullptr), *adjcwgt(nullptr);
+    if (weights.num_constraints != 1)
+    {
+      throw std::runtime_error(
+          "KaHIP does not support multiple balance constraints.");
+    }
+
+    // Vertex and adjacency weights. Null pointers are passed if the
+    // graph is not weighted.
+    auto [vwgt, adjcwgt] = copy_weights<T>(comm, graph, weights);
 
     // Build adjacency list data
     common::Timer timer1("KaHIP: build adjacency data");
@@ -640,9 +741,11 @@ graph::partition_fn graph::kahip::partitioner(int mode, int seed,
     std::vector<T> part(graph.num_nodes());
     int edgecut = 0;
     double _imbalance = imbalance;
-    ParHIPPartitionKWay(node_disp.data(), offsets.data(), array.data(), vwgt,
-                        adjcwgt, &nparts, &_imbalance, suppress_output, seed,
-                        mode, &edgecut, part.data(), &comm);
+    ParHIPPartitionKWay(node_disp.data(), offsets.data(), array.data(),
+                        vwgt ? vwgt->data() : nullptr,
+                        adjcwgt ? adjcwgt->data() : nullptr, &nparts,
+                        &_imbalance, suppress_output, seed, mode, &edgecut,
+                        part.data(), &comm);
     timer2.stop();
 
     if (ghosting)
@@ -656,3 +759,185 @@ graph::partition_fn graph::kahip::partitioner(int mode, int seed,
 }
 //----------------------------------------------------------------------------
 #endif
+//-----------------------------------------------------------------------------
+graph::partition_fn
+graph::create_hierarchical_partitioner(const partition_fn& partfn,
+                                       int node_size)
+{
+  return [partfn, node_size](MPI_Comm comm, int nparts,
+                             const AdjacencyList<std::int64_t>& graph,
+                             bool ghosting) -> AdjacencyList<std::int32_t>
+  {
+    spdlog::info("Compute hierarchical graph partition");
+    common::Timer timer("Compute graph partition (hierarchical)");
+
+    const int rank = dolfinx::MPI::rank(comm);
+    const int size = dolfinx::MPI::size(comm);
+
+    // Create communicator for the ranks on the same compute node
+    MPI_Comm comm_node;
+    int err;
+    if (node_size > 0)
+      err = MPI_Comm_split(comm, rank / node_size, rank, &comm_node);
+    else
+    {
+      err = MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank,
+                                MPI_INFO_NULL, &comm_node);
+    }
+    dolfinx::MPI::check_error(comm, err);
+
+    // Number the compute nodes, and get the compute node of each rank
+    int node = 0;
+    {
+      int leader = dolfinx::MPI::rank(comm_node) == 0;
+      MPI_Exscan(&leader, &node, 1, MPI_INT, MPI_SUM, comm);
+      if (rank == 0)
+        node = 0;
+      MPI_Bcast(&node, 1, MPI_INT, 0, comm_node);
+    }
+    std::vector<int> rank_to_node(size);
+    MPI_Allgather(&node, 1, MPI_INT, rank_to_node.data(), 1, MPI_INT, comm);
+    const int num_nodes
+        = *std::max_element(rank_to_node.begin(), rank_to_node.end()) + 1;
+    if (nparts != size or num_nodes == 1 or num_nodes == size)
+    {
+      MPI_Comm_free(&comm_node);
+      return partfn(comm, nparts, graph, ghosting);
+    }
+
+    // Ranks on each compute node, in order of rank on the compute node
+    std::vector<std::vector<int>> node_to_ranks(num_nodes);
+    for (int r = 0; r < size; ++r)
+      node_to_ranks[rank_to_node[r]].push_back(r);
+
+    std::vector<std::int64_t> node_disp(size + 1, 0);
+    const std::int64_t num_owned = graph.num_nodes();
+    MPI_Allgather(&num_owned, 1, MPI_INT64_T, node_disp.data() + 1, 1,
+                  MPI_INT64_T, comm);
+    std::partial_sum(node_disp.begin(), node_disp.end(), node_disp.begin());
+
+    // Partition the graph into one part per rank, and assign a
+    // contiguous range of parts to each compute node, with as many
+    // parts as the compute node has ranks. This balances the first
+    // level even when the compute nodes have different numbers of
+    // ranks. The graph nodes of each part are sent to a rank of the
+    // compute node, with neighbouring graph nodes as ghosts.
+    std::vector<std::int64_t> dest0(graph.num_nodes());
+    {
+      std::vector<int> part_to_rank;
+      part_to_rank.reserve(size);
+      for (const std::vector<int>& ranks : node_to_ranks)
+        part_to_rank.insert(part_to_rank.end(), ranks.begin(), ranks.end());
+
+      const AdjacencyList<std::int32_t> part0
+          = partfn(comm, size, graph, false);
+      for (std::int32_t i = 0; i < graph.num_nodes(); ++i)
+        dest0[i] = part_to_rank[part0.links(i).front()];
+    }
+    const auto [graph1, src1, global_indices1, ghost_owners1]
+        = build::distribute(
+            comm, graph,
+            compute_destination_ranks(comm, graph, node_disp, dest0));
+
+    // Ghost graph nodes that are owned by a rank on this compute node
+    std::vector<std::int64_t> ghosts;
+    std::vector<int> ghost_owners;
+    {
+      MPI_Group group, group_node;
+      MPI_Comm_group(comm, &group);
+      MPI_Comm_group(comm_node, &group_node);
+      std::vector<int> owners_node(ghost_owners1.size());
+      MPI_Group_translate_ranks(group, ghost_owners1.size(),
+                                ghost_owners1.data(), group_node,
+                                owners_node.data());
+      MPI_Group_free(&group);
+      MPI_Group_free(&group_node);
+
+      const std::size_t num_owned1 = graph1.num_nodes() - ghost_owners1.size();
+      for (std::size_t i = 0; i < owners_node.size(); ++i)
+      {
+        if (owners_node[i] != MPI_UNDEFINED)
+        {
+          ghosts.push_back(global_indices1[num_owned1 + i]);
+          ghost_owners.push_back(owners_node[i]);
+        }
+      }
+    }
+
+    // Renumber the graph nodes on this compute node contiguously, and
+    // build the graph of the owned nodes without the edges to graph
+    // nodes on other compute nodes
+    const std::int32_t num_owned1 = graph1.num_nodes() - ghost_owners1.size();
+    std::span<const std::int64_t> owned1(global_indices1.data(), num_owned1);
+    const std::vector<std::int64_t> ghosts_new
+        = build::compute_ghost_indices(comm_node, owned1, ghosts,
+                                       ghost_owners);
+    std::int64_t offset = 0;
+    {
+      const std::int64_t num = num_owned1;
+      MPI_Exscan(&num, &offset, 1, MPI_INT64_T, MPI_SUM, comm_node);
+      if (dolfinx::MPI::rank(comm_node) == 0)
+        offset = 0;
+    }
+    std::vector<std::array<std::int64_t, 2>> old_to_new;
+    old_to_new.reserve(num_owned1 + ghosts.size());
+    for (std::int32_t i = 0; i < num_owned1; ++i)
+      old_to_new.push_back({owned1[i], offset + i});
+    for (std::size_t i = 0; i < ghosts.size(); ++i)
+      old_to_new.push_back({ghosts[i], ghosts_new[i]});
+    std::sort(old_to_new.begin(), old_to_new.end());
+
+    std::vector<std::int64_t> edges;
+    std::vector<std::int32_t> offsets = {0};
+    offsets.reserve(num_owned1 + 1);
+    for (std::int32_t i = 0; i < num_owned1; ++i)
+    {
+      for (std::int64_t e : graph1.links(i))
+      {
+        auto it = std::lower_bound(
+            old_to_new.begin(), old_to_new.end(), e,
+            [](auto& a, std::int64_t b) { return a[0] < b; });
+        if (it != old_to_new.end() and (*it)[0] == e)
+          edges.push_back((*it)[1]);
+      }
+      offsets.push_back(edges.size());
+    }
+
+    // Partition the graph nodes on this compute node across the ranks
+    // of the compute node
+    const AdjacencyList<std::int32_t> part1 = partfn(
+        comm_node, dolfinx::MPI::size(comm_node),
+        AdjacencyList<std::int64_t>(std::move(edges), std::move(offsets)),
+        false);
+    MPI_Comm_free(&comm_node);
+
+    // Send the destination rank of each graph node to the original
+    // owner (global index, destination)
+    std::vector<std::int64_t> dest1(graph.num_nodes(), -1);
+    {
+      const std::vector<int>& ranks = node_to_ranks[node];
+      std::vector<std::int64_t> send_data(2 * num_owned1);
+      for (std::int32_t i = 0; i < num_owned1; ++i)
+      {
+        send_data[2 * i] = global_indices1[i];
+        send_data[2 * i + 1] = ranks[part1.links(i).front()];
+      }
+      const std::vector<std::int64_t> recv_data
+          = dolfinx::MPI::send_rows<std::int64_t>(
+                comm, std::span(src1.data(), num_owned1), send_data, 2)
+                .first;
+      for (std::size_t i = 0; i < recv_data.size(); i += 2)
+        dest1[recv_data[i] - node_disp[rank]] = recv_data[i + 1];
+      assert(std::ranges::find(dest1, -1) == dest1.end());
+    }
+
+    if (ghosting)
+      return compute_destination_ranks(comm, graph, node_disp, dest1);
+    else
+    {
+      return regular_adjacency_list(
+          std::vector<std::int32_t>(dest1.begin(), dest1.end()), 1);
+    }
+  };
+}
+//-----------------------------------------------------------------------------
@@ -37,6 +37,20 @@ enum class strategy
 /// @return A graph partitioning function
 graph::partition_fn partitioner(scotch::strategy strategy = strategy::none,
                                 double imbalance = 0.025, int seed = 0);
+
+/// @brief Create a graph partitioning function that uses PT-SCOTCH
+/// and supports node and edge weights.
+///
+/// @note SCOTCH does not support multiple balance constraints.
+///
+/// @param[in] strategy The SCOTCH strategy
+/// @param[in] imbalance The allowable imbalance (between 0 and 1). The
+/// smaller value the more balanced the partitioning must be.
+/// @param[in] seed Random number generator seed
+/// @return A weighted graph partitioning function
+graph::weighted_partition_fn
+weighted_partitioner(scotch::strategy strategy = strategy::none,
+                     double imbalance = 0.025, int seed = 0);
 #endif
 
 } // namespace scotch
@@ -58,6 +72,17 @@ namespace parmetis
 graph::partition_fn partitioner(double imbalance = 1.02,
                                 std::array<int, 3> options = {1, 0, 5});
 
+/// @brief Create a graph partitioning function that uses ParMETIS and
+/// supports node and edge weights, and multiple balance constraints.
+///
+/// @param[in] imbalance Imbalance tolerance for each balance
+/// constraint. See ParMETIS manual for details.
+/// @param[in] options The ParMETIS option. See ParMETIS manual for
+/// details.
+graph::weighted_partition_fn
+weighted_partitioner(double imbalance = 1.02,
+                     std::array<int, 3> options = {1, 0, 5});
+
 #endif
 } // namespace parmetis
 
@@ -77,7 +102,51 @@ namespace kahip
 graph::partition_fn partitioner(int mode = 1, int seed = 1,
                                 double imbalance = 0.03,
                                 bool suppress_output = true);
+
+/// @brief Create a graph partitioning function that uses KaHIP and
+/// supports node and edge weights.
+///
+/// @note KaHIP does not support multiple balance constraints.
+///
+/// @param[in] mode The KaHiP partitioning mode
+/// @param[in] seed The KaHiP random number generator seed
+/// @param[in] imbalance The allowable imbalance
+/// @param[in] suppress_output Suppresses KaHIP output if true
+/// @return A weighted KaHIP graph partitioning function
+graph::weighted_partition_fn
+weighted_partitioner(int mode = 1, int seed = 1, double imbalance = 0.03,
+                     bool suppress_output = true);
 #endif
 } // namespace kahip
 
+/// @brief Create a graph partitioning function that partitions a
+/// graph across compute nodes, and then across the ranks of each
+/// compute node.
+///
+/// The graph is first partitioned into one part per rank, and each
+/// compute node is assigned a contiguous range of parts, with as many
+/// parts as it has ranks, so the compute nodes are balanced by their
+/// number of ranks. The nodes of each part are moved to a rank of the
+/// compute node, and the graph nodes of each compute node are then
+/// partitioned across its ranks, ignoring edges to other compute
+/// nodes. The second level balances the ranks of a compute node and
+/// reduces the edges between them; ghost exchange (see
+/// common::Scatterer) between ranks of a compute node uses shared
+/// memory.
+///
+/// Ranks are on the same compute node if they share memory, as
+/// determined by `MPI_Comm_split_type` with `MPI_COMM_TYPE_SHARED`.
+///
+/// @note If the number of parts differs from the size of the
+/// communicator, or if there is only one rank per compute node or only
+/// one compute node, `partfn` is used directly.
+///
+/// @param[in] partfn Graph partitioning function used at both levels.
+/// @param[in] node_size If positive, consecutive blocks of `node_size`
+/// ranks are treated as a compute node, in place of the ranks that
+/// share memory.
+/// @return A graph partitioning function.
+graph::partition_fn create_hierarchical_partitioner(const partition_fn& partfn,
+                                                    int node_size = -1);
+
 } // namespace dolfinx::graph
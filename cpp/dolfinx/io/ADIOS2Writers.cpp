@@ -8,6 +8,8 @@
 
 #include "ADIOS2Writers.h"
 #include "cells.h"
+#include <algorithm>
+#include <cctype>
 #include <pugixml.hpp>
 #include <string>
 #include <vector>
@@ -50,11 +52,32 @@ std::string to_fides_cell(mesh::CellType type)
 
 //-----------------------------------------------------------------------------
 ADIOS2Writer::ADIOS2Writer(MPI_Comm comm, const std::filesystem::path& filename,
-                           std::string tag, std::string engine)
+                           std::string tag, std::string engine,
+                           ADIOS2WriteMode mode)
     : _adios(std::make_unique<adios2::ADIOS>(comm)),
       _io(std::make_unique<adios2::IO>(_adios->DeclareIO(tag)))
 {
+  // Only BP5 supports asynchronous writing; other engines would
+  // silently write synchronously. ADIOS2 engine names are case
+  // insensitive.
+  std::string engine_lc = engine;
+  std::ranges::transform(engine_lc, engine_lc.begin(), [](unsigned char c)
+                         { return std::tolower(c); });
+  if (mode == ADIOS2WriteMode::async and engine_lc != "bp5")
+  {
+    throw std::runtime_error(
+        "Asynchronous ADIOS2 writing requires the BP5 engine.");
+  }
+
   _io->SetEngine(engine);
+
+  // All data is copied into the engine buffers by PerformPuts (or by
+  // synchronous Puts) before a step ends, so the caller is free to
+  // modify the mesh and functions once `write` returns while the
+  // engine drains the previous step to disk
+  if (mode == ADIOS2WriteMode::async)
+    _io->SetParameter("AsyncWrite", "true");
+
   _engine = std::make_unique<adios2::Engine>(
       _io->Open(filename, adios2::Mode::Write));
 }
@@ -8,6 +8,7 @@
 
 #ifdef HAS_ADIOS2
 
+#include "utils.h"
 #include "vtk_utils.h"
 #include <adios2.h>
 #include <basix/mdspan.hpp>
@@ -50,6 +51,16 @@ using U = std::vector<std::variant<
     std::shared_ptr<const fem::Function<std::complex<double>, T>>>>;
 } // namespace adios2_writer
 
+/// @brief Controls when the data for a step is written to disk by
+/// ADIOS2-based writers.
+enum class ADIOS2WriteMode
+{
+  sync, ///< Data for a step is written to disk before `write` returns
+  async ///< Data for a step is copied into the engine buffers and
+        ///< written to disk in the background while the next step is
+        ///< computed
+};
+
 /// Base class for ADIOS2-based writers
 class ADIOS2Writer
 {
@@ -60,8 +71,15 @@ protected:
   /// @param[in] tag The ADIOS2 object name
   /// @param[in] engine ADIOS2 engine type. See
   /// https://adios2.readthedocs.io/en/latest/engines/engines.html.
+  /// @param[in] mode Write mode. With ADIOS2WriteMode::async, each
+  /// step is buffered by the engine at `EndStep` and drained to disk by
+  /// an engine-owned thread. At most one step is in flight: the next
+  /// step (or `close`) waits until the previous step has been written.
+  /// Asynchronous writing requires the BP5 engine. An exception is
+  /// thrown if ADIOS2WriteMode::async is used with any other engine.
   ADIOS2Writer(MPI_Comm comm, const std::filesystem::path& filename,
-               std::string tag, std::string engine);
+               std::string tag, std::string engine,
+               ADIOS2WriteMode mode = ADIOS2WriteMode::sync);
 
   /// @brief Move constructor
   ADIOS2Writer(ADIOS2Writer&& writer) = default;
@@ -437,12 +455,17 @@ public:
   /// @param[in] mesh The mesh. The mesh must a degree 1 mesh.
   /// @param[in] engine ADIOS2 engine type. See
   /// https://adios2.readthedocs.io/en/latest/engines/engines.html.
+  /// @param[in] mode Controls if the data is written to disk before
+  /// `write` returns or in the background while the next step is
+  /// computed. ADIOS2WriteMode::async requires `engine` to be "BP5".
+  /// See ADIOS2WriteMode.
   /// @note The mesh geometry can be updated between write steps but the
   /// topology should not be changed between write steps.
   FidesWriter(MPI_Comm comm, const std::filesystem::path& filename,
               std::shared_ptr<const mesh::Mesh<T>> mesh,
-              std::string engine = "BPFile")
-      : ADIOS2Writer(comm, filename, "Fides mesh writer", engine),
+              std::string engine = "BPFile",
+              ADIOS2WriteMode mode = ADIOS2WriteMode::sync)
+      : ADIOS2Writer(comm, filename, "Fides mesh writer", engine, mode),
         _mesh_reuse_policy(FidesMeshPolicy::update), _mesh(mesh)
   {
     assert(_io);
@@ -468,10 +491,15 @@ public:
   /// @param[in] mesh_policy Controls if the mesh is written to file at
   /// the first time step only or is re-written (updated) at each time
   /// step.
+  /// @param[in] mode Controls if the data is written to disk before
+  /// `write` returns or in the background while the next step is
+  /// computed. ADIOS2WriteMode::async requires `engine` to be "BP5".
+  /// See ADIOS2WriteMode.
   FidesWriter(MPI_Comm comm, const std::filesystem::path& filename,
               const typename adios2_writer::U<T>& u, std::string engine,
-              const FidesMeshPolicy mesh_policy = FidesMeshPolicy::update)
-      : ADIOS2Writer(comm, filename, "Fides function writer", engine),
+              const FidesMeshPolicy mesh_policy = FidesMeshPolicy::update,
+              ADIOS2WriteMode mode = ADIOS2WriteMode::sync)
+      : ADIOS2Writer(comm, filename, "Fides function writer", engine, mode),
         _mesh_reuse_policy(mesh_policy),
         _mesh(impl_adios2::extract_common_mesh<T>(u)), _u(u)
   {
@@ -872,13 +900,8 @@ vtx_write_mesh_from_space(adios2::IO& io, adios2::Engine& engine,
 }
 } // namespace impl_vtx
 
-/// Mesh reuse policy
-enum class VTXMeshPolicy
-{
-  update, ///< Re-write the mesh to file upon every write of a fem::Function
-  reuse   ///< Write the mesh to file only the first time a fem::Function is
-          ///< written to file
-};
+/// Mesh reuse policy for VTXWriter
+using VTXMeshPolicy = MeshPolicy;
 
 /// @brief Writer for meshes and functions using the ADIOS2 VTX format,
 /// see
@@ -897,13 +920,19 @@ public:
   /// @param[in] filename Name of output file.
   /// @param[in] mesh Mesh to write.
   /// @param[in] engine ADIOS2 engine type.
+  /// @param[in] mode Controls if the data is written to disk before
+  /// `write` returns or in the background while the next step is
+  /// computed. ADIOS2WriteMode::async requires `engine` to be "BP5".
+  /// See ADIOS2WriteMode.
   /// @note This format supports arbitrary degree meshes.
   /// @note The mesh geometry can be updated between write steps but the
   /// topology should not be changed between write steps.
   VTXWriter(MPI_Comm comm, const std::filesystem::path& filename,
             std::shared_ptr<const mesh::Mesh<T>> mesh,
-            std::string engine = "BPFile")
-      : ADIOS2Writer(comm, filename, "VTX mesh writer", engine), _mesh(mesh),
+            std::string engine = "BPFile",
+            ADIOS2WriteMode mode = ADIOS2WriteMode::sync)
+      : ADIOS2Writer(comm, filename, "VTX mesh writer", engine, mode),
+        _mesh(mesh),
         _mesh_reuse_policy(VTXMeshPolicy::update), _is_piecewise_constant(false)
   {
     // Define VTK scheme attribute for mesh
@@ -925,11 +954,16 @@ public:
   /// @param[in] mesh_policy Controls if the mesh is written to file at
   /// the first time step only or is re-written (updated) at each time
   /// step.
+  /// @param[in] mode Controls if the data is written to disk before
+  /// `write` returns or in the background while the next step is
+  /// computed. ADIOS2WriteMode::async requires `engine` to be "BP5".
+  /// See ADIOS2WriteMode.
   /// @note This format supports arbitrary degree meshes.
   VTXWriter(MPI_Comm comm, const std::filesystem::path& filename,
             const typename adios2_writer::U<T>& u, std::string engine,
-            VTXMeshPolicy mesh_policy = VTXMeshPolicy::update)
-      : ADIOS2Writer(comm, filename, "VTX function writer", engine),
+            VTXMeshPolicy mesh_policy = VTXMeshPolicy::update,
+            ADIOS2WriteMode mode = ADIOS2WriteMode::sync)
+      : ADIOS2Writer(comm, filename, "VTX function writer", engine, mode),
         _mesh(impl_adios2::extract_common_mesh<T>(u)),
         _mesh_reuse_policy(mesh_policy), _u(u), _is_piecewise_constant(false)
   {
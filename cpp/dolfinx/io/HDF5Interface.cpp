@@ -6,6 +6,14 @@
 
 #include "HDF5Interface.h"
 #include <filesystem>
+#include <utility>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#define DOLFINX_HDF5_MMAP
+#endif
 
 using namespace dolfinx;
 
@@ -53,7 +61,8 @@ bool has_group(hid_t handle, const std::string& group_name)
 
 //-----------------------------------------------------------------------------
 hid_t io::hdf5::open_file(MPI_Comm comm, const std::filesystem::path& filename,
-                          const std::string& mode, bool use_mpi_io)
+                          const std::string& mode, bool use_mpi_io,
+                          const Options& options)
 {
   // Set parallel access with communicator
   const hid_t plist_id = H5Pcreate(H5P_FILE_ACCESS);
@@ -62,11 +71,27 @@ hid_t io::hdf5::open_file(MPI_Comm comm, const std::filesystem::path& filename,
   {
     MPI_Info info;
     MPI_Info_create(&info);
+    if (options.aggregators > 0)
+    {
+      // Collective buffering with a fixed number of aggregators
+      MPI_Info_set(info, "romio_cb_write", "enable");
+      MPI_Info_set(info, "romio_cb_read", "enable");
+      MPI_Info_set(info, "cb_nodes",
+                   std::to_string(options.aggregators).c_str());
+    }
     if (H5Pset_fapl_mpio(plist_id, comm, info) < 0)
       throw std::runtime_error("Call to H5Pset_fapl_mpio unsuccessful");
     MPI_Info_free(&info);
   }
 
+  if (options.alignment > 0
+      and H5Pset_alignment(plist_id, options.alignment_threshold,
+                           options.alignment)
+              < 0)
+  {
+    throw std::runtime_error("Call to H5Pset_alignment unsuccessful");
+  }
+
   hid_t file_id = -1;
   if (mode == "w") // Create file for write, overwriting any existing file
   {
@@ -206,6 +231,17 @@ io::hdf5::get_dataset_shape(hid_t handle, const std::string& dataset_path)
   if (dset_id < 0)
     throw std::runtime_error("Failed to open HDF5 dataset by name");
 
+  std::vector<std::int64_t> shape = get_dataset_shape(dset_id);
+
+  // Close dataset
+  if (H5Dclose(dset_id) < 0)
+    throw std::runtime_error("Call to H5Dclose unsuccessful");
+
+  return shape;
+}
+//-----------------------------------------------------------------------------
+std::vector<std::int64_t> io::hdf5::get_dataset_shape(hid_t dset_id)
+{
   const hid_t space = H5Dget_space(dset_id);
   if (space < 0)
     throw std::runtime_error("Failed to get dataspace of dataset");
@@ -222,15 +258,133 @@ io::hdf5::get_dataset_shape(hid_t handle, const std::string& dataset_path)
     throw std::runtime_error("Failed to get dimensionality of dataspace");
   assert(ndims == rank);
 
-  // Close dataspace and dataset
+  // Close dataspace
   if (H5Sclose(space) < 0)
     throw std::runtime_error("Call to H5Sclose unsuccessful");
-  if (H5Dclose(dset_id) < 0)
-    throw std::runtime_error("Call to H5Dclose unsuccessful");
 
   return std::vector<std::int64_t>(size.begin(), size.end());
 }
 //-----------------------------------------------------------------------------
+bool io::hdf5::is_mappable(hid_t dset_id)
+{
+#ifdef DOLFINX_HDF5_MMAP
+  // File must be read-only and accessed through a single file driver
+  const hid_t file_id = H5Iget_file_id(dset_id);
+  if (file_id < 0)
+    throw std::runtime_error("Failed to get HDF5 file of dataset.");
+  unsigned intent = 0;
+  if (H5Fget_intent(file_id, &intent) < 0)
+    throw std::runtime_error("Failed to get HDF5 file intent.");
+  const hid_t fapl_id = H5Fget_access_plist(file_id);
+  const hid_t driver = H5Pget_driver(fapl_id);
+  H5Pclose(fapl_id);
+  H5Fclose(file_id);
+  bool single_file = driver == H5FD_SEC2;
+#ifdef H5_HAVE_PARALLEL
+  single_file = single_file or driver == H5FD_MPIO;
+#endif
+  if (!single_file or (intent & H5F_ACC_RDWR))
+    return false;
+
+  // Data must be stored contiguously (no chunks or filters), with a
+  // file address
+  const hid_t dcpl_id = H5Dget_create_plist(dset_id);
+  if (dcpl_id < 0)
+    throw std::runtime_error("Failed to get HDF5 dataset creation plist.");
+  const H5D_layout_t layout = H5Pget_layout(dcpl_id);
+  const int num_external = H5Pget_external_count(dcpl_id);
+  H5Pclose(dcpl_id);
+  if (layout != H5D_CONTIGUOUS or num_external > 0
+      or H5Dget_offset(dset_id) == HADDR_UNDEF)
+  {
+    return false;
+  }
+
+  // Storage type must be a native type
+  const hid_t dtype = H5Dget_type(dset_id);
+  const H5T_class_t tclass = H5Tget_class(dtype);
+  const hid_t ntype = H5Tget_native_type(dtype, H5T_DIR_DEFAULT);
+  const htri_t native = H5Tequal(dtype, ntype);
+  H5Tclose(ntype);
+  H5Tclose(dtype);
+  return (tclass == H5T_INTEGER or tclass == H5T_FLOAT) and native > 0;
+#else
+  return false;
+#endif
+}
+//-----------------------------------------------------------------------------
+io::hdf5::MappedDataset::MappedDataset(hid_t dset_id)
+    : _addr(nullptr), _length(0), _offset(0), _size(0),
+      _dtype(H5I_INVALID_HID), _shape(get_dataset_shape(dset_id))
+{
+#ifdef DOLFINX_HDF5_MMAP
+  if (!is_mappable(dset_id))
+    throw std::runtime_error("HDF5 dataset cannot be memory mapped.");
+
+  _dtype = H5Dget_type(dset_id);
+  _size = H5Dget_storage_size(dset_id);
+  if (_size == 0)
+    return;
+
+  // Map from the start of the page that holds the first value
+  const haddr_t address = H5Dget_offset(dset_id);
+  const std::size_t page_size = sysconf(_SC_PAGESIZE);
+  _offset = address % page_size;
+  _length = _offset + _size;
+
+  const hid_t file_id = H5Iget_file_id(dset_id);
+  const std::filesystem::path filename = get_filename(file_id);
+  H5Fclose(file_id);
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw std::runtime_error("Failed to open file for memory mapping.");
+  _addr = ::mmap(nullptr, _length, PROT_READ, MAP_PRIVATE, fd,
+                 address - _offset);
+  ::close(fd);
+  if (_addr == MAP_FAILED)
+  {
+    _addr = nullptr;
+    throw std::runtime_error("Failed to memory map HDF5 dataset.");
+  }
+
+  // Data is typically read once from the start to the end
+  ::madvise(_addr, _length, MADV_SEQUENTIAL);
+#else
+  throw std::runtime_error("Memory mapping is not supported on this system.");
+#endif
+}
+//-----------------------------------------------------------------------------
+io::hdf5::MappedDataset::MappedDataset(MappedDataset&& m) noexcept
+    : _addr(std::exchange(m._addr, nullptr)),
+      _length(std::exchange(m._length, 0)), _offset(m._offset),
+      _size(std::exchange(m._size, 0)),
+      _dtype(std::exchange(m._dtype, H5I_INVALID_HID)),
+      _shape(std::move(m._shape))
+{
+}
+//-----------------------------------------------------------------------------
+io::hdf5::MappedDataset::~MappedDataset()
+{
+#ifdef DOLFINX_HDF5_MMAP
+  if (_addr)
+    ::munmap(_addr, _length);
+#endif
+  if (_dtype != H5I_INVALID_HID)
+    H5Tclose(_dtype);
+}
+//-----------------------------------------------------------------------------
+io::hdf5::MappedDataset&
+io::hdf5::MappedDataset::operator=(MappedDataset&& m) noexcept
+{
+  std::swap(_addr, m._addr);
+  std::swap(_length, m._length);
+  std::swap(_offset, m._offset);
+  std::swap(_size, m._size);
+  std::swap(_dtype, m._dtype);
+  std::swap(_shape, m._shape);
+  return *this;
+}
+//-----------------------------------------------------------------------------
 void io::hdf5::set_mpi_atomicity(hid_t handle, bool atomic)
 {
   if (H5Fset_mpi_atomicity(handle, atomic) < 0)
@@ -6,20 +6,59 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <chrono>
 #include <cstdint>
 #include <dolfinx/common/log.h>
 #include <filesystem>
+#include <functional>
 #include <hdf5.h>
 #include <mpi.h>
 #include <numeric>
+#include <span>
 #include <string>
 #include <vector>
 
 namespace dolfinx::io::hdf5
 {
+/// @brief Options for the layout and transfer of HDF5 data in
+/// parallel.
+///
+/// The file options (alignment and aggregators) are applied when a
+/// file is opened, and the dataset options when a dataset is written.
+struct Options
+{
+  /// Use collective MPI-IO data transfers. If false, independent
+  /// transfers are used.
+  bool collective = true;
+
+  /// Target size in bytes of dataset chunks, e.g. the stripe size of a
+  /// Lustre file system. A chunk holds a whole number of rows. If zero,
+  /// datasets are stored contiguously unless a filter is requested.
+  std::size_t chunk_bytes = 0;
+
+  /// Deflate (gzip) compression level in [1, 9], or zero for no
+  /// compression.
+  int deflate_level = 0;
+
+  /// Use the SZIP compression filter.
+  bool szip = false;
+
+  /// Alignment in bytes of file objects that are larger than
+  /// `alignment_threshold`, e.g. the stripe size of a Lustre file
+  /// system. If zero, the HDF5 default is used.
+  std::size_t alignment = 0;
+
+  /// Minimum size in bytes of file objects that are aligned.
+  std::size_t alignment_threshold = 0;
+
+  /// Number of processes that aggregate data for collective MPI-IO
+  /// transfers (the ROMIO `cb_nodes` hint). If zero, the MPI-IO default
+  /// is used.
+  int aggregators = 0;
+};
 
 /// C++ type to HDF5 data type
 template <typename T>
@@ -55,8 +94,10 @@ hid_t hdf5_type()
 /// @param[in] filename Name of the HDF5 file to open
 /// @param[in] mode Mode in which to open the file (w, r, a)
 /// @param[in] use_mpi_io True if MPI-IO should be used
+/// @param[in] options File alignment and MPI-IO aggregation options
 hid_t open_file(MPI_Comm comm, const std::filesystem::path& filename,
-                const std::string& mode, bool use_mpi_io);
+                const std::string& mode, bool use_mpi_io,
+                const Options& options = {});
 
 /// Close HDF5 file
 /// @param[in] handle HDF5 file handle
@@ -90,6 +131,90 @@ hid_t open_dataset(hid_t handle, const std::string& path);
 std::vector<std::int64_t> get_dataset_shape(hid_t handle,
                                             const std::string& dataset_path);
 
+/// Get dataset shape (size of each dimension)
+/// @param[in] dset_id HDF5 dataset handle
+/// @return The shape of the dataset (row-major)
+std::vector<std::int64_t> get_dataset_shape(hid_t dset_id);
+
+/// @brief Check if a dataset can be memory mapped.
+///
+/// A dataset can be mapped if it is stored contiguously and
+/// uncompressed in a file that is opened read-only, and if the storage
+/// type is a native type.
+/// @param[in] dset_id HDF5 dataset handle
+/// @return True if the dataset can be mapped by MappedDataset
+bool is_mappable(hid_t dset_id);
+
+/// @brief Read-only memory map of a contiguous HDF5 dataset.
+///
+/// The data is accessed directly from the operating system page cache,
+/// without copying into an intermediate buffer. Mapping is intended
+/// for serial or small process count reading of large datasets, e.g.
+/// meshes for pre- and post-processing. The file must not be modified
+/// while a map exists.
+class MappedDataset
+{
+public:
+  /// @brief Map a dataset.
+  /// @param[in] dset_id HDF5 dataset handle. The dataset must satisfy
+  /// is_mappable.
+  explicit MappedDataset(hid_t dset_id);
+
+  /// Copy constructor
+  MappedDataset(const MappedDataset&) = delete;
+
+  /// Move constructor
+  MappedDataset(MappedDataset&& m) noexcept;
+
+  /// Destructor (unmaps the data)
+  ~MappedDataset();
+
+  /// Copy assignment
+  MappedDataset& operator=(const MappedDataset&) = delete;
+
+  /// Move assignment
+  MappedDataset& operator=(MappedDataset&& m) noexcept;
+
+  /// @brief Check if the dataset storage type is `T`.
+  template <typename T>
+  bool has_type() const
+  {
+    htri_t eq = H5Tequal(_dtype, hdf5::hdf5_type<T>());
+    if (eq < 0)
+      throw std::runtime_error("HDF5 datatype equality test failed.");
+    return eq > 0;
+  }
+
+  /// @brief Mapped dataset values (row-major).
+  /// @tparam T Value type. Must be the dataset storage type.
+  template <typename T>
+  std::span<const T> values() const
+  {
+    if (!has_type<T>())
+      throw std::runtime_error("Wrong type for mapped HDF5 dataset.");
+    return std::span<const T>(
+        reinterpret_cast<const T*>(static_cast<const char*>(_addr) + _offset),
+        _size / sizeof(T));
+  }
+
+  /// @brief Dataset shape.
+  const std::vector<std::int64_t>& shape() const { return _shape; }
+
+private:
+  // Start of mapped (page aligned) memory and mapped length
+  void* _addr;
+  std::size_t _length;
+
+  // Offset of data from _addr and size in bytes of the data
+  std::size_t _offset, _size;
+
+  // Storage type
+  hid_t _dtype;
+
+  // Dataset shape
+  std::vector<std::int64_t> _shape;
+};
+
 /// Set MPI atomicity. See
 /// https://support.hdfgroup.org/HDF5/doc/RM/RM_H5F.html#File-SetMpiAtomicity
 /// and
@@ -118,12 +243,13 @@ void add_group(hid_t handle, const std::string& dataset_path);
 /// @param[in] range The local range on this processor
 /// @param[in] global_size The global shape shape of the array
 /// @param[in] use_mpi_io True if MPI-IO should be used
-/// @param[in] use_chunking True if chunking should be used
+/// @param[in] options Chunking, filter and data transfer options. When
+/// MPI-IO is used, filters require collective transfers.
 template <typename T>
 void write_dataset(hid_t file_handle, const std::string& dataset_path,
                    const T* data, std::array<std::int64_t, 2> range,
                    const std::vector<int64_t>& global_size, bool use_mpi_io,
-                   bool use_chunking)
+                   const Options& options = {})
 {
   // Data rank
   const int rank = global_size.size();
@@ -153,23 +279,47 @@ void write_dataset(hid_t file_handle, const std::string& dataset_path,
   if (filespace0 == H5I_INVALID_HID)
     throw std::runtime_error("Failed to create HDF5 data space");
 
-  // Set chunking parameters
-  hid_t chunking_properties;
+  // Set chunking and filter parameters. Chunks cannot be larger than
+  // the (fixed size) dataset, so empty datasets are not chunked.
+  const bool use_filters = options.deflate_level > 0 or options.szip;
+  const bool use_chunking
+      = (options.chunk_bytes > 0 or use_filters) and dimsf[0] > 0;
+  hid_t chunking_properties = H5P_DEFAULT;
   if (use_chunking)
   {
-    // Set chunk size and limit to 1kB min/1MB max
-    hsize_t chunk_size = dimsf[0] / 2;
-    if (chunk_size > 1048576)
-      chunk_size = 1048576;
-    if (chunk_size < 1024)
-      chunk_size = 1024;
-
-    hsize_t chunk_dims[2] = {chunk_size, dimsf[1]};
+    if (use_mpi_io and use_filters and !options.collective)
+    {
+      throw std::runtime_error(
+          "Parallel HDF5 filters require collective data transfers.");
+    }
+
+    // Whole rows in a chunk of (approximately) the target size. Use
+    // 1MB chunks if only filters are requested.
+    const std::size_t row_bytes
+        = sizeof(T)
+          * std::reduce(std::next(dimsf.begin()), dimsf.end(), hsize_t(1),
+                        std::multiplies{});
+    const std::size_t chunk_bytes
+        = options.chunk_bytes > 0 ? options.chunk_bytes : 1048576;
+    std::vector<hsize_t> chunk_dims = dimsf;
+    chunk_dims[0] = std::clamp<hsize_t>(chunk_bytes / row_bytes, 1, dimsf[0]);
+
     chunking_properties = H5Pcreate(H5P_DATASET_CREATE);
-    H5Pset_chunk(chunking_properties, rank, chunk_dims);
+    if (H5Pset_chunk(chunking_properties, rank, chunk_dims.data()) < 0)
+      throw std::runtime_error("Failed to set HDF5 chunk size.");
+    if (options.szip)
+    {
+      if (H5Zfilter_avail(H5Z_FILTER_SZIP) <= 0)
+        throw std::runtime_error("HDF5 SZIP filter is not available.");
+      if (H5Pset_szip(chunking_properties, H5_SZIP_NN_OPTION_MASK, 16) < 0)
+        throw std::runtime_error("Failed to set HDF5 SZIP filter.");
+    }
+    if (options.deflate_level > 0
+        and H5Pset_deflate(chunking_properties, options.deflate_level) < 0)
+    {
+      throw std::runtime_error("Failed to set HDF5 deflate filter.");
+    }
   }
-  else
-    chunking_properties = H5P_DEFAULT;
 
   // Check that group exists and recursively create if required
   const std::string group_name(dataset_path, 0, dataset_path.rfind('/'));
@@ -202,7 +352,9 @@ void write_dataset(hid_t file_handle, const std::string& dataset_path,
   const hid_t plist_id = H5Pcreate(H5P_DATASET_XFER);
   if (use_mpi_io)
   {
-    if (herr_t status = H5Pset_dxpl_mpio(plist_id, H5FD_MPIO_COLLECTIVE);
+    if (herr_t status = H5Pset_dxpl_mpio(
+            plist_id, options.collective ? H5FD_MPIO_COLLECTIVE
+                                         : H5FD_MPIO_INDEPENDENT);
         status < 0)
     {
       throw std::runtime_error(
@@ -241,18 +393,21 @@ void write_dataset(hid_t file_handle, const std::string& dataset_path,
     throw std::runtime_error("Failed to release HDF5 file-access template.");
 }
 
-/// Read data from a HDF5 dataset "dataset_path" as defined by range blocks on
-/// each process.
+/// Read data from a HDF5 dataset "dataset_path" as defined by range
+/// blocks on each process into a caller provided array.
 ///
 /// @tparam T The data type to read into.
 /// @param[in] dset_id HDF5 file handle.
 /// @param[in] range The local range on this processor.
+/// @param[out] data Array to read into (row-major storage). Its size
+/// must equal the number of values in the range.
 /// @param[in] allow_cast If true, allow casting from HDF5 type to type `T`.
-/// @return Flattened 1D array of values. If range = {-1, -1}, then all data
-/// is read on this process.
+/// @param[in] collective If true, use a collective MPI-IO data transfer.
+/// All processes of the file communicator must then call this function.
+/// Has no effect if the file is not opened with MPI-IO.
 template <typename T>
-std::vector<T> read_dataset(hid_t dset_id, std::array<std::int64_t, 2> range,
-                            bool allow_cast)
+void read_dataset(hid_t dset_id, std::array<std::int64_t, 2> range,
+                  std::span<T> data, bool allow_cast, bool collective = false)
 {
   auto timer_start = std::chrono::system_clock::now();
 
@@ -321,19 +476,32 @@ std::vector<T> read_dataset(hid_t dset_id, std::array<std::int64_t, 2> range,
   if (memspace == H5I_INVALID_HID)
     throw std::runtime_error("Failed to create HDF5 dataspace.");
 
-  // Create local data to read into
-  std::vector<T> data(
-      std::reduce(count.begin(), count.end(), 1, std::multiplies{}));
+  // Check size of local data to read into
+  if (data.size()
+      != std::reduce(count.begin(), count.end(), hsize_t(1),
+                     std::multiplies{}))
+  {
+    throw std::runtime_error("Array size does not match HDF5 data range.");
+  }
+
+  // Set parallel access
+  const hid_t plist_id = H5Pcreate(H5P_DATASET_XFER);
+  if (collective and H5Pset_dxpl_mpio(plist_id, H5FD_MPIO_COLLECTIVE) < 0)
+    throw std::runtime_error("Failed to set HDF5 data transfer property list.");
 
   // Read data on each process
   hid_t h5type = hdf5::hdf5_type<T>();
   if (herr_t status
-      = H5Dread(dset_id, h5type, memspace, dataspace, H5P_DEFAULT, data.data());
+      = H5Dread(dset_id, h5type, memspace, dataspace, plist_id, data.data());
       status < 0)
   {
     throw std::runtime_error("Failed to read HDF5 data.");
   }
 
+  // Release data transfer property list
+  if (H5Pclose(plist_id) < 0)
+    throw std::runtime_error("Failed to release HDF5 data transfer template.");
+
   // Close dataspace
   if (herr_t status = H5Sclose(dataspace); status < 0)
     throw std::runtime_error("Failed to close HDF5 dataspace.");
@@ -346,7 +514,32 @@ std::vector<T> read_dataset(hid_t dset_id, std::array<std::int64_t, 2> range,
   std::chrono::duration<double> dt = (timer_end - timer_start);
   double data_rate = data.size() * sizeof(T) / (1e6 * dt.count());
   spdlog::info("HDF5 Read data rate: {} MB/s", data_rate);
+}
 
+/// Read data from a HDF5 dataset "dataset_path" as defined by range blocks on
+/// each process.
+///
+/// @tparam T The data type to read into.
+/// @param[in] dset_id HDF5 file handle.
+/// @param[in] range The local range on this processor.
+/// @param[in] allow_cast If true, allow casting from HDF5 type to type `T`.
+/// @param[in] collective If true, use a collective MPI-IO data transfer.
+/// All processes of the file communicator must then call this function.
+/// Has no effect if the file is not opened with MPI-IO.
+/// @return Flattened 1D array of values. If range = {-1, -1}, then all data
+/// is read on this process.
+template <typename T>
+std::vector<T> read_dataset(hid_t dset_id, std::array<std::int64_t, 2> range,
+                            bool allow_cast, bool collective = false)
+{
+  std::vector<std::int64_t> shape = get_dataset_shape(dset_id);
+  if (shape.empty())
+    throw std::runtime_error("Failed to get rank of data space.");
+  if (range[0] != -1 and range[1] != -1)
+    shape.front() = range[1] - range[0];
+  std::vector<T> data(std::reduce(shape.begin(), shape.end(), std::int64_t(1),
+                                  std::multiplies{}));
+  read_dataset(dset_id, range, std::span<T>(data), allow_cast, collective);
   return data;
 }
 } // namespace dolfinx::io::hdf5
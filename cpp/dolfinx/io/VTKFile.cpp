@@ -18,12 +18,26 @@
 #include <dolfinx/mesh/Geometry.h>
 #include <dolfinx/mesh/Mesh.h>
 #include <dolfinx/mesh/Topology.h>
+#include <bit>
+#include <cstring>
 #include <filesystem>
+#include <fstream>
 #include <iterator>
+#include <numeric>
 #include <pugixml.hpp>
 #include <span>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <type_traits>
+
+#ifdef HAS_LZ4
+#include <lz4.h>
+#endif
+
+#ifdef HAS_ZLIB
+#include <zlib.h>
+#endif
 
 using namespace dolfinx;
 
@@ -62,11 +76,260 @@ std::stringstream container_to_string(const T& x, int precision)
 {
   std::stringstream s;
   s.precision(precision);
-  std::for_each(x.begin(), x.end(), [&s](auto e) { s << e << " "; });
+  std::for_each(x.begin(), x.end(), [&s](auto e) { s << +e << " "; });
   return s;
 }
 //----------------------------------------------------------------------------
 
+/// Append the base64 encoding of a byte array to a string
+void base64_encode(std::span<const unsigned char> in, std::vector<char>& out)
+{
+  constexpr std::string_view table
+      = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::size_t i = 0;
+  for (; i + 2 < in.size(); i += 3)
+  {
+    std::uint32_t b = (in[i] << 16) | (in[i + 1] << 8) | in[i + 2];
+    out.insert(out.end(), {table[(b >> 18) & 63], table[(b >> 12) & 63],
+                           table[(b >> 6) & 63], table[b & 63]});
+  }
+
+  if (std::size_t r = in.size() - i; r > 0)
+  {
+    std::uint32_t b = in[i] << 16;
+    if (r == 2)
+      b |= in[i + 1] << 8;
+    out.insert(out.end(), {table[(b >> 18) & 63], table[(b >> 12) & 63],
+                           r == 2 ? table[(b >> 6) & 63] : '=', '='});
+  }
+}
+//----------------------------------------------------------------------------
+
+/// @brief Data arrays of a VTU file.
+///
+/// With ASCII encoding the data is added as text to the XML tree. With
+/// the other encodings the encoded data is appended to a byte buffer
+/// and the XML tree holds only the offset of each array in the buffer.
+/// The buffer is streamed to the file after the XML tree, in the
+/// `AppendedData` section. Each array is preceded by a header with the
+/// (compressed) size of the data, see
+/// https://docs.vtk.org/en/latest/design_documents/VTKFileFormats.html.
+class VTUData
+{
+public:
+  /// Create storage for data arrays with the given encoding
+  explicit VTUData(io::VTKFile::Encoding encoding) : _encoding(encoding)
+  {
+    assert(io::VTKFile::has_encoding(encoding));
+  }
+
+  /// Set the attributes of the root `VTKFile` node that describe the
+  /// binary data layout
+  void set_file_attributes(pugi::xml_node& node) const
+  {
+    if (_encoding == io::VTKFile::Encoding::ascii)
+      return;
+
+    node.append_attribute("byte_order")
+        = std::endian::native == std::endian::little ? "LittleEndian"
+                                                     : "BigEndian";
+    node.append_attribute("header_type") = "UInt64";
+    if (_encoding == io::VTKFile::Encoding::zlib)
+      node.append_attribute("compressor") = "vtkZLibDataCompressor";
+    else if (_encoding == io::VTKFile::Encoding::lz4)
+      node.append_attribute("compressor") = "vtkLZ4DataCompressor";
+  }
+
+  /// @brief Add the values of a data array to a `DataArray` node.
+  /// @tparam T Type of the data in the file, which must match the
+  /// `type` attribute of the node.
+  /// @param[in,out] node The `DataArray` node.
+  /// @param[in] values The data values. For binary encodings, the
+  /// values are converted to `T`.
+  template <typename T, typename U>
+  void add(pugi::xml_node& node, std::span<const U> values)
+  {
+    if (_encoding == io::VTKFile::Encoding::ascii)
+    {
+      node.append_attribute("format") = "ascii";
+      node.append_child(pugi::node_pcdata)
+          .set_value(container_to_string(values, 16).str().c_str());
+      return;
+    }
+
+    node.append_attribute("format") = "appended";
+    node.append_attribute("offset") = _data.size();
+
+    std::vector<T> v;
+    std::span<const T> data;
+    if constexpr (std::is_same_v<T, U>)
+      data = values;
+    else
+    {
+      v.assign(values.begin(), values.end());
+      data = v;
+    }
+
+    std::span<const unsigned char> bytes(
+        reinterpret_cast<const unsigned char*>(data.data()),
+        data.size_bytes());
+    switch (_encoding)
+    {
+    case io::VTKFile::Encoding::binary:
+      append_raw(std::uint64_t(bytes.size()));
+      _data.insert(_data.end(), bytes.begin(), bytes.end());
+      break;
+    case io::VTKFile::Encoding::base64:
+    {
+      // Header and data are encoded as one stream
+      std::vector<unsigned char> buffer(sizeof(std::uint64_t) + bytes.size());
+      std::uint64_t size = bytes.size();
+      std::memcpy(buffer.data(), &size, sizeof(size));
+      std::copy(bytes.begin(), bytes.end(),
+                std::next(buffer.begin(), sizeof(size)));
+      base64_encode(buffer, _data);
+      break;
+    }
+    case io::VTKFile::Encoding::zlib:
+    case io::VTKFile::Encoding::lz4:
+      append_compressed(bytes);
+      break;
+    default:
+      throw std::runtime_error("Unknown VTK encoding");
+    }
+  }
+
+  /// @brief Save an XML tree and the appended data to file.
+  void save(const pugi::xml_document& doc,
+            const std::filesystem::path& filename) const
+  {
+    if (filename.has_parent_path())
+      std::filesystem::create_directories(filename.parent_path());
+    std::ofstream file(filename, std::ios::binary);
+    if (!file)
+      throw std::runtime_error("Could not open file: " + filename.string());
+
+    if (_encoding == io::VTKFile::Encoding::ascii)
+    {
+      doc.save(file, "  ");
+      return;
+    }
+
+    // The XML tree holds no data, so is cheap to serialise. Insert the
+    // appended data before the closing tag of the root node.
+    std::stringstream ss;
+    doc.save(ss, "  ");
+    const std::string xml = ss.str();
+    const std::size_t pos = xml.rfind("</VTKFile>");
+    assert(pos != std::string::npos);
+    file.write(xml.data(), pos);
+    file << "  <AppendedData encoding=\""
+         << (_encoding == io::VTKFile::Encoding::base64 ? "base64" : "raw")
+         << "\">\n   _";
+    file.write(_data.data(), _data.size());
+    file << "\n  </AppendedData>\n</VTKFile>\n";
+  }
+
+private:
+  // Append the raw bytes of a value
+  template <typename T>
+  void append_raw(T value)
+  {
+    const char* bytes = reinterpret_cast<const char*>(&value);
+    _data.insert(_data.end(), bytes, bytes + sizeof(T));
+  }
+
+  // Compress data in blocks and append the header (number of blocks,
+  // block size, size of last block, compressed size of each block)
+  // followed by the compressed blocks. The blocks are compressed
+  // directly into the appended data, and the header is filled in
+  // afterwards.
+  void append_compressed(std::span<const unsigned char> bytes)
+  {
+    constexpr std::size_t block_size = 32768;
+    const std::size_t num_blocks = (bytes.size() + block_size - 1) / block_size;
+    const std::size_t last_size
+        = bytes.size() - (num_blocks > 0 ? (num_blocks - 1) * block_size : 0);
+
+    std::vector<std::uint64_t> header = {num_blocks, block_size, last_size};
+    const std::size_t header_pos = _data.size();
+    _data.resize(header_pos + (3 + num_blocks) * sizeof(std::uint64_t));
+    for (std::size_t b = 0; b < num_blocks; ++b)
+    {
+      std::span<const unsigned char> in = bytes.subspan(
+          b * block_size, b + 1 < num_blocks ? block_size : last_size);
+      const std::size_t pos = _data.size();
+      _data.resize(pos + compress_bound(in.size()));
+      const std::size_t size
+          = compress(in, std::span(_data.data() + pos, _data.size() - pos));
+      _data.resize(pos + size);
+      header.push_back(size);
+    }
+
+    std::memcpy(_data.data() + header_pos, header.data(),
+                header.size() * sizeof(std::uint64_t));
+  }
+
+  // Upper bound on the compressed size of `size` bytes
+  std::size_t compress_bound([[maybe_unused]] std::size_t size) const
+  {
+    switch (_encoding)
+    {
+#ifdef HAS_ZLIB
+    case io::VTKFile::Encoding::zlib:
+      return compressBound(size);
+#endif
+#ifdef HAS_LZ4
+    case io::VTKFile::Encoding::lz4:
+      return LZ4_compressBound(size);
+#endif
+    default:
+      throw std::runtime_error("Unsupported VTK compressor");
+    }
+  }
+
+  // Compress a block and return the compressed size
+  std::size_t compress([[maybe_unused]] std::span<const unsigned char> in,
+                       [[maybe_unused]] std::span<char> out) const
+  {
+    switch (_encoding)
+    {
+#ifdef HAS_ZLIB
+    case io::VTKFile::Encoding::zlib:
+    {
+      uLongf size = out.size();
+      if (compress2(reinterpret_cast<Bytef*>(out.data()), &size, in.data(),
+                    in.size(), Z_DEFAULT_COMPRESSION)
+          != Z_OK)
+      {
+        throw std::runtime_error("zlib compression of VTK data failed");
+      }
+      return size;
+    }
+#endif
+#ifdef HAS_LZ4
+    case io::VTKFile::Encoding::lz4:
+    {
+      const int size = LZ4_compress_default(
+          reinterpret_cast<const char*>(in.data()), out.data(), in.size(),
+          out.size());
+      if (size <= 0)
+        throw std::runtime_error("LZ4 compression of VTK data failed");
+      return size;
+    }
+#endif
+    default:
+      throw std::runtime_error("Unsupported VTK compressor");
+    }
+  }
+
+  io::VTKFile::Encoding _encoding;
+
+  // Encoded appended data
+  std::vector<char> _data;
+};
+//----------------------------------------------------------------------------
+
 void add_pvtu_mesh(pugi::xml_node& node)
 {
   // -- Cell data (PCellData)
@@ -113,10 +376,12 @@ void add_pvtu_mesh(pugi::xml_node& node)
 /// @param[in] num_components An array indicating the value shape of `values`
 /// @param[in] values The data array to add
 /// @param[in,out] data_node The XML node to add data to
+/// @param[in,out] vtu_data Storage for the data arrays of the file
 template <typename T>
 void add_data_float(const std::string& name,
                     std::span<const std::size_t> num_components,
-                    std::span<const T> values, pugi::xml_node& node)
+                    std::span<const T> values, pugi::xml_node& node,
+                    VTUData& vtu_data)
 {
   static_assert(std::is_floating_point_v<T>, "Scalar must be a float");
 
@@ -126,12 +391,9 @@ void add_data_float(const std::string& name,
   pugi::xml_node field_node = node.append_child("DataArray");
   field_node.append_attribute("type") = type.c_str();
   field_node.append_attribute("Name") = name.c_str();
-  field_node.append_attribute("format") = "ascii";
   if (!num_components.empty())
     field_node.append_attribute("NumberOfComponents") = num_components.front();
-
-  field_node.append_child(pugi::node_pcdata)
-      .set_value(container_to_string(values, 16).str().c_str());
+  vtu_data.add<T>(field_node, values);
 }
 //----------------------------------------------------------------------------
 
@@ -143,13 +405,15 @@ void add_data_float(const std::string& name,
 /// @param[in] num_components An array indicating the value shape of `values`
 /// @param[in] values The data array to add
 /// @param[in,out] data_node The XML node to add data to
+/// @param[in,out] vtu_data Storage for the data arrays of the file
 template <typename T>
 void add_data(const std::string& name,
               std::span<const std::size_t> num_components,
-              std::span<const T> values, pugi::xml_node& node)
+              std::span<const T> values, pugi::xml_node& node,
+              VTUData& vtu_data)
 {
   if constexpr (std::is_scalar_v<T>)
-    add_data_float(name, num_components, values, node);
+    add_data_float(name, num_components, values, node, vtu_data);
   else
   {
     using U = typename T::value_type;
@@ -157,11 +421,11 @@ void add_data(const std::string& name,
     std::transform(values.begin(), values.end(), v.begin(),
                    [](auto x) { return x.real(); });
     add_data_float(name + field_ext[0], num_components, std::span<const U>(v),
-                   node);
+                   node, vtu_data);
     std::transform(values.begin(), values.end(), v.begin(),
                    [](auto x) { return x.imag(); });
     add_data_float(name + field_ext[1], num_components, std::span<const U>(v),
-                   node);
+                   node, vtu_data);
   }
 }
 //----------------------------------------------------------------------------
@@ -178,6 +442,7 @@ void add_data(const std::string& name,
 /// @param[in] celltype The cell type
 /// @param[in] tdim Topological dimension of the cells
 /// @param[in,out] piece_node The XML node to add data to
+/// @param[in,out] vtu_data Storage for the data arrays of the file
 template <typename U>
 void add_mesh(std::span<const U> x, std::array<std::size_t, 2> /*xshape*/,
               std::span<const std::int64_t> x_id,
@@ -185,7 +450,7 @@ void add_mesh(std::span<const U> x, std::array<std::size_t, 2> /*xshape*/,
               std::span<const std::int64_t> cells,
               std::array<std::size_t, 2> cshape,
               const common::IndexMap& cellmap, mesh::CellType celltype,
-              int tdim, pugi::xml_node& piece_node)
+              int tdim, pugi::xml_node& piece_node, VTUData& vtu_data)
 {
   // -- Add geometry (points)
 
@@ -193,9 +458,7 @@ void add_mesh(std::span<const U> x, std::array<std::size_t, 2> /*xshape*/,
   pugi::xml_node x_node = points_node.append_child("DataArray");
   x_node.append_attribute("type") = "Float64";
   x_node.append_attribute("NumberOfComponents") = "3";
-  x_node.append_attribute("format") = "ascii";
-  x_node.append_child(pugi::node_pcdata)
-      .set_value(container_to_string(x, 16).str().c_str());
+  vtu_data.add<double>(x_node, x);
 
   // -- Add topology (cells)
 
@@ -203,37 +466,27 @@ void add_mesh(std::span<const U> x, std::array<std::size_t, 2> /*xshape*/,
   pugi::xml_node connectivity_node = cells_node.append_child("DataArray");
   connectivity_node.append_attribute("type") = "Int32";
   connectivity_node.append_attribute("Name") = "connectivity";
-  connectivity_node.append_attribute("format") = "ascii";
-  {
-    std::stringstream ss;
-    std::for_each(cells.begin(), cells.end(),
-                  [&ss](auto& v) { ss << v << " "; });
-    connectivity_node.append_child(pugi::node_pcdata)
-        .set_value(ss.str().c_str());
-  }
+  vtu_data.add<std::int32_t>(connectivity_node, cells);
 
   pugi::xml_node offsets_node = cells_node.append_child("DataArray");
   offsets_node.append_attribute("type") = "Int32";
   offsets_node.append_attribute("Name") = "offsets";
-  offsets_node.append_attribute("format") = "ascii";
   {
-    std::stringstream ss;
-    int num_nodes = cshape[1];
+    std::vector<std::int32_t> offsets(cshape[0]);
+    const int num_nodes = cshape[1];
     for (std::size_t i = 0; i < cshape[0]; ++i)
-      ss << (i + 1) * num_nodes << " ";
-    offsets_node.append_child(pugi::node_pcdata).set_value(ss.str().c_str());
+      offsets[i] = (i + 1) * num_nodes;
+    vtu_data.add<std::int32_t>(offsets_node,
+                               std::span<const std::int32_t>(offsets));
   }
 
   pugi::xml_node type_node = cells_node.append_child("DataArray");
   type_node.append_attribute("type") = "Int8";
   type_node.append_attribute("Name") = "types";
-  type_node.append_attribute("format") = "ascii";
-  int vtk_celltype = io::cells::get_vtk_cell_type(celltype, tdim);
   {
-    std::stringstream ss;
-    for (std::size_t c = 0; c < cshape[0]; ++c)
-      ss << vtk_celltype << " ";
-    type_node.append_child(pugi::node_pcdata).set_value(ss.str().c_str());
+    std::vector<std::int8_t> types(
+        cshape[0], io::cells::get_vtk_cell_type(celltype, tdim));
+    vtu_data.add<std::int8_t>(type_node, std::span<const std::int8_t>(types));
   }
 
   // Ghost cell markers
@@ -242,16 +495,13 @@ void add_mesh(std::span<const U> x, std::array<std::size_t, 2> /*xshape*/,
   pugi::xml_node ghost_cell_node = cells_data_node.append_child("DataArray");
   ghost_cell_node.append_attribute("type") = "UInt8";
   ghost_cell_node.append_attribute("Name") = "vtkGhostType";
-  ghost_cell_node.append_attribute("format") = "ascii";
   ghost_cell_node.append_attribute("RangeMin") = "0";
   ghost_cell_node.append_attribute("RangeMax") = "1";
   {
-    std::stringstream ss;
-    for (std::int32_t c = 0; c < cellmap.size_local(); ++c)
-      ss << 0 << " ";
-    for (std::size_t c = cellmap.size_local(); c < cshape[0]; ++c)
-      ss << 1 << " ";
-    ghost_cell_node.append_child(pugi::node_pcdata).set_value(ss.str().c_str());
+    std::vector<std::uint8_t> ghost(cshape[0], 0);
+    std::fill(std::next(ghost.begin(), cellmap.size_local()), ghost.end(), 1);
+    vtu_data.add<std::uint8_t>(ghost_cell_node,
+                               std::span<const std::uint8_t>(ghost));
   }
 
   // Original cell IDs
@@ -259,15 +509,12 @@ void add_mesh(std::span<const U> x, std::array<std::size_t, 2> /*xshape*/,
   cell_id_node.append_attribute("type") = "Int64";
   cell_id_node.append_attribute("IdType") = "1";
   cell_id_node.append_attribute("Name") = "vtkOriginalCellIds";
-  cell_id_node.append_attribute("format") = "ascii";
   {
-    std::stringstream ss;
-    const std::int64_t cell_offset = cellmap.local_range()[0];
-    for (std::int32_t c = 0; c < cellmap.size_local(); ++c)
-      ss << cell_offset + c << " ";
-    std::for_each(cellmap.ghosts().begin(), cellmap.ghosts().end(),
-                  [&ss](auto& idx) { ss << idx << " "; });
-    cell_id_node.append_child(pugi::node_pcdata).set_value(ss.str().c_str());
+    std::vector<std::int64_t> ids(cellmap.size_local());
+    std::iota(ids.begin(), ids.end(), cellmap.local_range()[0]);
+    ids.insert(ids.end(), cellmap.ghosts().begin(), cellmap.ghosts().end());
+    vtu_data.add<std::int64_t>(cell_id_node,
+                               std::span<const std::int64_t>(ids));
   }
 
   auto [min_idx, max_idx] = cellmap.local_range();
@@ -289,13 +536,7 @@ void add_mesh(std::span<const U> x, std::array<std::size_t, 2> /*xshape*/,
   point_id_node.append_attribute("type") = "Int64";
   point_id_node.append_attribute("IdType") = "1";
   point_id_node.append_attribute("Name") = "vtkOriginalPointIds";
-  point_id_node.append_attribute("format") = "ascii";
-  {
-    std::stringstream ss;
-    std::for_each(x_id.begin(), x_id.end(),
-                  [&ss](auto idx) { ss << idx << " "; });
-    point_id_node.append_child(pugi::node_pcdata).set_value(ss.str().c_str());
-  }
+  vtu_data.add<std::int64_t>(point_id_node, x_id);
   if (!x_id.empty())
   {
     auto minmax = std::minmax_element(x_id.begin(), x_id.end());
@@ -307,14 +548,7 @@ void add_mesh(std::span<const U> x, std::array<std::size_t, 2> /*xshape*/,
   pugi::xml_node point_ghost_node = points_data_node.append_child("DataArray");
   point_ghost_node.append_attribute("type") = "UInt8";
   point_ghost_node.append_attribute("Name") = "vtkGhostType";
-  point_ghost_node.append_attribute("format") = "ascii";
-  {
-    std::stringstream ss;
-    std::for_each(x_ghost.begin(), x_ghost.end(),
-                  [&ss](int ghost) { ss << ghost << " "; });
-    point_ghost_node.append_child(pugi::node_pcdata)
-        .set_value(ss.str().c_str());
-  }
+  vtu_data.add<std::uint8_t>(point_ghost_node, x_ghost);
   if (!x_ghost.empty())
   {
     auto minmax = std::minmax_element(x_ghost.begin(), x_ghost.end());
@@ -327,7 +561,7 @@ template <dolfinx::scalar T, std::floating_point U>
 void write_function(
     const std::vector<std::reference_wrapper<const fem::Function<T, U>>>& u,
     double time, pugi::xml_document* xml_doc,
-    const std::filesystem::path& filename)
+    const std::filesystem::path& filename, io::VTKFile::Encoding encoding)
 {
   if (!xml_doc)
     throw std::runtime_error("VTKFile has been closed");
@@ -400,10 +634,12 @@ void write_function(
   const std::string counter_str = get_counter(xml_collections, "DataSet");
 
   // Create a VTU XML object
+  VTUData vtu_data(encoding);
   pugi::xml_document xml_vtu;
   pugi::xml_node vtk_node_vtu = xml_vtu.append_child("VTKFile");
   vtk_node_vtu.append_attribute("type") = "UnstructuredGrid";
   vtk_node_vtu.append_attribute("version") = "2.2";
+  vtu_data.set_file_attributes(vtk_node_vtu);
   pugi::xml_node grid_node_vtu = vtk_node_vtu.append_child("UnstructuredGrid");
 
   auto topology0 = mesh0->topology();
@@ -448,7 +684,7 @@ void write_function(
   int tdim = topology0->dim();
   add_mesh<U>(x, xshape, x_id, x_ghost, cells, cshape,
               *topology0->index_map(tdim), cell_type, topology0->dim(),
-              piece_node);
+              piece_node, vtu_data);
 
   // FIXME: is this actually setting the first?
   // Set last scalar/vector/tensor Functions in u to be the 'active'
@@ -510,7 +746,7 @@ void write_function(
       }
 
       add_data(_u.get().name, std::span<const std::size_t>(component_vector),
-               std::span<const T>(data), data_node);
+               std::span<const T>(data), data_node, vtu_data);
     }
     else
     {
@@ -544,14 +780,14 @@ void write_function(
         if (mesh0->geometry().dim() == 3)
           add_data(_u.get().name,
                    std::span<const std::size_t>(component_vector),
-                   _u.get().x()->array(), data_node);
+                   _u.get().x()->array(), data_node, vtu_data);
         else
         {
           // Pad with zeros and then add
           auto data = pad_data(*V, _u.get().x()->array());
           add_data(_u.get().name,
                    std::span<const std::size_t>(component_vector),
-                   std::span<const T>(data), data_node);
+                   std::span<const T>(data), data_node, vtu_data);
         }
       }
       else if (*e == *element0)
@@ -587,14 +823,14 @@ void write_function(
         if (mesh0->geometry().dim() == 3)
           add_data(_u.get().name,
                    std::span<const std::size_t>(component_vector),
-                   std::span<const T>(u), data_node);
+                   std::span<const T>(u), data_node, vtu_data);
         else
         {
           // Pad with zeros and then add
           auto data = pad_data(*V, _u.get().x()->array());
           add_data(_u.get().name,
                    std::span<const std::size_t>(component_vector),
-                   std::span<const T>(data), data_node);
+                   std::span<const T>(data), data_node, vtu_data);
         }
       }
       else
@@ -617,10 +853,7 @@ void write_function(
 
   // Save VTU XML to file
   const int mpi_rank = dolfinx::MPI::rank(mesh0->comm());
-  std::filesystem::path vtu = create_vtu_path(mpi_rank);
-  if (vtu.has_parent_path())
-    std::filesystem::create_directories(vtu.parent_path());
-  xml_vtu.save_file(vtu.c_str(), "  ");
+  vtu_data.save(xml_vtu, create_vtu_path(mpi_rank));
 
   // -- Create a PVTU XML object on rank 0
   std::filesystem::path p_pvtu = filename.parent_path() / filename.stem();
@@ -719,9 +952,15 @@ void write_function(
 
 //----------------------------------------------------------------------------
 io::VTKFile::VTKFile(MPI_Comm comm, const std::filesystem::path& filename,
-                     const std::string&)
-    : _filename(filename), _comm(comm)
+                     const std::string&, Encoding encoding)
+    : _filename(filename), _encoding(encoding), _comm(comm)
 {
+  if (!has_encoding(encoding))
+  {
+    throw std::runtime_error("DOLFINx has not been built with support for "
+                             "the requested VTK encoding.");
+  }
+
   _pvd_xml = std::make_unique<pugi::xml_document>();
   assert(_pvd_xml);
   pugi::xml_node vtk_node = _pvd_xml->append_child("VTKFile");
@@ -730,6 +969,27 @@ io::VTKFile::VTKFile(MPI_Comm comm, const std::filesystem::path& filename,
   vtk_node.append_child("Collection");
 }
 //----------------------------------------------------------------------------
+bool io::VTKFile::has_encoding(Encoding encoding)
+{
+  switch (encoding)
+  {
+  case Encoding::zlib:
+#ifdef HAS_ZLIB
+    return true;
+#else
+    return false;
+#endif
+  case Encoding::lz4:
+#ifdef HAS_LZ4
+    return true;
+#else
+    return false;
+#endif
+  default:
+    return true;
+  }
+}
+//----------------------------------------------------------------------------
 io::VTKFile::~VTKFile()
 {
   if (_pvd_xml and dolfinx::MPI::rank(_comm.comm()) == 0)
@@ -797,10 +1057,12 @@ void io::VTKFile::write(const mesh::Mesh<U>& mesh, double time)
                                  + topology->index_map(tdim)->num_ghosts();
 
   // Create a VTU XML object
+  VTUData vtu_data(_encoding);
   pugi::xml_document xml_vtu;
   pugi::xml_node vtk_node_vtu = xml_vtu.append_child("VTKFile");
   vtk_node_vtu.append_attribute("type") = "UnstructuredGrid";
   vtk_node_vtu.append_attribute("version") = "2.2";
+  vtu_data.set_file_attributes(vtk_node_vtu);
   pugi::xml_node grid_node_vtu = vtk_node_vtu.append_child("UnstructuredGrid");
 
   // Add "Piece" node and required metadata
@@ -818,7 +1080,7 @@ void io::VTKFile::write(const mesh::Mesh<U>& mesh, double time)
   std::fill(std::next(x_ghost.begin(), xmap->size_local()), x_ghost.end(), 1);
   add_mesh(geometry.x(), xshape, geometry.input_global_indices(), x_ghost,
            cells, cshape, *topology->index_map(tdim), cell_type,
-           topology->dim(), piece_node);
+           topology->dim(), piece_node, vtu_data);
 
   // Create filepath for a .vtu file
   auto create_vtu_path = [file_root = _filename.parent_path(),
@@ -832,10 +1094,7 @@ void io::VTKFile::write(const mesh::Mesh<U>& mesh, double time)
 
   // Save VTU XML to file
   const int mpi_rank = dolfinx::MPI::rank(_comm.comm());
-  std::filesystem::path vtu = create_vtu_path(mpi_rank);
-  if (vtu.has_parent_path())
-    std::filesystem::create_directories(vtu.parent_path());
-  xml_vtu.save_file(vtu.c_str(), "  ");
+  vtu_data.save(xml_vtu, create_vtu_path(mpi_rank));
 
   // Create a PVTU XML object on rank 0
   std::filesystem::path p_pvtu = _filename.parent_path() / _filename.stem();
@@ -880,7 +1139,7 @@ void io::VTKFile::write(
     const std::vector<std::reference_wrapper<const fem::Function<T, U>>>& u,
     double time)
 {
-  write_function<T, U>(u, time, _pvd_xml.get(), _filename);
+  write_function<T, U>(u, time, _pvd_xml.get(), _filename, _encoding);
 }
 //-----------------------------------------------------------------------------
 // Instantiation for different types
@@ -46,13 +46,38 @@ namespace dolfinx::io
 class VTKFile
 {
 public:
-  /// Create VTK file
+  /// @brief Encoding of the data arrays in the VTU files.
+  enum class Encoding
+  {
+    ascii,  ///< Data is written as text in the XML tree
+    binary, ///< Raw binary data appended to the file
+    base64, ///< Base64-encoded binary data appended to the file
+    zlib,   ///< zlib-compressed binary data appended to the file
+    lz4     ///< LZ4-compressed binary data appended to the file
+  };
+
+  /// @brief Create VTK file
+  /// @param[in] comm MPI communicator
+  /// @param[in] filename Name of the PVD file
+  /// @param[in] file_mode File mode (unused)
+  /// @param[in] encoding Encoding of the data arrays. Binary data is
+  /// written to the `AppendedData` section of each VTU file, and is
+  /// much faster to write and read than ASCII data. Throws if the
+  /// encoding is not available, see has_encoding.
   VTKFile(MPI_Comm comm, const std::filesystem::path& filename,
-          const std::string& file_mode);
+          const std::string& file_mode, Encoding encoding = Encoding::ascii);
 
   /// Destructor
   ~VTKFile();
 
+  /// @brief Check if an encoding is available.
+  ///
+  /// The compressed encodings are available only if DOLFINx has been
+  /// built with the compression library.
+  /// @param[in] encoding The encoding.
+  /// @return True if files can be written with `encoding`.
+  static bool has_encoding(Encoding encoding);
+
   /// Close file
   void close();
 
@@ -90,6 +115,9 @@ private:
 
   std::filesystem::path _filename;
 
+  // Encoding of VTU data arrays
+  Encoding _encoding;
+
   // MPI communicator
   dolfinx::MPI::Comm _comm;
 };
@@ -25,9 +25,11 @@ using namespace dolfinx::io;
 
 //-----------------------------------------------------------------------------
 XDMFFile::XDMFFile(MPI_Comm comm, const std::filesystem::path& filename,
-                   std::string file_mode, Encoding encoding)
+                   std::string file_mode, Encoding encoding,
+                   const hdf5::Options& options)
     : _comm(comm), _filename(filename), _file_mode(file_mode),
-      _xml_doc(new pugi::xml_document), _encoding(encoding)
+      _xml_doc(new pugi::xml_document), _encoding(encoding),
+      _h5_options(options)
 {
   // Handle HDF5 and XDMF files with the file mode. At the end of this
   // we will have _hdf5_file and _xml_doc both pointing to a valid and
@@ -42,8 +44,8 @@ XDMFFile::XDMFFile(MPI_Comm comm, const std::filesystem::path& filename,
     const std::filesystem::path hdf5_filename
         = xdmf_utils::get_hdf5_filename(_filename);
     const bool mpi_io = dolfinx::MPI::size(_comm.comm()) > 1 ? true : false;
-    _h5_id
-        = io::hdf5::open_file(_comm.comm(), hdf5_filename, file_mode, mpi_io);
+    _h5_id = io::hdf5::open_file(_comm.comm(), hdf5_filename, file_mode,
+                                 mpi_io, _h5_options);
     assert(_h5_id > 0);
     spdlog::info("Opened HDF5 file with id \"{}\"", _h5_id);
   }
@@ -134,7 +136,8 @@ void XDMFFile::write_mesh(const mesh::Mesh<U>& mesh, std::string xpath)
     throw std::runtime_error("XML node '" + xpath + "' not found.");
 
   // Add the mesh Grid to the domain
-  xdmf_mesh::add_mesh(_comm.comm(), node, _h5_id, mesh, mesh.name);
+  xdmf_mesh::add_mesh(_comm.comm(), node, _h5_id, mesh, mesh.name,
+                      _h5_options);
 
   // Save XML file (on process 0 only)
   if (MPI::rank(_comm.comm()) == 0)
@@ -160,7 +163,7 @@ void XDMFFile::write_geometry(const mesh::Geometry<double>& geometry,
 
   const std::string path_prefix = "/Geometry/" + name;
   xdmf_mesh::add_geometry_data(_comm.comm(), grid_node, _h5_id, path_prefix,
-                               geometry);
+                               geometry, _h5_options);
 
   // Save XML file (on process 0 only)
   if (MPI::rank(_comm.comm()) == 0)
@@ -264,7 +267,8 @@ void XDMFFile::write_function(const fem::Function<T, U>& u, double t,
   assert(time_node);
 
   // Add the mesh Grid to the domain
-  xdmf_function::add_function(_comm.comm(), u, t, grid_node, _h5_id);
+  xdmf_function::add_function(_comm.comm(), u, t, grid_node, _h5_id,
+                              _h5_options);
 
   // Save XML file (on process 0 only)
   if (dolfinx::MPI::rank(_comm.comm()) == 0)
@@ -304,7 +308,7 @@ void XDMFFile::write_meshtags(const mesh::MeshTags<std::int32_t>& meshtags,
   geo_ref_node.append_attribute("xpointer") = geo_ref_path.c_str();
   assert(geo_ref_node);
   xdmf_mesh::add_meshtags(_comm.comm(), meshtags, x, grid_node, _h5_id,
-                          meshtags.name);
+                          meshtags.name, _h5_options);
 
   // Save XML file (on process 0 only)
   if (MPI::rank(_comm.comm()) == 0)
@@ -66,9 +66,17 @@ public:
   /// Default encoding type
   static const Encoding default_encoding = Encoding::HDF5;
 
-  /// Constructor
+  /// @brief Constructor.
+  /// @param[in] comm MPI communicator.
+  /// @param[in] filename Name of the XDMF file.
+  /// @param[in] file_mode File mode ("r", "w" or "a").
+  /// @param[in] encoding Encoding of heavy data.
+  /// @param[in] options Parallel layout and transfer options for the
+  /// HDF5 file, e.g. chunking and compression of datasets. Has no
+  /// effect for ASCII encoding.
   XDMFFile(MPI_Comm comm, const std::filesystem::path& filename,
-           std::string file_mode, Encoding encoding = default_encoding);
+           std::string file_mode, Encoding encoding = default_encoding,
+           const hdf5::Options& options = {});
 
   /// Move constructor
   XDMFFile(XDMFFile&&) = default;
@@ -207,6 +215,9 @@ private:
   std::unique_ptr<pugi::xml_document> _xml_doc;
 
   Encoding _encoding;
+
+  // HDF5 layout and transfer options
+  hdf5::Options _h5_options;
 };
 
 } // namespace dolfinx::io
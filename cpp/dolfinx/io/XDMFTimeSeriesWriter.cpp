@@ -0,0 +1,222 @@
+// Copyright (C) 2026 agent
+//
+// This file is part of DOLFINx (https://www.fenicsproject.org)
+//
+// SPDX-License-Identifier:    LGPL-3.0-or-later
+
+#include "XDMFTimeSeriesWriter.h"
+#include "xdmf_function.h"
+#include "xdmf_mesh.h"
+#include "xdmf_utils.h"
+#include <boost/lexical_cast.hpp>
+#include <dolfinx/common/log.h>
+#include <dolfinx/fem/Function.h>
+#include <dolfinx/fem/FunctionSpace.h>
+#include <dolfinx/mesh/Mesh.h>
+#include <pugixml.hpp>
+#include <sstream>
+#include <string_view>
+
+using namespace dolfinx;
+using namespace dolfinx::io;
+
+namespace
+{
+/// Closing tags of the XDMF file before and after the temporal
+/// collection has been opened
+constexpr std::string_view domain_end = "  </Domain>\n</Xdmf>\n";
+constexpr std::string_view collection_end
+    = "    </Grid>\n  </Domain>\n</Xdmf>\n";
+
+/// Serialise a node (and its children) to a string, indented for
+/// insertion at a given depth in the XDMF file
+std::string to_string(const pugi::xml_node& node, unsigned int depth)
+{
+  std::ostringstream s;
+  node.print(s, "  ", pugi::format_default, pugi::encoding_auto, depth);
+  return s.str();
+}
+} // namespace
+
+//-----------------------------------------------------------------------------
+template <std::floating_point T>
+XDMFTimeSeriesWriter<T>::XDMFTimeSeriesWriter(
+    MPI_Comm comm, const std::filesystem::path& filename,
+    const typename xdmf_writer::U<T>& u, MeshPolicy mesh_policy,
+    const hdf5::Options& options)
+    : _comm(comm), _filename(filename), _u(u), _mesh_policy(mesh_policy),
+      _h5_id(-1), _h5_options(options), _step(0)
+{
+  if (u.empty())
+    throw std::runtime_error("XDMFTimeSeriesWriter function list is empty.");
+
+  // Check that all functions share the same mesh
+  _mesh = std::visit([](auto&& u) { return u->function_space()->mesh(); },
+                     u.front());
+  assert(_mesh);
+  for (auto& v : u)
+  {
+    std::visit(
+        [this](auto&& u)
+        {
+          if (_mesh != u->function_space()->mesh())
+          {
+            throw std::runtime_error("XDMFTimeSeriesWriter only supports "
+                                     "functions sharing the same mesh.");
+          }
+        },
+        v);
+  }
+
+  // Open HDF5 file
+  const bool mpi_io = dolfinx::MPI::size(_comm.comm()) > 1;
+  _h5_id = hdf5::open_file(_comm.comm(),
+                           xdmf_utils::get_hdf5_filename(_filename), "w",
+                           mpi_io, _h5_options);
+
+  // Write XML header and closing tags (on process 0 only)
+  int ok = 1;
+  if (dolfinx::MPI::rank(_comm.comm()) == 0)
+  {
+    _xml_file.open(_filename, std::ios::out | std::ios::trunc);
+    _xml_file << "<?xml version=\"1.0\"?>\n"
+              << "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\" []>\n"
+              << "<Xdmf Version=\"3.0\" "
+                 "xmlns:xi=\"https://www.w3.org/2001/XInclude\">\n"
+              << "  <Domain>\n";
+    _xml_end = _xml_file.tellp();
+    _xml_file << domain_end;
+    _xml_file.flush();
+    ok = static_cast<bool>(_xml_file);
+  }
+
+  // Make the error collective so that all processes throw
+  MPI_Bcast(&ok, 1, MPI_INT, 0, _comm.comm());
+  if (!ok)
+  {
+    close();
+    throw std::runtime_error("Failed to open XDMF file for writing.");
+  }
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point T>
+XDMFTimeSeriesWriter<T>::~XDMFTimeSeriesWriter()
+{
+  close();
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point T>
+void XDMFTimeSeriesWriter<T>::close()
+{
+  if (_h5_id > 0)
+    hdf5::close_file(_h5_id);
+  _h5_id = -1;
+  if (_xml_file.is_open())
+    _xml_file.close();
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point T>
+void XDMFTimeSeriesWriter<T>::write(double t)
+{
+  if (_h5_id < 0)
+    throw std::runtime_error("XDMFTimeSeriesWriter has been closed.");
+
+  spdlog::info("XDMF: write time step {} (t = {})", _step, t);
+
+  // Build the XML for this step in a scratch document. Only the new
+  // nodes are serialised.
+  pugi::xml_document doc;
+  std::string xml;
+  if (_step == 0)
+  {
+    // Write the mesh once, before the temporal collection
+    if (_mesh_policy == MeshPolicy::reuse)
+    {
+      xdmf_mesh::add_mesh(_comm.comm(), doc, _h5_id, *_mesh, _mesh->name,
+                          _h5_options);
+      xml += to_string(doc.last_child(), 2);
+    }
+
+    pugi::xml_node grid_node = doc.append_child("Grid");
+    grid_node.append_attribute("Name") = _mesh->name.c_str();
+    grid_node.append_attribute("GridType") = "Collection";
+    grid_node.append_attribute("CollectionType") = "Temporal";
+
+    // Keep only the opening tag of the collection
+    std::ostringstream s;
+    grid_node.print(s, "  ",
+                    pugi::format_default | pugi::format_no_empty_element_tags,
+                    pugi::encoding_auto, 2);
+    const std::string tags = s.str();
+    xml += tags.substr(0, tags.rfind("</")) + "\n";
+  }
+
+  pugi::xml_node grid_node;
+  if (_mesh_policy == MeshPolicy::reuse)
+  {
+    grid_node = doc.append_child("Grid");
+    grid_node.append_attribute("Name") = _mesh->name.c_str();
+    grid_node.append_attribute("GridType") = "Uniform";
+
+    const std::string ref_path
+        = "xpointer(/Xdmf/Domain/Grid[@GridType='Uniform'][@Name='"
+          + _mesh->name + "']/*[self::Topology or self::Geometry])";
+    pugi::xml_node topo_geo_ref = grid_node.append_child("xi:include");
+    topo_geo_ref.append_attribute("xpointer") = ref_path.c_str();
+  }
+  else
+  {
+    // Write the mesh for this step under a unique name
+    xdmf_mesh::add_mesh(_comm.comm(), doc, _h5_id, *_mesh,
+                        _mesh->name + "_" + std::to_string(_step),
+                        _h5_options);
+    grid_node = doc.last_child();
+    grid_node.attribute("Name") = _mesh->name.c_str();
+  }
+  assert(grid_node);
+
+  const std::string t_str = boost::lexical_cast<std::string>(t);
+  pugi::xml_node time_node = grid_node.append_child("Time");
+  time_node.append_attribute("Value") = t_str.c_str();
+
+  for (auto& v : _u)
+  {
+    std::visit(
+        [&](auto&& u)
+        {
+          xdmf_function::add_function(_comm.comm(), *u, t, grid_node, _h5_id,
+                                      _h5_options);
+        },
+        v);
+  }
+  xml += to_string(grid_node, 3);
+
+  // Flush heavy data before the XML that references it is written
+  hdf5::flush_file(_h5_id);
+
+  // Overwrite the closing tags with the new step and re-append the
+  // closing tags (on process 0 only)
+  int ok = 1;
+  if (dolfinx::MPI::rank(_comm.comm()) == 0)
+  {
+    _xml_file.seekp(_xml_end);
+    _xml_file << xml;
+    _xml_end = _xml_file.tellp();
+    _xml_file << collection_end;
+    _xml_file.flush();
+    ok = static_cast<bool>(_xml_file);
+  }
+
+  // Make the error collective so that all processes throw
+  MPI_Bcast(&ok, 1, MPI_INT, 0, _comm.comm());
+  if (!ok)
+    throw std::runtime_error("Failed to write to XDMF file.");
+
+  ++_step;
+}
+//-----------------------------------------------------------------------------
+/// @cond
+template class io::XDMFTimeSeriesWriter<float>;
+template class io::XDMFTimeSeriesWriter<double>;
+/// @endcond
+//-----------------------------------------------------------------------------
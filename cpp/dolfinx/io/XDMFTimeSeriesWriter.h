@@ -0,0 +1,123 @@
+// Copyright (C) 2026 agent
+//
+// This file is part of DOLFINx (https://www.fenicsproject.org)
+//
+// SPDX-License-Identifier:    LGPL-3.0-or-later
+
+#pragma once
+
+#include "HDF5Interface.h"
+#include "utils.h"
+#include <complex>
+#include <concepts>
+#include <cstdint>
+#include <dolfinx/common/MPI.h>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <variant>
+#include <vector>
+
+namespace dolfinx::fem
+{
+template <dolfinx::scalar T, std::floating_point U>
+class Function;
+} // namespace dolfinx::fem
+
+namespace dolfinx::mesh
+{
+template <std::floating_point T>
+class Mesh;
+} // namespace dolfinx::mesh
+
+namespace dolfinx::io
+{
+namespace xdmf_writer
+{
+/// @privatesection
+template <std::floating_point T>
+using U = std::vector<
+    std::variant<std::shared_ptr<const fem::Function<T, T>>,
+                 std::shared_ptr<const fem::Function<std::complex<T>, T>>>>;
+} // namespace xdmf_writer
+
+/// @brief Writer for time series of fem::Functions in XDMF format.
+///
+/// Unlike XDMFFile::write_function, which re-writes the complete XML
+/// file on every call, this writer appends the XML for each time step
+/// to the end of the file. The cost of writing a step is therefore
+/// independent of the number of steps already written. The file is
+/// valid XDMF after each call to write().
+///
+/// All functions must share the same mesh and satisfy the
+/// preconditions of XDMFFile::write_function. Heavy data is written to
+/// a HDF5 file with the same base name as the XDMF file.
+template <std::floating_point T>
+class XDMFTimeSeriesWriter
+{
+public:
+  /// @brief Create an XDMF time series writer.
+  /// @param[in] comm The MPI communicator to open the file on.
+  /// @param[in] filename Name of the output XDMF file.
+  /// @param[in] u List of functions to write at each time step.
+  /// @param[in] mesh_policy Controls if the mesh is written to file
+  /// at the first time step only or is re-written at every time step
+  /// (use for moving meshes).
+  /// @param[in] options Parallel layout and transfer options for the
+  /// HDF5 file.
+  XDMFTimeSeriesWriter(MPI_Comm comm, const std::filesystem::path& filename,
+                       const typename xdmf_writer::U<T>& u,
+                       MeshPolicy mesh_policy = MeshPolicy::update,
+                       const hdf5::Options& options = {});
+
+  /// Copy constructor
+  XDMFTimeSeriesWriter(const XDMFTimeSeriesWriter&) = delete;
+
+  /// Destructor
+  ~XDMFTimeSeriesWriter();
+
+  /// Copy assignment
+  XDMFTimeSeriesWriter& operator=(const XDMFTimeSeriesWriter&) = delete;
+
+  /// @brief Write the functions at a time step.
+  ///
+  /// This is a collective operation.
+  /// @param[in] t The time of the step.
+  void write(double t);
+
+  /// Close the file
+  void close();
+
+private:
+  // MPI communicator
+  dolfinx::MPI::Comm _comm;
+
+  // XDMF filename
+  std::filesystem::path _filename;
+
+  // Mesh that all functions are defined on
+  std::shared_ptr<const mesh::Mesh<T>> _mesh;
+
+  // Functions to write
+  xdmf_writer::U<T> _u;
+
+  // Control whether the mesh is written to file once or at every time
+  // step
+  MeshPolicy _mesh_policy;
+
+  // HDF5 file handle
+  hid_t _h5_id;
+
+  // HDF5 layout and transfer options
+  hdf5::Options _h5_options;
+
+  // XDMF file stream (open on rank 0 only) and the position of the
+  // closing tags, which are overwritten by the next step
+  std::ofstream _xml_file;
+  std::streampos _xml_end;
+
+  // Number of time steps written
+  std::int64_t _step;
+};
+
+} // namespace dolfinx::io
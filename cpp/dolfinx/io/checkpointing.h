@@ -0,0 +1,439 @@
+// Copyright (C) 2026 agent
+//
+// This file is part of DOLFINx (https://www.fenicsproject.org)
+//
+// SPDX-License-Identifier:    LGPL-3.0-or-later
+
+#pragma once
+
+#ifdef HAS_ADIOS2
+
+#include <adios2.h>
+#include <algorithm>
+#include <array>
+#include <basix/finite-element.h>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <dolfinx/common/IndexMap.h>
+#include <dolfinx/common/MPI.h>
+#include <dolfinx/common/types.h>
+#include <dolfinx/fem/CoordinateElement.h>
+#include <dolfinx/fem/DofMap.h>
+#include <dolfinx/fem/FiniteElement.h>
+#include <dolfinx/fem/Function.h>
+#include <dolfinx/fem/FunctionSpace.h>
+#include <dolfinx/mesh/Mesh.h>
+#include <dolfinx/mesh/Topology.h>
+#include <dolfinx/mesh/cell_types.h>
+#include <dolfinx/mesh/utils.h>
+#include <mpi.h>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/// @file checkpointing.h
+/// @brief ADIOS2-based checkpointing of meshes and functions
+///
+/// A checkpoint stores the mesh geometry and topology, and for each
+/// function the cell-wise degree-of-freedom map and the
+/// degree-of-freedom values at each time step. Cell data is stored in
+/// the order of the cells of the writing processes, and this position
+/// is used as the cell index when reading. A checkpoint can be read on
+/// any number of processes.
+///
+/// Checkpoints are written to an engine opened with
+/// `adios2::Mode::Write` and read from an engine opened with
+/// `adios2::Mode::ReadRandomAccess` (requires ADIOS2 >= 2.9).
+
+namespace dolfinx::io::checkpointing
+{
+namespace impl
+{
+/// @brief Read a block of rows of a 2D global array.
+///
+/// The rows are divided evenly across the ranks of `comm`, see
+/// dolfinx::MPI::local_range.
+/// @return The rows read by the caller (row-major).
+template <typename T>
+std::vector<T> read_row_block(MPI_Comm comm, adios2::IO& io,
+                              adios2::Engine& engine, std::string name,
+                              std::size_t step = 0)
+{
+  adios2::Variable<T> var = io.InquireVariable<T>(name);
+  if (!var)
+    throw std::runtime_error("Variable " + name + " not found in checkpoint.");
+  var.SetStepSelection({step, 1});
+
+  adios2::Dims shape = var.Shape();
+  assert(shape.size() == 2);
+  const std::array<std::int64_t, 2> range = dolfinx::MPI::local_range(
+      dolfinx::MPI::rank(comm), shape[0], dolfinx::MPI::size(comm));
+  std::size_t num_rows = range[1] - range[0];
+  std::vector<T> data(num_rows * shape[1]);
+  if (num_rows > 0)
+  {
+    var.SetSelection({{static_cast<std::size_t>(range[0]), 0},
+                      {num_rows, shape[1]}});
+    engine.Get(var, data.data(), adios2::Mode::Sync);
+  }
+
+  return data;
+}
+
+/// @brief Define an attribute if it is not already defined.
+template <typename T>
+void define_attribute(adios2::IO& io, std::string name, const T& value)
+{
+  if (!io.InquireAttribute<T>(name))
+    io.DefineAttribute<T>(name, value);
+}
+
+/// @brief Define a 2D global array variable and put the rows owned by
+/// the caller.
+/// @note The data is not copied until `engine.PerformPuts()` or
+/// `engine.EndStep()` is called.
+template <typename T>
+void put_rows(adios2::IO& io, adios2::Engine& engine, std::string name,
+              std::span<const T> data, std::size_t shape1,
+              std::int64_t num_rows_global, std::int64_t offset)
+{
+  const std::size_t num_rows = data.size() / shape1;
+  adios2::Variable<T> var = io.InquireVariable<T>(name);
+  if (!var)
+  {
+    var = io.DefineVariable<T>(
+        name, {static_cast<std::size_t>(num_rows_global), shape1},
+        {static_cast<std::size_t>(offset), 0}, {num_rows, shape1},
+        adios2::ConstantDims);
+  }
+  engine.Put(var, data.data());
+}
+
+/// @brief Degree-of-freedom map of the first `num_cells` cells.
+///
+/// fem::create_dofmap applies the inverse of the element
+/// degree-of-freedom permutations to the cell dofmaps, so the `i`th
+/// entry of a cell is the degree-of-freedom associated with the `i`th
+/// reference degree-of-freedom. This ordering is therefore independent
+/// of the parallel distribution and vertex numbering of the mesh, and
+/// is used to identify cell degrees-of-freedom across writers and
+/// readers.
+/// @param[in] V The function space.
+/// @param[in] num_cells Number of cells.
+/// @return Local (block) degree-of-freedom indices for each cell,
+/// shape=`(num_cells, num_dofs_per_cell)`.
+template <std::floating_point T>
+std::vector<std::int32_t> cell_dofs(const fem::FunctionSpace<T>& V,
+                                    std::int32_t num_cells)
+{
+  auto element = V.element();
+  assert(element);
+  if (element->needs_dof_transformations())
+  {
+    throw std::runtime_error("Checkpointing of functions with elements that "
+                             "require degree-of-freedom transformations is "
+                             "not supported.");
+  }
+
+  auto dofmap = V.dofmap();
+  assert(dofmap);
+  const int num_dofs = dofmap->map().extent(1);
+  std::vector<std::int32_t> dofs(num_cells * num_dofs);
+  for (std::int32_t c = 0; c < num_cells; ++c)
+  {
+    std::span<const std::int32_t> cdofs = dofmap->cell_dofs(c);
+    std::copy(cdofs.begin(), cdofs.end(),
+              std::next(dofs.begin(), c * num_dofs));
+  }
+
+  return dofs;
+}
+} // namespace impl
+
+/// @brief Write a mesh to a checkpoint.
+///
+/// The mesh is written in a single step. The geometry is written in the
+/// order of the geometry index map and the topology (cell 'nodes') of
+/// the owned cells using global geometry indices. The input global
+/// index of each cell is also stored.
+///
+/// @param[in] io ADIOS2 IO object.
+/// @param[in] engine ADIOS2 engine opened in write mode.
+/// @param[in] mesh Mesh to write.
+template <std::floating_point T>
+void write_mesh(adios2::IO& io, adios2::Engine& engine,
+                const mesh::Mesh<T>& mesh)
+{
+  const mesh::Geometry<T>& geometry = mesh.geometry();
+  auto topology = mesh.topology();
+  assert(topology);
+  const int tdim = topology->dim();
+
+  // Geometry nodes owned by this rank
+  auto x_map = geometry.index_map();
+  assert(x_map);
+  const int gdim = geometry.dim();
+  const std::int32_t num_nodes = x_map->size_local();
+  std::vector<T> x(num_nodes * gdim);
+  std::span<const T> x_g = geometry.x();
+  for (std::int32_t i = 0; i < num_nodes; ++i)
+    for (int j = 0; j < gdim; ++j)
+      x[i * gdim + j] = x_g[i * 3 + j];
+
+  // Owned cells, using global geometry node indices
+  auto c_map = topology->index_map(tdim);
+  assert(c_map);
+  const std::int32_t num_cells = c_map->size_local();
+  auto dofmap = geometry.dofmap();
+  const std::size_t num_cell_nodes = dofmap.extent(1);
+  std::vector<std::int64_t> cells(num_cells * num_cell_nodes);
+  x_map->local_to_global(std::span(dofmap.data_handle(), cells.size()),
+                         cells);
+  std::span<const std::int64_t> original_cell_index(
+      topology->original_cell_index.front().data(), num_cells);
+
+  const fem::CoordinateElement<T>& cmap = geometry.cmap();
+  impl::define_attribute<std::string>(io, "mesh_cell_type",
+                                     mesh::to_string(cmap.cell_shape()));
+  impl::define_attribute<std::int32_t>(io, "mesh_degree", cmap.degree());
+  impl::define_attribute<std::int32_t>(
+      io, "mesh_lagrange_variant", static_cast<std::int32_t>(cmap.variant()));
+
+  engine.BeginStep();
+  impl::put_rows<T>(io, engine, "mesh_geometry", x, gdim, x_map->size_global(),
+                    x_map->local_range()[0]);
+  impl::put_rows<std::int64_t>(io, engine, "mesh_topology", cells,
+                               num_cell_nodes, c_map->size_global(),
+                               c_map->local_range()[0]);
+  impl::put_rows<std::int64_t>(io, engine, "mesh_original_cell_index",
+                               original_cell_index, 1, c_map->size_global(),
+                               c_map->local_range()[0]);
+  engine.PerformPuts();
+  engine.EndStep();
+}
+
+/// @brief Read a mesh from a checkpoint.
+///
+/// The cells are read in blocks by the ranks of `comm` and distributed
+/// using the graph partitioner. The checkpoint may have been written on
+/// a different number of processes.
+///
+/// @param[in] io ADIOS2 IO object.
+/// @param[in] engine ADIOS2 engine opened in random access read mode.
+/// @param[in] comm Communicator to create the mesh on.
+/// @param[in] ghost_mode Ghost mode of the mesh.
+/// @return The mesh. The original cell index of each cell is the
+/// position of the cell in the checkpoint. Use
+/// read_original_cell_index to recover the input index of the cells
+/// of the mesh that was written.
+template <std::floating_point T>
+mesh::Mesh<T> read_mesh(adios2::IO& io, adios2::Engine& engine, MPI_Comm comm,
+                        mesh::GhostMode ghost_mode = mesh::GhostMode::none)
+{
+  adios2::Attribute<std::string> cell_type
+      = io.InquireAttribute<std::string>("mesh_cell_type");
+  adios2::Attribute<std::int32_t> degree
+      = io.InquireAttribute<std::int32_t>("mesh_degree");
+  adios2::Attribute<std::int32_t> variant
+      = io.InquireAttribute<std::int32_t>("mesh_lagrange_variant");
+  if (!cell_type or !degree or !variant)
+    throw std::runtime_error("Checkpoint does not contain a mesh.");
+
+  fem::CoordinateElement<T> element(
+      mesh::to_type(cell_type.Data().front()), degree.Data().front(),
+      static_cast<basix::element::lagrange_variant>(variant.Data().front()));
+
+  std::vector<T> x = impl::read_row_block<T>(comm, io, engine, "mesh_geometry");
+  const std::size_t gdim
+      = io.InquireVariable<T>("mesh_geometry").Shape().back();
+  std::vector<std::int64_t> cells
+      = impl::read_row_block<std::int64_t>(comm, io, engine, "mesh_topology");
+
+  return mesh::create_mesh(comm, cells, element, x, {x.size() / gdim, gdim},
+                           ghost_mode);
+}
+
+/// @brief Read the input global index of cells of a mesh that was
+/// read using read_mesh.
+/// @param[in] io ADIOS2 IO object.
+/// @param[in] engine ADIOS2 engine opened in random access read mode.
+/// @param[in] mesh Mesh that was read from the checkpoint.
+/// @return Input global index of each cell of the mesh that was written
+/// to the checkpoint, for the owned cells of `mesh`.
+template <std::floating_point T>
+std::vector<std::int64_t> read_original_cell_index(adios2::IO& io,
+                                                   adios2::Engine& engine,
+                                                   const mesh::Mesh<T>& mesh)
+{
+  auto topology = mesh.topology();
+  assert(topology);
+  const std::int32_t num_cells
+      = topology->index_map(topology->dim())->size_local();
+  std::span<const std::int64_t> cell_pos(
+      topology->original_cell_index.front().data(), num_cells);
+
+  std::vector<std::int64_t> index = impl::read_row_block<std::int64_t>(
+      mesh.comm(), io, engine, "mesh_original_cell_index");
+  return dolfinx::MPI::distribute_data(mesh.comm(), cell_pos, mesh.comm(),
+                                       index, 1);
+}
+
+/// @brief Write a function to a checkpoint.
+///
+/// The function values are written as a new step, together with the
+/// time `t`. The degree-of-freedom map of the function is written the
+/// first time a function with the name of `u` is written. The mesh of
+/// `u` must be written to the same checkpoint using write_mesh.
+///
+/// @param[in] io ADIOS2 IO object.
+/// @param[in] engine ADIOS2 engine opened in write mode.
+/// @param[in] u Function to write. The name of the function is used to
+/// identify it in the checkpoint.
+/// @param[in] t Time associated with the function values.
+template <dolfinx::scalar T, std::floating_point U>
+void write_function(adios2::IO& io, adios2::Engine& engine,
+                    const fem::Function<T, U>& u, double t = 0)
+{
+  auto V = u.function_space();
+  assert(V);
+  auto mesh = V->mesh();
+  assert(mesh);
+  auto dofmap = V->dofmap();
+  assert(dofmap);
+  const int bs = dofmap->bs();
+  if (bs != dofmap->index_map_bs())
+    throw std::runtime_error("Cannot checkpoint a function on a sub-space.");
+
+  auto topology = mesh->topology();
+  assert(topology);
+  auto c_map = topology->index_map(topology->dim());
+  assert(c_map);
+  const std::int32_t num_cells = c_map->size_local();
+  auto index_map = dofmap->index_map;
+  assert(index_map);
+  const std::string name = u.name;
+
+  engine.BeginStep();
+
+  // Cell degrees-of-freedom (global indices) in reference ordering
+  std::vector<std::int64_t> cell_dofs;
+  if (!io.InquireVariable<std::int64_t>(name + "_dofmap"))
+  {
+    impl::define_attribute<std::string>(io, name + "_element",
+                                        V->element()->signature());
+    std::vector<std::int32_t> dofs = impl::cell_dofs(*V, num_cells);
+    cell_dofs.resize(dofs.size());
+    index_map->local_to_global(dofs, cell_dofs);
+    impl::put_rows<std::int64_t>(io, engine, name + "_dofmap", cell_dofs,
+                                 dofmap->map().extent(1), c_map->size_global(),
+                                 c_map->local_range()[0]);
+  }
+
+  std::span<const T> x = u.x()->array();
+  impl::put_rows<T>(io, engine, name + "_values",
+                    x.first(index_map->size_local() * bs), bs,
+                    index_map->size_global(), index_map->local_range()[0]);
+
+  adios2::Variable<double> var_t = io.InquireVariable<double>(name + "_time");
+  if (!var_t)
+    var_t = io.DefineVariable<double>(name + "_time");
+  engine.Put(var_t, t);
+
+  engine.PerformPuts();
+  engine.EndStep();
+}
+
+/// @brief Read a function from a checkpoint.
+///
+/// The mesh of `u` must have been read from the same checkpoint using
+/// read_mesh, and the function space of `u` must use the same element
+/// as the function that was written. The number of processes can differ
+/// from the number of processes used to write the checkpoint.
+///
+/// @param[in] io ADIOS2 IO object.
+/// @param[in] engine ADIOS2 engine opened in random access read mode.
+/// @param[in,out] u Function to read the values into. The name of the
+/// function is used to identify it in the checkpoint.
+/// @param[in] t Time of the values to read.
+template <dolfinx::scalar T, std::floating_point U>
+void read_function(adios2::IO& io, adios2::Engine& engine,
+                   fem::Function<T, U>& u, double t = 0)
+{
+  auto V = u.function_space();
+  assert(V);
+  auto mesh = V->mesh();
+  assert(mesh);
+  auto dofmap = V->dofmap();
+  assert(dofmap);
+  const int bs = dofmap->bs();
+  const std::string name = u.name;
+
+  adios2::Attribute<std::string> signature
+      = io.InquireAttribute<std::string>(name + "_element");
+  if (!signature)
+    throw std::runtime_error("Function " + name + " not found in checkpoint.");
+  if (signature.Data().front() != V->element()->signature())
+  {
+    throw std::runtime_error("Element of function " + name
+                             + " does not match the checkpoint.");
+  }
+
+  // Find step for time t
+  adios2::Variable<double> var_t = io.InquireVariable<double>(name + "_time");
+  assert(var_t);
+  std::vector<double> times(var_t.Steps());
+  var_t.SetStepSelection({0, times.size()});
+  engine.Get(var_t, times.data(), adios2::Mode::Sync);
+  auto it = std::find(times.begin(), times.end(), t);
+  if (it == times.end())
+  {
+    throw std::runtime_error("Function " + name + " at time "
+                             + std::to_string(t) + " not found in checkpoint.");
+  }
+  const std::size_t step = std::distance(times.begin(), it);
+
+  // Get degrees-of-freedom of the writer for each owned cell, using
+  // the cell position in the checkpoint
+  auto topology = mesh->topology();
+  assert(topology);
+  const std::int32_t num_cells
+      = topology->index_map(topology->dim())->size_local();
+  std::span<const std::int64_t> cell_pos(
+      topology->original_cell_index.front().data(), num_cells);
+  const int num_dofs = dofmap->map().extent(1);
+  std::vector<std::int64_t> cell_dofs_in = dolfinx::MPI::distribute_data(
+      mesh->comm(), cell_pos, mesh->comm(),
+      impl::read_row_block<std::int64_t>(mesh->comm(), io, engine,
+                                         name + "_dofmap"),
+      num_dofs);
+
+  // Get values of the required degrees-of-freedom
+  std::vector<std::int64_t> dofs_in = cell_dofs_in;
+  std::sort(dofs_in.begin(), dofs_in.end());
+  dofs_in.erase(std::unique(dofs_in.begin(), dofs_in.end()), dofs_in.end());
+  std::vector<T> values = dolfinx::MPI::distribute_data(
+      mesh->comm(), dofs_in, mesh->comm(),
+      impl::read_row_block<T>(mesh->comm(), io, engine, name + "_values",
+                              step),
+      bs);
+
+  // Copy values to matching degrees-of-freedom (reference ordering)
+  std::vector<std::int32_t> cell_dofs = impl::cell_dofs(*V, num_cells);
+  std::span<T> x = u.x()->mutable_array();
+  for (std::size_t i = 0; i < cell_dofs.size(); ++i)
+  {
+    auto it = std::lower_bound(dofs_in.begin(), dofs_in.end(), cell_dofs_in[i]);
+    assert(it != dofs_in.end() and *it == cell_dofs_in[i]);
+    std::size_t pos = std::distance(dofs_in.begin(), it);
+    std::copy_n(std::next(values.begin(), pos * bs), bs,
+                std::next(x.begin(), cell_dofs[i] * bs));
+  }
+
+  u.x()->scatter_fwd();
+}
+
+} // namespace dolfinx::io::checkpointing
+
+#endif
@@ -10,4 +10,5 @@ namespace dolfinx::io
 // DOLFINx io interface
 
 #include <dolfinx/io/ADIOS2Writers.h>
+#include <dolfinx/io/checkpointing.h>
 #include <dolfinx/io/VTKFile.h>
@@ -0,0 +1,18 @@
+// Copyright (C) 2026 agent
+//
+// This file is part of DOLFINx (https://www.fenicsproject.org)
+//
+// SPDX-License-Identifier:    LGPL-3.0-or-later
+
+#pragma once
+
+namespace dolfinx::io
+{
+/// Mesh reuse policy for writers of time series of fem::Functions
+enum class MeshPolicy
+{
+  update, ///< Re-write the mesh to file upon every write of a fem::Function
+  reuse   ///< Write the mesh to file only the first time a fem::Function is
+          ///< written to file
+};
+} // namespace dolfinx::io
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "HDF5Interface.h"
 #include <complex>
 #include <concepts>
 #include <dolfinx/common/types.h>
@@ -32,6 +33,7 @@ namespace io::xdmf_function
 /// Write a fem::Function to XDMF
 template <dolfinx::scalar T, std::floating_point U>
 void add_function(MPI_Comm comm, const fem::Function<T, U>& u, double t,
-                  pugi::xml_node& xml_node, const hid_t h5_id);
+                  pugi::xml_node& xml_node, const hid_t h5_id,
+                  const hdf5::Options& options = {});
 } // namespace io::xdmf_function
 } // namespace dolfinx
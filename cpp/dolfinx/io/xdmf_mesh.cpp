@@ -24,7 +24,8 @@ void xdmf_mesh::add_topology_data(MPI_Comm comm, pugi::xml_node& xml_node,
                                   hid_t h5_id, std::string path_prefix,
                                   const mesh::Topology& topology,
                                   const mesh::Geometry<U>& geometry, int dim,
-                                  std::span<const std::int32_t> entities)
+                                  std::span<const std::int32_t> entities,
+                                  const hdf5::Options& options)
 {
   spdlog::info("Adding topology data to node {}", xml_node.path('/'));
 
@@ -153,13 +154,14 @@ void xdmf_mesh::add_topology_data(MPI_Comm comm, pugi::xml_node& xml_node,
   const bool use_mpi_io = (dolfinx::MPI::size(comm) > 1);
   xdmf_utils::add_data_item(topology_node, h5_id, h5_path,
                             std::span<const std::int64_t>(topology_data),
-                            offset, shape, number_type, use_mpi_io);
+                            offset, shape, number_type, use_mpi_io, options);
 }
 //-----------------------------------------------------------------------------
 template <std::floating_point U>
 void xdmf_mesh::add_geometry_data(MPI_Comm comm, pugi::xml_node& xml_node,
                                   hid_t h5_id, std::string path_prefix,
-                                  const mesh::Geometry<U>& geometry)
+                                  const mesh::Geometry<U>& geometry,
+                                  const hdf5::Options& options)
 {
   spdlog::info("Adding geometry data to node \"{}\"", xml_node.path('/'));
   auto map = geometry.index_map();
@@ -207,12 +209,13 @@ void xdmf_mesh::add_geometry_data(MPI_Comm comm, pugi::xml_node& xml_node,
   const bool use_mpi_io = (dolfinx::MPI::size(comm) > 1);
   xdmf_utils::add_data_item(geometry_node, h5_id, h5_path,
                             std::span<const U>(x), offset, shape, "",
-                            use_mpi_io);
+                            use_mpi_io, options);
 }
 //----------------------------------------------------------------------------
 template <std::floating_point U>
 void xdmf_mesh::add_mesh(MPI_Comm comm, pugi::xml_node& xml_node, hid_t h5_id,
-                         const mesh::Mesh<U>& mesh, const std::string& name)
+                         const mesh::Mesh<U>& mesh, const std::string& name,
+                         const hdf5::Options& options)
 {
   spdlog::info("Adding mesh to node \"{}\"", xml_node.path('/'));
 
@@ -236,17 +239,19 @@ void xdmf_mesh::add_mesh(MPI_Comm comm, pugi::xml_node& xml_node, hid_t h5_id,
 
   add_topology_data(comm, grid_node, h5_id, path_prefix, *mesh.topology(),
                     mesh.geometry(), tdim,
-                    std::span<std::int32_t>(cells.data(), num_cells));
+                    std::span<std::int32_t>(cells.data(), num_cells), options);
 
   // Add geometry node and attributes (including writing data)
-  add_geometry_data(comm, grid_node, h5_id, path_prefix, mesh.geometry());
+  add_geometry_data(comm, grid_node, h5_id, path_prefix, mesh.geometry(),
+                    options);
 }
 /// @cond
 template void xdmf_mesh::add_mesh(MPI_Comm, pugi::xml_node&, hid_t,
-                                  const mesh::Mesh<float>&, const std::string&);
+                                  const mesh::Mesh<float>&, const std::string&,
+                                  const hdf5::Options&);
 template void xdmf_mesh::add_mesh(MPI_Comm, pugi::xml_node&, hid_t,
-                                  const mesh::Mesh<double>&,
-                                  const std::string&);
+                                  const mesh::Mesh<double>&, const std::string&,
+                                  const hdf5::Options&);
 /// @endcond
 //----------------------------------------------------------------------------
 std::pair<std::variant<std::vector<float>, std::vector<double>>,
@@ -311,15 +316,37 @@ xdmf_mesh::read_topology_data(MPI_Comm comm, hid_t h5_id,
   const std::vector tdims = xdmf_utils::get_dataset_shape(topology_data_node);
   const std::size_t npoint_per_cell = tdims[1];
 
+  const std::vector perm = io::cells::perm_vtk(cell_type, npoint_per_cell);
+
+  // When reading in serial, permute cells from VTK to DOLFINx ordering
+  // directly from the memory mapped file if possible
+  if (std::optional data
+      = xdmf_utils::map_dataset(comm, topology_data_node, h5_id);
+      data and data->has_type<std::int64_t>())
+  {
+    std::span<const std::int64_t> topology_data
+        = data->values<std::int64_t>();
+    std::array<std::size_t, 2> shape
+        = {topology_data.size() / npoint_per_cell, npoint_per_cell};
+    return {io::cells::apply_permutation(topology_data, shape, perm), shape};
+  }
+
   // Read topology data
-  std::vector<std::int64_t> topology_data
+  std::vector<std::int64_t> cells
       = xdmf_utils::get_dataset<std::int64_t>(comm, topology_data_node, h5_id);
-  const std::size_t num_local_cells = topology_data.size() / npoint_per_cell;
+  const std::size_t num_local_cells = cells.size() / npoint_per_cell;
+
+  //  Permute cells from VTK to DOLFINx ordering (in-place)
+  std::vector<std::int64_t> cell(npoint_per_cell);
+  for (std::size_t c = 0; c < num_local_cells; ++c)
+  {
+    std::span<std::int64_t> _cell(cells.data() + c * npoint_per_cell,
+                                  npoint_per_cell);
+    std::copy(_cell.begin(), _cell.end(), cell.begin());
+    for (std::size_t i = 0; i < npoint_per_cell; ++i)
+      _cell[i] = cell[perm[i]];
+  }
 
-  //  Permute cells from VTK to DOLFINx ordering
-  std::array<std::size_t, 2> shape = {num_local_cells, npoint_per_cell};
-  std::vector<std::int64_t> cells = io::cells::apply_permutation(
-      topology_data, shape, io::cells::perm_vtk(cell_type, shape[1]));
-  return {std::move(cells), shape};
+  return {std::move(cells), {num_local_cells, npoint_per_cell}};
 }
 //----------------------------------------------------------------------------
@@ -48,7 +48,8 @@ namespace io::xdmf_mesh
 /// HDF file data is stored under path prefix.
 template <std::floating_point U>
 void add_mesh(MPI_Comm comm, pugi::xml_node& xml_node, hid_t h5_id,
-              const mesh::Mesh<U>& mesh, const std::string& path_prefix);
+              const mesh::Mesh<U>& mesh, const std::string& path_prefix,
+              const hdf5::Options& options = {});
 
 /// Add Topology xml node
 /// @param[in] comm
@@ -60,17 +61,20 @@ void add_mesh(MPI_Comm comm, pugi::xml_node& xml_node, hid_t h5_id,
 /// @param[in] cell_dim Dimension of mesh entities to save
 /// @param[in] entities Local-to-process indices of mesh entities
 /// whose topology will be saved. This is used to save subsets of Mesh.
+/// @param[in] options HDF5 dataset options
 template <std::floating_point U>
 void add_topology_data(MPI_Comm comm, pugi::xml_node& xml_node, hid_t h5_id,
                        std::string path_prefix, const mesh::Topology& topology,
                        const mesh::Geometry<U>& geometry, int cell_dim,
-                       std::span<const std::int32_t> entities);
+                       std::span<const std::int32_t> entities,
+                       const hdf5::Options& options = {});
 
 /// Add Geometry xml node
 template <std::floating_point U>
 void add_geometry_data(MPI_Comm comm, pugi::xml_node& xml_node, hid_t h5_id,
                        std::string path_prefix,
-                       const mesh::Geometry<U>& geometry);
+                       const mesh::Geometry<U>& geometry,
+                       const hdf5::Options& options = {});
 
 /// @brief Read geometry (coordinate) data.
 ///
@@ -95,7 +99,8 @@ read_topology_data(MPI_Comm comm, hid_t h5_id, const pugi::xml_node& node);
 template <typename T, std::floating_point U>
 void add_meshtags(MPI_Comm comm, const mesh::MeshTags<T>& meshtags,
                   const mesh::Geometry<U>& geometry, pugi::xml_node& xml_node,
-                  hid_t h5_id, const std::string& name)
+                  hid_t h5_id, const std::string& name,
+                  const hdf5::Options& options = {})
 {
   spdlog::info("XDMF: add meshtags ({})", name.c_str());
   // Get mesh
@@ -118,7 +123,8 @@ void add_meshtags(MPI_Comm comm, const mesh::MeshTags<T>& meshtags,
   xdmf_mesh::add_topology_data(
       comm, xml_node, h5_id, path_prefix, *meshtags.topology(), geometry, dim,
       std::span<const std::int32_t>(meshtags.indices().data(),
-                                    num_active_entities));
+                                    num_active_entities),
+      options);
 
   // Add attribute node with values
   pugi::xml_node attribute_node = xml_node.append_child("Attribute");
@@ -138,7 +144,7 @@ void add_meshtags(MPI_Comm comm, const mesh::MeshTags<T>& meshtags,
   xdmf_utils::add_data_item(
       attribute_node, h5_id, path_prefix + std::string("/Values"),
       std::span<const T>(meshtags.values().data(), num_active_entities), offset,
-      {global_num_values, 1}, "", use_mpi_io);
+      {global_num_values, 1}, "", use_mpi_io, options);
 }
 } // namespace io::xdmf_mesh
 } // namespace dolfinx
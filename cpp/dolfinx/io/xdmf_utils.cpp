@@ -180,6 +180,36 @@ std::int64_t xdmf_utils::get_num_cells(const pugi::xml_node& topology_node)
   return std::max(num_cells_topology, tdims[0]);
 }
 //----------------------------------------------------------------------------
+std::optional<io::hdf5::MappedDataset>
+xdmf_utils::map_dataset(MPI_Comm comm, const pugi::xml_node& dataset_node,
+                        hid_t h5_id)
+{
+  assert(dataset_node);
+  if (h5_id < 0 or dolfinx::MPI::size(comm) > 1
+      or std::string(dataset_node.attribute("Format").as_string()) != "HDF")
+  {
+    return std::nullopt;
+  }
+
+  const std::array paths = get_hdf5_paths(dataset_node);
+  const hid_t dset_id = io::hdf5::open_dataset(h5_id, paths[1]);
+  if (dset_id == H5I_INVALID_HID)
+    throw std::runtime_error("Failed to open HDF5 global dataset.");
+
+  std::optional<io::hdf5::MappedDataset> data;
+  if (io::hdf5::is_mappable(dset_id)
+      and io::hdf5::get_dataset_shape(dset_id)
+              == get_dataset_shape(dataset_node))
+  {
+    data.emplace(dset_id);
+  }
+
+  if (H5Dclose(dset_id) < 0)
+    throw std::runtime_error("Failed to close HDF5 global dataset.");
+
+  return data;
+}
+//----------------------------------------------------------------------------
 std::string xdmf_utils::vtk_cell_type_str(mesh::CellType cell_type,
                                           int num_nodes)
 {
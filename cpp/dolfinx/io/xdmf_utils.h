@@ -18,6 +18,7 @@
 #include <dolfinx/mesh/cell_types.h>
 #include <filesystem>
 #include <numeric>
+#include <optional>
 #include <pugixml.hpp>
 #include <span>
 #include <string>
@@ -67,6 +68,16 @@ std::vector<std::int64_t> get_dataset_shape(const pugi::xml_node& dataset_node);
 /// Get number of cells from an XML Topology node
 std::int64_t get_num_cells(const pugi::xml_node& topology_node);
 
+/// @brief Memory map the HDF5 data of an XML DataItem node.
+///
+/// Data is mapped only when reading on a single process, and if the
+/// HDF5 dataset has the shape of the DataItem and satisfies
+/// io::hdf5::is_mappable.
+/// @return The mapped dataset, or `std::nullopt` if the data is not
+/// mapped.
+std::optional<io::hdf5::MappedDataset>
+map_dataset(MPI_Comm comm, const pugi::xml_node& dataset_node, hid_t h5_id);
+
 /// Get the VTK string identifier
 std::string vtk_cell_type_str(mesh::CellType cell_type, int num_nodes);
 
@@ -124,7 +135,8 @@ template <typename T>
 void add_data_item(pugi::xml_node& xml_node, hid_t h5_id,
                    const std::string& h5_path, std::span<const T> x,
                    std::int64_t offset, const std::vector<std::int64_t>& shape,
-                   const std::string& number_type, bool use_mpi_io)
+                   const std::string& number_type, bool use_mpi_io,
+                   const io::hdf5::Options& options = {})
 {
   // Add DataItem node
   assert(xml_node);
@@ -179,7 +191,7 @@ void add_data_item(pugi::xml_node& xml_node, hid_t h5_id,
 
     const std::array local_range{offset, offset + local_shape0};
     io::hdf5::write_dataset(h5_id, h5_path, x.data(), local_range, shape,
-                            use_mpi_io, false);
+                            use_mpi_io, options);
 
     // Add partitioning attribute to dataset
     // std::vector<std::size_t> partitions;
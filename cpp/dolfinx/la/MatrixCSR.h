@@ -7,6 +7,7 @@
 #pragma once
 
 #include "SparsityPattern.h"
+#include "Vector.h"
 #include "matrix_csr_impl.h"
 #include <dolfinx/common/IndexMap.h>
 #include <dolfinx/common/MPI.h>
@@ -317,6 +318,24 @@ public:
   /// @note MPI Collective
   double squared_norm() const;
 
+  /// @brief Compute the product `y += Ax`.
+  ///
+  /// The ghost values of `x` are updated while the product with the
+  /// owned columns is computed, and only the owned entries of `y` are
+  /// computed.
+  ///
+  /// @param[in,out] x Vector to apply `A` to. Its index map must be the
+  /// column index map of the matrix.
+  /// @param[in,out] y Vector to accumulate the result in. Its owned
+  /// entries must match the owned rows of the matrix.
+  /// @param[in] type The type of MPI communication pattern used for
+  /// the ghost update of `x`. Use common::Scatterer::type::shm to
+  /// exchange data with ranks on the same compute node through shared
+  /// memory.
+  void mult(Vector<value_type>& x, Vector<value_type>& y,
+            typename Vector<value_type>::scatter_type type
+            = Vector<value_type>::scatter_type::neighbor);
+
   /// @brief Index maps for the row and column space.
   ///
   /// The row IndexMap contains ghost entries for rows which may be
@@ -728,4 +747,51 @@ double MatrixCSR<U, V, W, X>::squared_norm() const
 }
 //-----------------------------------------------------------------------------
 
+template <typename U, typename V, typename W, typename X>
+void MatrixCSR<U, V, W, X>::mult(Vector<value_type>& x, Vector<value_type>& y,
+                                 typename Vector<value_type>::scatter_type type)
+{
+  // Start ghost update of x
+  x.scatter_fwd_begin(type);
+
+  const std::int32_t num_rows = num_owned_rows();
+  const int bs2 = _bs[0] * _bs[1];
+  std::span<const std::int64_t> row_begin(_row_ptr.data(), num_rows);
+  std::span<const std::int64_t> row_end(_row_ptr.data() + 1, num_rows);
+  std::span<const std::int64_t> off_diag(_off_diagonal_offset.data(),
+                                         num_rows);
+  std::span<const std::int32_t> cols(_cols.data(), _row_ptr[num_rows]);
+  std::span<const value_type> values(_data.data(), _row_ptr[num_rows] * bs2);
+  std::span<const value_type> _x = x.array();
+  std::span<value_type> _y = y.mutable_array();
+
+  // Product with the owned (diagonal) block, overlapping communication
+  if (_bs[1] == 1)
+  {
+    impl::spmv<value_type, 1>(values, row_begin, off_diag, cols, _x, _y,
+                              _bs[0], 1);
+  }
+  else
+  {
+    impl::spmv<value_type, -1>(values, row_begin, off_diag, cols, _x, _y,
+                               _bs[0], _bs[1]);
+  }
+
+  // Finalise ghost update of x
+  x.scatter_fwd_end();
+
+  // Product with the off-diagonal block (ghost columns)
+  if (_bs[1] == 1)
+  {
+    impl::spmv<value_type, 1>(values, off_diag, row_end, cols, _x, _y, _bs[0],
+                              1);
+  }
+  else
+  {
+    impl::spmv<value_type, -1>(values, off_diag, row_end, cols, _x, _y,
+                               _bs[0], _bs[1]);
+  }
+}
+//-----------------------------------------------------------------------------
+
 } // namespace dolfinx::la
@@ -63,11 +63,30 @@ SparsityPattern::SparsityPattern(
   for (const std::vector<int>& owners : owners1)
     ghost_owners1.insert(ghost_owners1.end(), owners.begin(), owners.end());
 
+  // The communication graph of a stacked map is contained in the union
+  // of the communication graphs of the blocks
+  auto neighbourhood = [](auto& maps)
+  {
+    std::array<std::vector<int>, 2> nbr;
+    for (auto& [map, _] : maps)
+    {
+      std::span src = map.get().src();
+      std::span dest = map.get().dest();
+      nbr[0].insert(nbr[0].end(), src.begin(), src.end());
+      nbr[1].insert(nbr[1].end(), dest.begin(), dest.end());
+    }
+    return nbr;
+  };
+  const std::array<std::vector<int>, 2> nbr0 = neighbourhood(maps[0]);
+  const std::array<std::vector<int>, 2> nbr1 = neighbourhood(maps[1]);
+
   // Create new IndexMaps
   _index_maps[0] = std::make_shared<common::IndexMap>(
-      comm, local_offset0.back(), ghosts0, ghost_owners0);
+      comm, local_offset0.back(), ghosts0, ghost_owners0,
+      std::array<std::span<const int>, 2>{nbr0[0], nbr0[1]});
   _index_maps[1] = std::make_shared<common::IndexMap>(
-      comm, local_offset1.back(), ghosts1, ghost_owners1);
+      comm, local_offset1.back(), ghosts1, ghost_owners1,
+      std::array<std::span<const int>, 2>{nbr1[0], nbr1[1]});
 
   _row_cache.resize(_index_maps[0]->size_local()
                     + _index_maps[0]->num_ghosts());
@@ -297,11 +316,9 @@ void SparsityPattern::finalize()
   // Exchange data between processes
   std::vector<std::int64_t> ghost_data_in;
   {
-    MPI_Comm comm;
     std::span dest0 = _index_maps[0]->dest();
-    MPI_Dist_graph_create_adjacent(
-        _index_maps[0]->comm(), dest0.size(), dest0.data(), MPI_UNWEIGHTED,
-        src0.size(), src0.data(), MPI_UNWEIGHTED, MPI_INFO_NULL, false, &comm);
+    MPI_Comm comm = dolfinx::MPI::neighbourhood_comm(_index_maps[0]->comm(),
+                                                     dest0, src0);
 
     std::vector<int> recv_sizes(dest0.size());
     send_sizes.reserve(1);
@@ -319,7 +336,6 @@ void SparsityPattern::finalize()
                            send_disp.data(), MPI_INT64_T, ghost_data_in.data(),
                            recv_sizes.data(), recv_disp.data(), MPI_INT64_T,
                            comm);
-    MPI_Comm_free(&comm);
   }
 
   // Global to local map for ghost column indices
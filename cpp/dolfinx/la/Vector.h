@@ -35,6 +35,9 @@ public:
   /// Scalar type
   using value_type = T;
 
+  /// Type of MPI communication pattern used in ghost updates
+  using scatter_type = common::Scatterer<>::type;
+
   /// Container type
   using container_type = Container;
 
@@ -55,7 +58,8 @@ public:
   /// Copy constructor
   Vector(const Vector& x)
       : _map(x._map), _scatterer(x._scatterer), _bs(x._bs),
-        _request(1, MPI_REQUEST_NULL), _buffer_local(x._buffer_local),
+        _request(1, MPI_REQUEST_NULL), _request_type(scatter_type::neighbor),
+        _buffer_local(x._buffer_local),
         _buffer_remote(x._buffer_remote), _x(x._x)
   {
   }
@@ -65,6 +69,7 @@ public:
       : _map(std::move(x._map)), _scatterer(std::move(x._scatterer)),
         _bs(std::move(x._bs)),
         _request(std::exchange(x._request, {MPI_REQUEST_NULL})),
+        _request_type(std::exchange(x._request_type, scatter_type::neighbor)),
         _buffer_local(std::move(x._buffer_local)),
         _buffer_remote(std::move(x._buffer_remote)), _x(std::move(x._x))
   {
@@ -81,8 +86,11 @@ public:
   void set(value_type v) { std::fill(_x.begin(), _x.end(), v); }
 
   /// Begin scatter of local data from owner to ghosts on other ranks
+  /// @param[in] type The type of MPI communication pattern. Use
+  /// common::Scatterer::type::shm to exchange data with ranks on the
+  /// same compute node through shared memory.
   /// @note Collective MPI operation
-  void scatter_fwd_begin()
+  void scatter_fwd_begin(scatter_type type = scatter_type::neighbor)
   {
     const std::int32_t local_size = _bs * _map->size_local();
     std::span<const value_type> x_local(_x.data(), local_size);
@@ -92,11 +100,11 @@ public:
       for (std::size_t i = 0; i < idx.size(); ++i)
         out[i] = in[idx[i]];
     };
-    pack(x_local, _scatterer->local_indices(), _buffer_local);
 
-    _scatterer->scatter_fwd_begin(std::span<const value_type>(_buffer_local),
-                                  std::span<value_type>(_buffer_remote),
-                                  std::span<MPI_Request>(_request));
+    init_request(type);
+    _scatterer->scatter_fwd_begin(x_local, std::span<value_type>(_buffer_local),
+                                  std::span<value_type>(_buffer_remote), pack,
+                                  std::span<MPI_Request>(_request), type);
   }
 
   /// End scatter of local data from owner to ghosts on other ranks
@@ -106,29 +114,32 @@ public:
     const std::int32_t local_size = _bs * _map->size_local();
     const std::int32_t num_ghosts = _bs * _map->num_ghosts();
     std::span<value_type> x_remote(_x.data() + local_size, num_ghosts);
-    _scatterer->scatter_fwd_end(std::span<MPI_Request>(_request));
 
     auto unpack = [](auto&& in, auto&& idx, auto&& out, auto op)
     {
       for (std::size_t i = 0; i < idx.size(); ++i)
         out[idx[i]] = op(out[idx[i]], in[i]);
     };
-
-    unpack(_buffer_remote, _scatterer->remote_indices(), x_remote,
-           [](auto /*a*/, auto b) { return b; });
+    _scatterer->scatter_fwd_end(std::span<const value_type>(_buffer_remote),
+                                x_remote, unpack,
+                                std::span<MPI_Request>(_request));
   }
 
   /// Scatter local data to ghost positions on other ranks
+  /// @param[in] type The type of MPI communication pattern
   /// @note Collective MPI operation
-  void scatter_fwd()
+  void scatter_fwd(scatter_type type = scatter_type::neighbor)
   {
-    this->scatter_fwd_begin();
+    this->scatter_fwd_begin(type);
     this->scatter_fwd_end();
   }
 
   /// Start scatter of  ghost data to owner
+  /// @param[in] type The type of MPI communication pattern. Use
+  /// common::Scatterer::type::shm to exchange data with ranks on the
+  /// same compute node through shared memory.
   /// @note Collective MPI operation
-  void scatter_rev_begin()
+  void scatter_rev_begin(scatter_type type = scatter_type::neighbor)
   {
     const std::int32_t local_size = _bs * _map->size_local();
     const std::int32_t num_ghosts = _bs * _map->num_ghosts();
@@ -139,11 +150,12 @@ public:
       for (std::size_t i = 0; i < idx.size(); ++i)
         out[i] = in[idx[i]];
     };
-    pack(x_remote, _scatterer->remote_indices(), _buffer_remote);
 
-    _scatterer->scatter_rev_begin(std::span<const value_type>(_buffer_remote),
-                                  std::span<value_type>(_buffer_local),
-                                  _request);
+    init_request(type);
+    _scatterer->scatter_rev_begin(std::span<const value_type>(x_remote),
+                                  std::span<value_type>(_buffer_remote),
+                                  std::span<value_type>(_buffer_local), pack,
+                                  std::span<MPI_Request>(_request), type);
   }
 
   /// End scatter of ghost data to owner. This process may receive data
@@ -157,25 +169,28 @@ public:
   {
     const std::int32_t local_size = _bs * _map->size_local();
     std::span<value_type> x_local(_x.data(), local_size);
-    _scatterer->scatter_rev_end(_request);
 
     auto unpack = [](auto&& in, auto&& idx, auto&& out, auto op)
     {
       for (std::size_t i = 0; i < idx.size(); ++i)
         out[idx[i]] = op(out[idx[i]], in[i]);
     };
-    unpack(_buffer_local, _scatterer->local_indices(), x_local, op);
+    _scatterer->scatter_rev_end(std::span<const value_type>(_buffer_local),
+                                x_local, unpack, op,
+                                std::span<MPI_Request>(_request));
   }
 
   /// Scatter ghost data to owner. This process may receive data from
   /// more than one process, and the received data can be summed or
   /// inserted into the local portion of the vector.
   /// @param op IndexMap operation (add or insert)
+  /// @param[in] type The type of MPI communication pattern
   /// @note Collective MPI operation
   template <class BinaryOperation>
-  void scatter_rev(BinaryOperation op)
+  void scatter_rev(BinaryOperation op,
+                   scatter_type type = scatter_type::neighbor)
   {
-    this->scatter_rev_begin();
+    this->scatter_rev_begin(type);
     this->scatter_rev_end(op);
   }
 
@@ -195,6 +210,17 @@ public:
   std::span<value_type> mutable_array() { return std::span(_x); }
 
 private:
+  // Create the request vector for a communication pattern, if the
+  // current request vector is for another pattern
+  void init_request(scatter_type type)
+  {
+    if (type != _request_type)
+    {
+      _request = _scatterer->create_request_vector(type);
+      _request_type = type;
+    }
+  }
+
   // Map describing the data layout
   std::shared_ptr<const common::IndexMap> _map;
 
@@ -207,6 +233,9 @@ private:
   // MPI request handle
   std::vector<MPI_Request> _request = {MPI_REQUEST_NULL};
 
+  // Communication pattern that _request was created for
+  scatter_type _request_type = scatter_type::neighbor;
+
   // Buffers for ghost scatters
   container_type _buffer_local, _buffer_remote;
 
@@ -0,0 +1,92 @@
+// Copyright (C) 2026 agent
+//
+// This file is part of DOLFINx (https://www.fenicsproject.org)
+//
+// SPDX-License-Identifier:    LGPL-3.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <dolfinx/common/types.h>
+#include <numeric>
+#include <span>
+#include <utility>
+
+namespace dolfinx::la::impl
+{
+/// @brief LU factorisation with partial pivoting of a small dense
+/// (row-major) `n x n` matrix, in place.
+///
+/// On return, the strictly lower triangle of `A` holds the multipliers
+/// of the unit lower triangular factor and the upper triangle holds the
+/// upper triangular factor.
+///
+/// @param[in,out] A Matrix to factorise (`n x n`, row-major).
+/// @param[out] perm Row permutation (size `n`), i.e. row `i` of the
+/// factorised matrix is row `perm[i]` of the input matrix.
+/// @return False if the matrix is numerically singular, in which case
+/// `A` and `perm` are partially factorised.
+template <dolfinx::scalar T>
+bool lu_factor(std::span<T> A, std::span<std::int32_t> perm)
+{
+  const std::size_t n = perm.size();
+  std::iota(perm.begin(), perm.end(), 0);
+  for (std::size_t k = 0; k < n; ++k)
+  {
+    std::size_t p = k;
+    for (std::size_t i = k + 1; i < n; ++i)
+      if (std::abs(A[i * n + k]) > std::abs(A[p * n + k]))
+        p = i;
+    if (A[p * n + k] == T(0))
+      return false;
+    if (p != k)
+    {
+      std::swap_ranges(std::next(A.begin(), k * n),
+                       std::next(A.begin(), (k + 1) * n),
+                       std::next(A.begin(), p * n));
+      std::swap(perm[k], perm[p]);
+    }
+
+    for (std::size_t i = k + 1; i < n; ++i)
+    {
+      const T l = A[i * n + k] / A[k * n + k];
+      A[i * n + k] = l;
+      for (std::size_t j = k + 1; j < n; ++j)
+        A[i * n + j] -= l * A[k * n + j];
+    }
+  }
+
+  return true;
+}
+
+/// @brief Solve `A x = b` using an LU factorisation computed by
+/// lu_factor.
+/// @param[in] LU Factorised matrix.
+/// @param[in] perm Row permutation computed by lu_factor.
+/// @param[in] b Right-hand side.
+/// @param[out] x Solution. Must not alias `b`.
+template <dolfinx::scalar T>
+void lu_solve(std::span<const T> LU, std::span<const std::int32_t> perm,
+              std::span<const T> b, std::span<T> x)
+{
+  const std::size_t n = perm.size();
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    T xi = b[perm[i]];
+    for (std::size_t j = 0; j < i; ++j)
+      xi -= LU[i * n + j] * x[j];
+    x[i] = xi;
+  }
+
+  for (std::size_t i = n; i-- > 0;)
+  {
+    T xi = x[i];
+    for (std::size_t j = i + 1; j < n; ++j)
+      xi -= LU[i * n + j] * x[j];
+    x[i] = xi / LU[i * n + i];
+  }
+}
+} // namespace dolfinx::la::impl
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <cassert>
+#include <cstdint>
 #include <iostream>
 #include <numeric>
 #include <span>
@@ -100,6 +102,29 @@ void insert_nonblocked_csr(U&& data, const V& cols, const W& row_ptr,
                            const X& x, const Y& xrows, const Y& xcols, OP op,
                            typename Y::value_type num_rows, int bs0, int bs1);
 
+/// @brief Compute `y += Ax` for a local (block) CSR matrix `A` and
+/// local dense vectors `x` and `y`.
+///
+/// @tparam BS1 Column block size of the matrix. If `BS1` is -1, the
+/// run-time column block size `bs1` is used.
+/// @param[in] values Non-zero values of `A` (blocks are stored
+/// row-major)
+/// @param[in] row_begin First index of each (block) row in the arrays
+/// `values` and `indices`
+/// @param[in] row_end One past the last index of each (block) row in
+/// the arrays `values` and `indices`
+/// @param[in] indices (Block) column indices for each non-zero entry
+/// of the matrix
+/// @param[in] x Input vector
+/// @param[in,out] y Output vector
+/// @param[in] bs0 Row block size of the matrix
+/// @param[in] bs1 Column block size of the matrix
+template <typename T, int BS1>
+void spmv(std::span<const T> values, std::span<const std::int64_t> row_begin,
+          std::span<const std::int64_t> row_end,
+          std::span<const std::int32_t> indices, std::span<const T> x,
+          std::span<T> y, int bs0, int bs1);
+
 } // namespace impl
 
 //-----------------------------------------------------------------------------
@@ -237,4 +262,31 @@ void impl::insert_nonblocked_csr(U&& data, const V& cols, const W& row_ptr,
   }
 }
 //-----------------------------------------------------------------------------
+template <typename T, int BS1>
+void impl::spmv(std::span<const T> values,
+                std::span<const std::int64_t> row_begin,
+                std::span<const std::int64_t> row_end,
+                std::span<const std::int32_t> indices, std::span<const T> x,
+                std::span<T> y, int bs0, [[maybe_unused]] int bs1)
+{
+  assert(row_begin.size() == row_end.size());
+  const int _bs1 = BS1 > 0 ? BS1 : bs1;
+  const int bs2 = bs0 * _bs1;
+  for (std::size_t i = 0; i < row_begin.size(); ++i)
+  {
+    for (int k0 = 0; k0 < bs0; ++k0)
+    {
+      T vi{0};
+      for (std::int64_t j = row_begin[i]; j < row_end[i]; ++j)
+      {
+        const std::size_t d = j * bs2 + k0 * _bs1;
+        const std::size_t xi = indices[j] * _bs1;
+        for (int k1 = 0; k1 < _bs1; ++k1)
+          vi += values[d + k1] * x[xi + k1];
+      }
+      y[i * bs0 + k0] += vi;
+    }
+  }
+}
+//-----------------------------------------------------------------------------
 } // namespace dolfinx::la
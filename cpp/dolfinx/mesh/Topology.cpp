@@ -95,10 +95,7 @@ determine_sharing_ranks(MPI_Comm comm, std::span<const std::int64_t> indices)
   std::sort(src.begin(), src.end());
 
   // Create neighbourhood communicator for sending data to post offices
-  MPI_Comm neigh_comm0;
-  MPI_Dist_graph_create_adjacent(comm, src.size(), src.data(), MPI_UNWEIGHTED,
-                                 dest.size(), dest.data(), MPI_UNWEIGHTED,
-                                 MPI_INFO_NULL, false, &neigh_comm0);
+  MPI_Comm neigh_comm0 = dolfinx::MPI::neighbourhood_comm(comm, src, dest);
 
   // Compute send displacements
   std::vector<std::int32_t> send_disp0(num_items_per_dest0.size() + 1, 0);
@@ -130,7 +127,6 @@ determine_sharing_ranks(MPI_Comm comm, std::span<const std::int64_t> indices)
                          send_disp0.data(), MPI_INT, recv_buffer0.data(),
                          num_items_recv0.data(), recv_disp0.data(), MPI_INT,
                          neigh_comm0);
-  MPI_Comm_free(&neigh_comm0);
 
   // -- Transpose
 
@@ -230,10 +226,7 @@ determine_sharing_ranks(MPI_Comm comm, std::span<const std::int64_t> indices)
   }
 
   // Send back
-  MPI_Comm neigh_comm1;
-  MPI_Dist_graph_create_adjacent(comm, dest.size(), dest.data(), MPI_UNWEIGHTED,
-                                 src.size(), src.data(), MPI_UNWEIGHTED,
-                                 MPI_INFO_NULL, false, &neigh_comm1);
+  MPI_Comm neigh_comm1 = dolfinx::MPI::neighbourhood_comm(comm, dest, src);
 
   // Send number of values to receive
   std::vector<int> num_items_recv1(dest.size());
@@ -253,7 +246,6 @@ determine_sharing_ranks(MPI_Comm comm, std::span<const std::int64_t> indices)
                          send_disp1.data(), MPI_INT, recv_buffer1.data(),
                          num_items_recv1.data(), recv_disp1.data(), MPI_INT,
                          neigh_comm1);
-  MPI_Comm_free(&neigh_comm1);
 
   // Build adjacency list
   std::vector<int> data;
@@ -432,10 +424,7 @@ exchange_indexing(MPI_Comm comm, std::span<const std::int64_t> indices,
   // Send/receive data
   std::vector<std::int64_t> recv_data;
   {
-    MPI_Comm comm0;
-    MPI_Dist_graph_create_adjacent(comm, src.size(), src.data(), MPI_UNWEIGHTED,
-                                   dest.size(), dest.data(), MPI_UNWEIGHTED,
-                                   MPI_INFO_NULL, false, &comm0);
+    MPI_Comm comm0 = dolfinx::MPI::neighbourhood_comm(comm, src, dest);
 
     // Prepare send sizes and send displacements
     std::vector<int> send_sizes;
@@ -467,7 +456,6 @@ exchange_indexing(MPI_Comm comm, std::span<const std::int64_t> indices,
                            MPI_INT64_T, recv_data.data(), recv_sizes.data(),
                            recv_disp.data(), MPI_INT64_T, comm0);
 
-    MPI_Comm_free(&comm0);
   }
 
   return recv_data;
@@ -517,12 +505,9 @@ std::vector<std::array<std::int64_t, 3>> exchange_ghost_indexing(
   // Note: the ghost cell owner might not be the same as the vertex
   // owner.
 
-  MPI_Comm comm;
   std::span src = map0.src();
   std::span dest = map0.dest();
-  MPI_Dist_graph_create_adjacent(map0.comm(), src.size(), src.data(),
-                                 MPI_UNWEIGHTED, dest.size(), dest.data(),
-                                 MPI_UNWEIGHTED, MPI_INFO_NULL, false, &comm);
+  MPI_Comm comm = dolfinx::MPI::neighbourhood_comm(map0.comm(), src, dest);
 
   // --
 
@@ -531,10 +516,7 @@ std::vector<std::array<std::int64_t, 3>> exchange_ghost_indexing(
 
   {
     // -- Send cell ghost indices to owner
-    MPI_Comm comm1;
-    MPI_Dist_graph_create_adjacent(
-        map0.comm(), dest.size(), dest.data(), MPI_UNWEIGHTED, src.size(),
-        src.data(), MPI_UNWEIGHTED, MPI_INFO_NULL, false, &comm1);
+    MPI_Comm comm1 = dolfinx::MPI::neighbourhood_comm(map0.comm(), dest, src);
 
     // Build list of (owner rank, index) pairs for each ghost index, and
     // sort
@@ -583,7 +565,6 @@ std::vector<std::array<std::int64_t, 3>> exchange_ghost_indexing(
                            send_disp.data(), MPI_INT64_T, recv_buffer.data(),
                            recv_sizes.data(), recv_disp.data(), MPI_INT64_T,
                            comm1);
-    MPI_Comm_free(&comm1);
 
     // Iterate over ranks that ghost cells owned by this rank
     auto local_range = map0.local_range();
@@ -675,8 +656,6 @@ std::vector<std::array<std::int64_t, 3>> exchange_ghost_indexing(
   std::sort(data.begin(), data.end());
   data.erase(std::unique(data.begin(), data.end()), data.end());
 
-  MPI_Comm_free(&comm);
-
   return data;
 }
 
@@ -16,4 +16,6 @@ namespace dolfinx::mesh
 #include <dolfinx/mesh/Topology.h>
 #include <dolfinx/mesh/cell_types.h>
 #include <dolfinx/mesh/generation.h>
+#include <dolfinx/mesh/geometricpartition.h>
+#include <dolfinx/mesh/rebalance.h>
 #include <dolfinx/mesh/utils.h>
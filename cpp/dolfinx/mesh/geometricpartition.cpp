@@ -0,0 +1,370 @@
+// Copyright (C) 2026 agent
+//
+// This file is part of DOLFINx (https://www.fenicsproject.org)
+//
+// SPDX-License-Identifier:    LGPL-3.0-or-later
+
+#include "geometricpartition.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <dolfinx/common/MPI.h>
+#include <dolfinx/common/Timer.h>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+using namespace dolfinx;
+
+namespace
+{
+/// Point key. The first entry is the geometric key and the second
+/// entry is the global index of the point, which makes keys unique.
+using key_t = std::array<std::uint64_t, 2>;
+
+/// Map a floating point number to an unsigned integer with the same
+/// ordering
+std::uint64_t ordered_bits(double x)
+{
+  const auto b = std::bit_cast<std::uint64_t>(x);
+  return (b >> 63) ? ~b : (b | (std::uint64_t(1) << 63));
+}
+
+/// @brief Compute the index of a point along a Hilbert curve.
+///
+/// Uses the algorithm in J. Skilling, Programming the Hilbert curve,
+/// AIP Conference Proceedings 707 (2004),
+/// https://doi.org/10.1063/1.1751381.
+///
+/// @param[in] X Integer coordinates of the point, with `b` bits.
+/// @param[in] n Number of coordinates (dimension).
+/// @param[in] b Number of bits for each coordinate.
+/// @return Hilbert index, with `n * b` bits.
+std::uint64_t hilbert_index(std::array<std::uint32_t, 3> X, int n, int b)
+{
+  const std::uint32_t M = std::uint32_t(1) << (b - 1);
+
+  // Inverse undo
+  for (std::uint32_t Q = M; Q > 1; Q >>= 1)
+  {
+    const std::uint32_t P = Q - 1;
+    for (int i = 0; i < n; ++i)
+    {
+      if (X[i] & Q)
+        X[0] ^= P;
+      else
+      {
+        const std::uint32_t t = (X[0] ^ X[i]) & P;
+        X[0] ^= t;
+        X[i] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  for (int i = 1; i < n; ++i)
+    X[i] ^= X[i - 1];
+  std::uint32_t t = 0;
+  for (std::uint32_t Q = M; Q > 1; Q >>= 1)
+  {
+    if (X[n - 1] & Q)
+      t ^= Q - 1;
+  }
+  for (int i = 0; i < n; ++i)
+    X[i] ^= t;
+
+  // Interleave the bits of the transposed index
+  std::uint64_t h = 0;
+  for (int j = b - 1; j >= 0; --j)
+    for (int i = 0; i < n; ++i)
+      h = (h << 1) | ((X[i] >> j) & 1);
+  return h;
+}
+
+/// @brief Find the keys that split groups of keys at given ranks.
+///
+/// For each query `q`, the returned key `s` satisfies: the number of
+/// keys in group `groups[q]` (across all ranks) that are less than `s`
+/// is `targets[q]`. The search sets one bit of each key per step.
+///
+/// @note Collective.
+///
+/// @param[in] comm MPI communicator.
+/// @param[in] keys Unique keys, sorted within each group.
+/// @param[in] offsets Offsets into `keys` for each group.
+/// @param[in] groups Group of each query.
+/// @param[in] targets Number of keys (on all ranks) in the group that
+/// are less than the splitting key of each query.
+/// @return Splitting key for each query.
+std::vector<key_t> find_splitters(MPI_Comm comm, std::span<const key_t> keys,
+                                  std::span<const std::int32_t> offsets,
+                                  std::span<const std::int32_t> groups,
+                                  std::span<const std::int64_t> targets)
+{
+  // Find the largest key `v` such that fewer than `target` keys are
+  // less than `v`. This is the key with rank `target`, and the
+  // splitter is the next key.
+  std::vector<key_t> v(targets.size(), {0, 0});
+  std::vector<std::int64_t> count(targets.size());
+  std::vector<std::int64_t> count_global(targets.size());
+  for (int bit = 127; bit >= 0; --bit)
+  {
+    for (std::size_t q = 0; q < targets.size(); ++q)
+    {
+      key_t trial = v[q];
+      trial[bit >= 64 ? 0 : 1] |= std::uint64_t(1) << (bit % 64);
+      auto first = std::next(keys.begin(), offsets[groups[q]]);
+      auto last = std::next(keys.begin(), offsets[groups[q] + 1]);
+      count[q] = std::distance(first, std::lower_bound(first, last, trial));
+    }
+
+    MPI_Allreduce(count.data(), count_global.data(), count.size(),
+                  MPI_INT64_T, MPI_SUM, comm);
+    for (std::size_t q = 0; q < targets.size(); ++q)
+    {
+      if (count_global[q] < targets[q])
+      {
+        v[q][bit >= 64 ? 0 : 1] |= std::uint64_t(1) << (bit % 64);
+      }
+    }
+  }
+
+  // Splitter is the key that follows v, or zero if the target is zero
+  for (std::size_t q = 0; q < targets.size(); ++q)
+  {
+    if (targets[q] == 0)
+      v[q] = {0, 0};
+    else if (++v[q][1] == 0)
+      ++v[q][0];
+  }
+
+  return v;
+}
+
+/// Partition points by ordering along a Hilbert curve
+std::vector<std::int32_t> partition_hilbert(MPI_Comm comm, int nparts,
+                                            std::span<const double> x,
+                                            int gdim, std::int64_t offset,
+                                            std::int64_t num_points_global)
+{
+  const std::size_t num_points = x.size() / 3;
+
+  // Compute bounding box of all points
+  std::array<double, 6> bbox_local;
+  std::fill_n(bbox_local.begin(), 6, std::numeric_limits<double>::max());
+  for (std::size_t i = 0; i < num_points; ++i)
+  {
+    for (int j = 0; j < 3; ++j)
+    {
+      bbox_local[j] = std::min(bbox_local[j], x[3 * i + j]);
+      bbox_local[3 + j] = std::min(bbox_local[3 + j], -x[3 * i + j]);
+    }
+  }
+  std::array<double, 6> bbox;
+  MPI_Allreduce(bbox_local.data(), bbox.data(), 6, MPI_DOUBLE, MPI_MIN, comm);
+
+  // Compute Hilbert curve keys. In 1D the key is the coordinate.
+  const int b = gdim > 1 ? 63 / gdim : 0;
+  const double scale = b > 0 ? double((std::uint64_t(1) << b) - 1) : 0;
+  std::vector<key_t> keys(num_points);
+  for (std::size_t i = 0; i < num_points; ++i)
+  {
+    std::uint64_t h = 0;
+    if (gdim == 1)
+      h = ordered_bits(x[3 * i]);
+    else
+    {
+      std::array<std::uint32_t, 3> X = {0, 0, 0};
+      for (int j = 0; j < gdim; ++j)
+      {
+        const double x0 = bbox[j];
+        const double dx = -bbox[3 + j] - x0;
+        if (dx > 0)
+          X[j] = static_cast<std::uint32_t>((x[3 * i + j] - x0) / dx * scale);
+      }
+      h = hilbert_index(X, gdim, b);
+    }
+    keys[i] = {h, static_cast<std::uint64_t>(offset + i)};
+  }
+
+  // Split the curve into parts with the same number of points
+  std::vector<key_t> sorted_keys = keys;
+  std::sort(sorted_keys.begin(), sorted_keys.end());
+  std::vector<std::int32_t> groups(nparts - 1, 0);
+  std::vector<std::int64_t> targets(nparts - 1);
+  for (int p = 1; p < nparts; ++p)
+    targets[p - 1] = num_points_global * p / nparts;
+  std::array<std::int32_t, 2> offsets = {0, (std::int32_t)num_points};
+  const std::vector<key_t> splitters
+      = find_splitters(comm, sorted_keys, offsets, groups, targets);
+
+  std::vector<std::int32_t> parts(num_points);
+  for (std::size_t i = 0; i < num_points; ++i)
+  {
+    auto it = std::upper_bound(splitters.begin(), splitters.end(), keys[i]);
+    parts[i] = std::distance(splitters.begin(), it);
+  }
+
+  return parts;
+}
+
+/// Partition points by recursive coordinate bisection
+std::vector<std::int32_t> partition_rcb(MPI_Comm comm, int nparts,
+                                        std::span<const double> x, int gdim,
+                                        std::int64_t offset)
+{
+  const std::size_t num_points = x.size() / 3;
+
+  // The part of each point is the first part of the range of parts
+  // that the point has been assigned to. The range of parts for each
+  // group of points is bisected recursively.
+  std::vector<std::int32_t> parts(num_points, 0);
+  std::vector<std::array<std::int32_t, 2>> ranges = {{0, nparts}};
+  std::vector<std::int32_t> group(nparts, -1);
+  while (!ranges.empty())
+  {
+    const std::size_t num_groups = ranges.size();
+    for (std::size_t g = 0; g < num_groups; ++g)
+      group[ranges[g][0]] = g;
+
+    // Compute bounding box and number of points of each group
+    std::vector<double> bbox_local(6 * num_groups,
+                                   std::numeric_limits<double>::max());
+    std::vector<std::int64_t> num_local(num_groups, 0);
+    for (std::size_t i = 0; i < num_points; ++i)
+    {
+      if (std::int32_t g = group[parts[i]]; g >= 0)
+      {
+        ++num_local[g];
+        for (int j = 0; j < 3; ++j)
+        {
+          bbox_local[6 * g + j] = std::min(bbox_local[6 * g + j], x[3 * i + j]);
+          bbox_local[6 * g + 3 + j]
+              = std::min(bbox_local[6 * g + 3 + j], -x[3 * i + j]);
+        }
+      }
+    }
+    std::vector<double> bbox(bbox_local.size());
+    MPI_Allreduce(bbox_local.data(), bbox.data(), bbox.size(), MPI_DOUBLE,
+                  MPI_MIN, comm);
+    std::vector<std::int64_t> num_global(num_groups);
+    MPI_Allreduce(num_local.data(), num_global.data(), num_groups,
+                  MPI_INT64_T, MPI_SUM, comm);
+
+    // Bisect each group along the direction of largest extent
+    std::vector<int> axis(num_groups, 0);
+    for (std::size_t g = 0; g < num_groups; ++g)
+    {
+      for (int j = 1; j < gdim; ++j)
+      {
+        if (-bbox[6 * g + 3 + j] - bbox[6 * g + j]
+            > -bbox[6 * g + 3 + axis[g]] - bbox[6 * g + axis[g]])
+        {
+          axis[g] = j;
+        }
+      }
+    }
+
+    // Sort the points of each group by the coordinate in the bisection
+    // direction
+    std::vector<std::int32_t> offsets(num_groups + 1, 0);
+    for (std::size_t g = 0; g < num_groups; ++g)
+      offsets[g + 1] = offsets[g] + num_local[g];
+    std::vector<key_t> keys(offsets.back());
+    {
+      std::vector<std::int32_t> pos(offsets.begin(), std::prev(offsets.end()));
+      for (std::size_t i = 0; i < num_points; ++i)
+      {
+        if (std::int32_t g = group[parts[i]]; g >= 0)
+        {
+          keys[pos[g]++] = {ordered_bits(x[3 * i + axis[g]]),
+                            static_cast<std::uint64_t>(offset + i)};
+        }
+      }
+    }
+    for (std::size_t g = 0; g < num_groups; ++g)
+    {
+      std::sort(std::next(keys.begin(), offsets[g]),
+                std::next(keys.begin(), offsets[g + 1]));
+    }
+
+    // Split each group in proportion to the number of parts on each
+    // side of the bisection
+    std::vector<std::int32_t> groups(num_groups);
+    std::iota(groups.begin(), groups.end(), 0);
+    std::vector<std::int64_t> targets(num_groups);
+    for (std::size_t g = 0; g < num_groups; ++g)
+    {
+      const std::int64_t np = ranges[g][1] - ranges[g][0];
+      targets[g] = num_global[g] * (np / 2) / np;
+    }
+    const std::vector<key_t> splitters
+        = find_splitters(comm, keys, offsets, groups, targets);
+
+    // Move points above the splitter to the upper range of parts
+    for (std::size_t i = 0; i < num_points; ++i)
+    {
+      if (std::int32_t g = group[parts[i]]; g >= 0)
+      {
+        key_t key = {ordered_bits(x[3 * i + axis[g]]),
+                     static_cast<std::uint64_t>(offset + i)};
+        if (key >= splitters[g])
+        {
+          const std::int32_t np = ranges[g][1] - ranges[g][0];
+          parts[i] = ranges[g][0] + np / 2;
+        }
+      }
+    }
+
+    // Ranges of parts for the next level
+    std::vector<std::array<std::int32_t, 2>> ranges_next;
+    for (auto [p0, p1] : ranges)
+    {
+      group[p0] = -1;
+      const std::int32_t pm = p0 + (p1 - p0) / 2;
+      if (pm - p0 > 1)
+        ranges_next.push_back({p0, pm});
+      if (p1 - pm > 1)
+        ranges_next.push_back({pm, p1});
+    }
+    ranges = std::move(ranges_next);
+  }
+
+  return parts;
+}
+} // namespace
+
+//-----------------------------------------------------------------------------
+std::vector<std::int32_t>
+mesh::impl::partition_points(MPI_Comm comm, int nparts,
+                             std::span<const double> x, int gdim,
+                             GeometricPartitionMethod method)
+{
+  common::Timer timer("Compute geometric partition of points");
+
+  assert(x.size() % 3 == 0);
+  const std::int64_t num_points = x.size() / 3;
+  if (nparts == 1)
+    return std::vector<std::int32_t>(num_points, 0);
+
+  std::int64_t offset = 0;
+  MPI_Exscan(&num_points, &offset, 1, MPI_INT64_T, MPI_SUM, comm);
+
+  switch (method)
+  {
+  case GeometricPartitionMethod::rcb:
+    return partition_rcb(comm, nparts, x, gdim, offset);
+  case GeometricPartitionMethod::hilbert:
+  {
+    std::int64_t num_points_global = 0;
+    MPI_Allreduce(&num_points, &num_points_global, 1, MPI_INT64_T, MPI_SUM,
+                  comm);
+    return partition_hilbert(comm, nparts, x, gdim, offset,
+                             num_points_global);
+  }
+  default:
+    throw std::runtime_error("Unknown geometric partitioning method.");
+  }
+}
+//-----------------------------------------------------------------------------
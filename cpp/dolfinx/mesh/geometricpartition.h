@@ -0,0 +1,137 @@
+// Copyright (C) 2026 agent
+//
+// This file is part of DOLFINx (https://www.fenicsproject.org)
+//
+// SPDX-License-Identifier:    LGPL-3.0-or-later
+
+#pragma once
+
+#include "cell_types.h"
+#include "utils.h"
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <dolfinx/common/MPI.h>
+#include <dolfinx/common/Timer.h>
+#include <dolfinx/common/log.h>
+#include <dolfinx/common/sort.h>
+#include <dolfinx/graph/AdjacencyList.h>
+#include <memory>
+#include <mpi.h>
+#include <span>
+#include <vector>
+
+/// @file geometricpartition.h
+/// @brief Partitioning of mesh cells using the cell coordinates.
+
+namespace dolfinx::mesh
+{
+/// @brief Geometric partitioning methods.
+enum class GeometricPartitionMethod : int
+{
+  rcb,    ///< Recursive coordinate bisection
+  hilbert ///< Ordering along a Hilbert space-filling curve
+};
+
+namespace impl
+{
+/// @brief Partition a distributed set of points using their
+/// coordinates.
+///
+/// Each part has (up to rounding) the same number of points.
+///
+/// @note Collective.
+///
+/// @param[in] comm MPI communicator that the points are distributed
+/// across.
+/// @param[in] nparts Number of parts.
+/// @param[in] x Point coordinates, with shape `(num_points, 3)`.
+/// Storage is row-major.
+/// @param[in] gdim Geometric dimension of the points.
+/// @param[in] method Partitioning method.
+/// @return Part for each point.
+std::vector<std::int32_t> partition_points(MPI_Comm comm, int nparts,
+                                           std::span<const double> x,
+                                           int gdim,
+                                           GeometricPartitionMethod method);
+} // namespace impl
+
+/// @brief Create a function that computes destination ranks for mesh
+/// cells by partitioning the cell midpoints geometrically.
+///
+/// The partitioner does not build the dual graph of the mesh, and does
+/// not use an external graph partitioning library. It is much cheaper
+/// than graph partitioning, which makes it well suited to the initial
+/// distribution of very large meshes and to quick repartitioning. The
+/// number of cells in each part is balanced, but the number of shared
+/// facets is usually larger than for a graph partitioner.
+///
+/// The midpoint of a cell is computed from the coordinates of its
+/// vertices. The coordinates `x` are the same data as is passed to
+/// mesh::create_mesh, and must be distributed across the communicator
+/// that the partitioner is called with.
+///
+/// @note The partitioner does not compute ghost cells. It should be
+/// used only for meshes with GhostMode::none.
+///
+/// @param[in] x Geometry data ('node' coordinates) on this rank.
+/// Row-major storage. The global index of the `i`th node (row) in `x`
+/// is `i` plus the offset for this rank.
+/// @param[in] xshape Shape of `x`.
+/// @param[in] method Partitioning method.
+/// @return Function that computes the destination ranks for each cell.
+template <std::floating_point T>
+CellPartitionFunction create_geometric_partitioner(
+    std::span<const T> x, std::array<std::size_t, 2> xshape,
+    GeometricPartitionMethod method = GeometricPartitionMethod::hilbert)
+{
+  assert(x.size() == xshape[0] * xshape[1]);
+  auto _x = std::make_shared<const std::vector<T>>(x.begin(), x.end());
+  const int gdim = xshape[1];
+  return [_x, gdim, method](
+             MPI_Comm comm, int nparts, const std::vector<CellType>& cell_types,
+             const std::vector<std::span<const std::int64_t>>& cells)
+             -> graph::AdjacencyList<std::int32_t>
+  {
+    spdlog::info("Compute geometric partition of cells across ranks");
+    common::Timer timer("Compute geometric partition of cells");
+
+    // Fetch coordinates of the cell vertices
+    std::vector<std::int64_t> vertices;
+    for (auto c : cells)
+      vertices.insert(vertices.end(), c.begin(), c.end());
+    dolfinx::radix_sort(std::span(vertices));
+    vertices.erase(std::unique(vertices.begin(), vertices.end()),
+                   vertices.end());
+    const std::vector<T> xv
+        = dolfinx::MPI::distribute_data(comm, vertices, comm, *_x, gdim);
+
+    // Compute cell midpoints
+    std::vector<double> midpoints;
+    for (std::size_t i = 0; i < cells.size(); ++i)
+    {
+      const int num_vertices = mesh::num_cell_vertices(cell_types[i]);
+      for (std::size_t c = 0; c < cells[i].size(); c += num_vertices)
+      {
+        std::array<double, 3> p = {0, 0, 0};
+        for (int v = 0; v < num_vertices; ++v)
+        {
+          auto it = std::lower_bound(vertices.begin(), vertices.end(),
+                                     cells[i][c + v]);
+          assert(it != vertices.end() and *it == cells[i][c + v]);
+          std::size_t pos = std::distance(vertices.begin(), it);
+          for (int j = 0; j < gdim; ++j)
+            p[j] += xv[pos * gdim + j];
+        }
+        for (double pj : p)
+          midpoints.push_back(pj / num_vertices);
+      }
+    }
+
+    return graph::regular_adjacency_list(
+        impl::partition_points(comm, nparts, midpoints, gdim, method), 1);
+  };
+}
+
+} // namespace dolfinx::mesh
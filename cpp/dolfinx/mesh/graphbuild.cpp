@@ -171,10 +171,7 @@ graph::AdjacencyList<std::int64_t> compute_nonlocal_dual_graph(
 
   // Create neighbourhood communicator for sending data to
   // post offices
-  MPI_Comm neigh_comm0;
-  MPI_Dist_graph_create_adjacent(comm, src.size(), src.data(), MPI_UNWEIGHTED,
-                                 dest.size(), dest.data(), MPI_UNWEIGHTED,
-                                 MPI_INFO_NULL, false, &neigh_comm0);
+  MPI_Comm neigh_comm0 = dolfinx::MPI::neighbourhood_comm(comm, src, dest);
 
   // Compute send displacements
   std::vector<std::int32_t> send_disp(num_items_per_dest.size() + 1, 0);
@@ -226,7 +223,6 @@ graph::AdjacencyList<std::int64_t> compute_nonlocal_dual_graph(
                          neigh_comm0);
 
   MPI_Type_free(&compound_type);
-  MPI_Comm_free(&neigh_comm0);
 
   // Search for consecutive facets (-> dual graph edge between cells)
   // and pack into send buffer
@@ -283,10 +279,7 @@ graph::AdjacencyList<std::int64_t> compute_nonlocal_dual_graph(
 
   // Create neighbourhood communicator for sending data from post
   // offices
-  MPI_Comm neigh_comm1;
-  MPI_Dist_graph_create_adjacent(comm, dest.size(), dest.data(), MPI_UNWEIGHTED,
-                                 src.size(), src.data(), MPI_UNWEIGHTED,
-                                 MPI_INFO_NULL, false, &neigh_comm1);
+  MPI_Comm neigh_comm1 = dolfinx::MPI::neighbourhood_comm(comm, dest, src);
 
   // Send back data
   std::vector<std::int64_t> recv_buffer1(send_disp.back());
@@ -294,7 +287,6 @@ graph::AdjacencyList<std::int64_t> compute_nonlocal_dual_graph(
                          recv_disp.data(), MPI_INT64_T, recv_buffer1.data(),
                          num_items_per_dest.data(), send_disp.data(),
                          MPI_INT64_T, neigh_comm1);
-  MPI_Comm_free(&neigh_comm1);
 
   // --- Build new graph
 
@@ -0,0 +1,61 @@
+// Copyright (C) 2026 agent
+//
+// This file is part of DOLFINx (https://www.fenicsproject.org)
+//
+// SPDX-License-Identifier:    LGPL-3.0-or-later
+
+#include "rebalance.h"
+#include <algorithm>
+#include <cmath>
+#include <dolfinx/common/IndexMap.h>
+#include <dolfinx/common/MPI.h>
+
+using namespace dolfinx;
+
+//-----------------------------------------------------------------------------
+double mesh::load_imbalance(MPI_Comm comm, double load)
+{
+  double max_load = 0;
+  double total = 0;
+  MPI_Allreduce(&load, &max_load, 1, MPI_DOUBLE, MPI_MAX, comm);
+  MPI_Allreduce(&load, &total, 1, MPI_DOUBLE, MPI_SUM, comm);
+  if (total == 0)
+    return -1;
+  else
+    return max_load * dolfinx::MPI::size(comm) / total;
+}
+//-----------------------------------------------------------------------------
+std::vector<double> mesh::cell_weights(const Topology& topology, double load)
+{
+  auto map = topology.index_map(topology.dim());
+  assert(map);
+  const std::int32_t num_cells = map->size_local();
+  return std::vector<double>(num_cells, num_cells > 0 ? load / num_cells : 0);
+}
+//-----------------------------------------------------------------------------
+std::vector<std::int32_t>
+mesh::partition_weights(MPI_Comm comm, std::span<const double> weights)
+{
+  double local_max = 0;
+  for (double w : weights)
+    local_max = std::max(local_max, w);
+  double max = 0;
+  MPI_Allreduce(&local_max, &max, 1, MPI_DOUBLE, MPI_MAX, comm);
+
+  // Use unit weights if all weights are zero
+  if (max <= 0)
+    return std::vector<std::int32_t>(weights.size(), 1);
+
+  // Scale weights to (0, 100]. Cells with a positive weight get a
+  // weight of at least one.
+  std::vector<std::int32_t> scaled(weights.size());
+  std::transform(weights.begin(), weights.end(), scaled.begin(),
+                 [max](auto w) -> std::int32_t
+                 {
+                   if (w <= 0)
+                     return 0;
+                   return std::max(1L, std::lround(100 * w / max));
+                 });
+  return scaled;
+}
+//-----------------------------------------------------------------------------
@@ -0,0 +1,376 @@
+// Copyright (C) 2026 agent
+//
+// This file is part of DOLFINx (https://www.fenicsproject.org)
+//
+// SPDX-License-Identifier:    LGPL-3.0-or-later
+
+#pragma once
+
+#include "Mesh.h"
+#include "MeshTags.h"
+#include "Topology.h"
+#include "utils.h"
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <dolfinx/common/IndexMap.h>
+#include <dolfinx/common/MPI.h>
+#include <dolfinx/common/Timer.h>
+#include <dolfinx/graph/AdjacencyList.h>
+#include <dolfinx/graph/partition.h>
+#include <mpi.h>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// @file rebalance.h
+/// @brief Diagnostics for the parallel load balance of a mesh, and
+/// redistribution of a mesh and its data to balance the load.
+
+namespace dolfinx::mesh
+{
+namespace impl
+{
+/// @brief Store a tag value in an `std::int64_t`, so that it can be
+/// sent in the same row as `std::int64_t` data.
+template <typename U>
+std::int64_t pack_value(U value)
+{
+  static_assert(sizeof(U) <= sizeof(std::int64_t)
+                and std::is_trivially_copyable_v<U>);
+  std::int64_t packed = 0;
+  std::memcpy(&packed, &value, sizeof(U));
+  return packed;
+}
+
+/// @brief Extract a tag value stored by impl::pack_value.
+template <typename U>
+U unpack_value(std::int64_t packed)
+{
+  U value;
+  std::memcpy(&value, &packed, sizeof(U));
+  return value;
+}
+
+/// @brief Compute a key for mesh entities that is independent of the
+/// parallel distribution of the mesh.
+///
+/// The key of an entity is the sorted list of the global indices of
+/// the geometry nodes in the closure of the entity.
+///
+/// @param[in] mesh The mesh.
+/// @param[in] dim Topological dimension of the entities.
+/// @param[in] entities Entity indices (local to process).
+/// @return Keys with shape `(num_entities, num_nodes_per_entity)`.
+/// Storage is row-major.
+template <std::floating_point T>
+std::vector<std::int64_t> entity_keys(const Mesh<T>& mesh, int dim,
+                                      std::span<const std::int32_t> entities)
+{
+  const int tdim = mesh.topology()->dim();
+  mesh.topology_mutable()->create_connectivity(dim, tdim);
+  mesh.topology_mutable()->create_connectivity(tdim, dim);
+
+  const std::vector<std::int32_t> nodes
+      = entities_to_geometry(mesh, dim, entities, false);
+  std::vector<std::int64_t> keys(nodes.size());
+  mesh.geometry().index_map()->local_to_global(nodes, keys);
+  if (!entities.empty())
+  {
+    const std::size_t num_nodes = keys.size() / entities.size();
+    for (auto it = keys.begin(); it != keys.end(); it += num_nodes)
+      std::sort(it, std::next(it, num_nodes));
+  }
+
+  return keys;
+}
+} // namespace impl
+
+/// @brief Compute the load imbalance across ranks.
+///
+/// The imbalance is the maximum load on any rank divided by the mean
+/// load over all ranks. A perfectly balanced distribution has an
+/// imbalance of 1.
+///
+/// @note Collective.
+///
+/// @param[in] comm MPI communicator.
+/// @param[in] load Load on the calling rank. This can be a measured
+/// cost, e.g. the wall time spent in assembly and in the linear solver
+/// (see common::Timer), or a sum of cell weights.
+/// @return The imbalance. If the total load is zero, -1 is returned.
+double load_imbalance(MPI_Comm comm, double load);
+
+/// @brief Compute cell weights from a measured load on each rank.
+///
+/// The load on the calling rank is divided equally between its owned
+/// cells. This gives the average cost of a cell on each rank. The
+/// weights can be passed to mesh::rebalance, e.g. after measuring the
+/// time spent in assembly and in the solver.
+///
+/// @param[in] topology Mesh topology.
+/// @param[in] load Load on the calling rank.
+/// @return Weight of each owned cell.
+std::vector<double> cell_weights(const Topology& topology, double load);
+
+/// @brief Convert cell weights to the integer node weights used by
+/// graph partitioners.
+///
+/// The weights are scaled such that the largest weight on any rank is
+/// 100, and are rounded to the nearest integer.
+///
+/// @note Collective.
+///
+/// @param[in] comm MPI communicator that the cells are distributed
+/// across.
+/// @param[in] weights Weight of each cell on the calling rank.
+/// @return Integer weight of each cell. If all weights are zero, all
+/// cells have unit weight.
+std::vector<std::int32_t> partition_weights(MPI_Comm comm,
+                                            std::span<const double> weights);
+
+/// @brief Redistribute a mesh using a cell partitioning function.
+///
+/// The owned cells of `mesh` are passed to `partitioner` in their local
+/// order, so a partitioner can use data (e.g. weights) that is attached
+/// to the owned cells. The original cell index (see
+/// Topology::original_cell_index) of a cell in the returned mesh is
+/// the global index of the cell in `mesh`. The input global index of a
+/// geometry node (see Geometry::input_global_indices) in the returned
+/// mesh is the global index of the node in `mesh`.
+///
+/// MeshTags are moved to the new mesh by ::migrate_meshtags. Functions
+/// are moved by interpolation between the meshes (see
+/// fem::create_interpolation_data and fem::InterpolationPlan), which is
+/// exact since the two meshes have the same geometry.
+///
+/// @note Collective.
+///
+/// @param[in] mesh Mesh to redistribute.
+/// @param[in] partitioner Cell partitioning function.
+/// @return The redistributed mesh.
+template <std::floating_point T>
+Mesh<T> rebalance(const Mesh<T>& mesh, const CellPartitionFunction& partitioner)
+{
+  common::Timer timer("Rebalance mesh");
+
+  auto topology = mesh.topology();
+  assert(topology);
+  const int tdim = topology->dim();
+  if (topology->entity_types(tdim).size() != 1)
+    throw std::runtime_error("Cannot rebalance a mixed-topology mesh.");
+
+  // Owned cells, defined by the global index of the geometry nodes
+  const Geometry<T>& geometry = mesh.geometry();
+  auto x_dofmap = geometry.dofmap();
+  const std::int32_t num_cells = topology->index_map(tdim)->size_local();
+  const std::size_t num_cell_nodes = x_dofmap.extent(1);
+  std::vector<std::int32_t> nodes(num_cells * num_cell_nodes);
+  for (std::int32_t c = 0; c < num_cells; ++c)
+    for (std::size_t i = 0; i < num_cell_nodes; ++i)
+      nodes[c * num_cell_nodes + i] = x_dofmap(c, i);
+  std::vector<std::int64_t> cells(nodes.size());
+  geometry.index_map()->local_to_global(nodes, cells);
+
+  // Coordinates of owned geometry nodes
+  const std::size_t gdim = geometry.dim();
+  const std::size_t num_nodes = geometry.index_map()->size_local();
+  std::span<const T> x_g = geometry.x();
+  std::vector<T> x(num_nodes * gdim);
+  for (std::size_t i = 0; i < num_nodes; ++i)
+    for (std::size_t j = 0; j < gdim; ++j)
+      x[i * gdim + j] = x_g[3 * i + j];
+
+  return create_mesh(mesh.comm(), mesh.comm(),
+                     std::span<const std::int64_t>(cells), geometry.cmap(),
+                     mesh.comm(), x, {num_nodes, gdim}, partitioner);
+}
+
+/// @brief Redistribute a mesh to balance the total weight of cells
+/// across ranks, if the load imbalance exceeds a threshold.
+///
+/// Cells are redistributed by a weighted partitioning of the dual
+/// graph of the mesh (see mesh::create_cell_partitioner), with the
+/// cell weights as node weights.
+///
+/// @note Collective.
+///
+/// @param[in] mesh Mesh to redistribute.
+/// @param[in] weights Weight of each owned cell, e.g. from
+/// mesh::cell_weights.
+/// @param[in] threshold The mesh is redistributed only if the load
+/// imbalance (see mesh::load_imbalance) is greater than this value.
+/// @param[in] ghost_mode Type of ghosting of the redistributed mesh.
+/// @param[in] partfn Weighted graph partitioning function.
+/// @return The redistributed mesh, or `std::nullopt` if the load
+/// imbalance is below the threshold.
+template <std::floating_point T>
+std::optional<Mesh<T>>
+rebalance(const Mesh<T>& mesh, std::span<const double> weights,
+          double threshold = 1.1, GhostMode ghost_mode = GhostMode::none,
+          const graph::weighted_partition_fn& partfn
+          = &graph::weighted_partition_graph)
+{
+  assert(mesh.topology());
+  const int tdim = mesh.topology()->dim();
+  auto cell_map = mesh.topology()->index_map(tdim);
+  assert(cell_map);
+  if (weights.size() != (std::size_t)cell_map->size_local())
+    throw std::runtime_error("Number of weights and owned cells differ.");
+
+  const double load = std::reduce(weights.begin(), weights.end(), 0.0);
+  if (load_imbalance(mesh.comm(), load) <= threshold)
+    return std::nullopt;
+
+  // The owned cells are passed to the partitioner in their local order
+  // (see mesh::rebalance), so the weights apply to the cells as given
+  std::vector<std::int32_t> node_weights
+      = partition_weights(mesh.comm(), weights);
+  auto cost = [&node_weights](const std::vector<CellType>&,
+                              const std::vector<std::span<const std::int64_t>>&)
+  { return node_weights; };
+  return rebalance(mesh, create_cell_partitioner(ghost_mode, cost, 1, partfn));
+}
+
+/// @brief Move MeshTags to a redistributed copy of a mesh.
+///
+/// The meshes must have the same geometry and geometry node global
+/// indices, e.g. `mesh1` is created from `mesh0` by mesh::rebalance.
+/// Entities are matched using the global indices of their geometry
+/// nodes.
+///
+/// @note Collective.
+///
+/// @param[in] tags MeshTags on `mesh0`.
+/// @param[in] mesh0 Mesh that `tags` is defined on.
+/// @param[in] mesh1 Redistributed mesh.
+/// @return MeshTags on `mesh1`. All entities on the calling rank
+/// (owned and ghost) that have a tag are included.
+/// @pre The tag value type `U` is trivially copyable and is at most 8
+/// bytes in size.
+template <typename U, std::floating_point T>
+MeshTags<U> migrate_meshtags(const MeshTags<U>& tags, const Mesh<T>& mesh0,
+                             const Mesh<T>& mesh1)
+{
+  common::Timer timer("Migrate MeshTags");
+
+  MPI_Comm comm = mesh0.comm();
+  const int size = dolfinx::MPI::size(comm);
+  const int dim = tags.dim();
+  const std::int64_t num_nodes_g = mesh0.geometry().index_map()->size_global();
+
+  // Send (key, value) of each tagged entity to the post office for
+  // the key
+  const std::size_t shape1 = mesh0.geometry()
+                                .cmap()
+                                .create_dof_layout()
+                                .num_entity_closure_dofs(dim);
+  std::span<const std::int32_t> entities0 = tags.indices();
+  std::span<const U> values0 = tags.values();
+  std::vector<std::int64_t> keys0 = impl::entity_keys(mesh0, dim, entities0);
+  assert(keys0.size() == entities0.size() * shape1);
+
+  auto post_office = [size, num_nodes_g](auto key)
+  { return dolfinx::MPI::index_owner(size, key.front(), num_nodes_g); };
+  std::vector<int> dest0;
+  std::vector<std::int64_t> rows0;
+  dest0.reserve(entities0.size());
+  rows0.reserve(entities0.size() * (shape1 + 1));
+  for (std::size_t e = 0; e < entities0.size(); ++e)
+  {
+    std::span k(keys0.data() + e * shape1, shape1);
+    dest0.push_back(post_office(k));
+    rows0.insert(rows0.end(), k.begin(), k.end());
+    rows0.push_back(impl::pack_value(values0[e]));
+  }
+  const std::vector<std::int64_t> post_rows
+      = dolfinx::MPI::send_rows<std::int64_t>(comm, dest0, rows0, shape1 + 1)
+            .first;
+
+  // Sort post office (key, value) rows by key
+  std::vector<std::int32_t> perm(post_rows.size() / (shape1 + 1));
+  std::iota(perm.begin(), perm.end(), 0);
+  auto key = [&post_rows, shape1](auto i)
+  { return std::span(post_rows.data() + i * (shape1 + 1), shape1); };
+  std::sort(perm.begin(), perm.end(),
+            [&key](auto a, auto b)
+            {
+              auto ka = key(a);
+              auto kb = key(b);
+              return std::lexicographical_compare(ka.begin(), ka.end(),
+                                                  kb.begin(), kb.end());
+            });
+
+  // Send keys of all entities of mesh1 to the post offices, with the
+  // entity index appended
+  mesh1.topology_mutable()->create_entities(dim);
+  auto map1 = mesh1.topology()->index_map(dim);
+  assert(map1);
+  std::vector<std::int32_t> entities1(map1->size_local() + map1->num_ghosts());
+  std::iota(entities1.begin(), entities1.end(), 0);
+  std::vector<std::int64_t> keys1 = impl::entity_keys(mesh1, dim, entities1);
+  std::vector<int> dest1;
+  std::vector<std::int64_t> requests;
+  dest1.reserve(entities1.size());
+  requests.reserve(entities1.size() * (shape1 + 1));
+  for (std::int32_t e : entities1)
+  {
+    std::span k(keys1.data() + e * shape1, shape1);
+    dest1.push_back(post_office(k));
+    requests.insert(requests.end(), k.begin(), k.end());
+    requests.push_back(e);
+  }
+  auto [post_requests, request_src] = dolfinx::MPI::send_rows<std::int64_t>(
+      comm, dest1, requests, shape1 + 1);
+
+  // Look up the requested keys and reply with (entity, value) for the
+  // keys that are found
+  std::vector<int> reply_dest;
+  std::vector<std::int64_t> replies;
+  for (std::size_t r = 0; r < request_src.size(); ++r)
+  {
+    std::span k(post_requests.data() + r * (shape1 + 1), shape1);
+    auto it = std::lower_bound(
+        perm.begin(), perm.end(), k,
+        [&key](auto p, auto k)
+        {
+          auto kp = key(p);
+          return std::lexicographical_compare(kp.begin(), kp.end(), k.begin(),
+                                              k.end());
+        });
+    if (it != perm.end() and std::ranges::equal(key(*it), k))
+    {
+      reply_dest.push_back(request_src[r]);
+      replies.push_back(post_requests[r * (shape1 + 1) + shape1]);
+      replies.push_back(post_rows[*it * (shape1 + 1) + shape1]);
+    }
+  }
+  const std::vector<std::int64_t> tagged1
+      = dolfinx::MPI::send_rows<std::int64_t>(comm, reply_dest, replies, 2)
+            .first;
+
+  // Build MeshTags on mesh1
+  std::vector<std::int32_t> perm1(tagged1.size() / 2);
+  std::iota(perm1.begin(), perm1.end(), 0);
+  std::sort(perm1.begin(), perm1.end(), [&tagged1](auto a, auto b)
+            { return tagged1[2 * a] < tagged1[2 * b]; });
+  std::vector<std::int32_t> indices;
+  std::vector<U> values;
+  for (auto p : perm1)
+  {
+    if (indices.empty() or indices.back() != tagged1[2 * p])
+    {
+      indices.push_back(tagged1[2 * p]);
+      values.push_back(impl::unpack_value<U>(tagged1[2 * p + 1]));
+    }
+  }
+
+  return MeshTags<U>(mesh1.topology(), dim, std::move(indices),
+                     std::move(values));
+}
+
+} // namespace dolfinx::mesh
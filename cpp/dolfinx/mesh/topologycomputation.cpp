@@ -132,10 +132,7 @@ get_local_indexing(MPI_Comm comm, const common::IndexMap& vertex_map,
   std::sort(ranks.begin(), ranks.end());
   ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
 
-  MPI_Comm neighbor_comm;
-  MPI_Dist_graph_create_adjacent(
-      comm, ranks.size(), ranks.data(), MPI_UNWEIGHTED, ranks.size(),
-      ranks.data(), MPI_UNWEIGHTED, MPI_INFO_NULL, false, &neighbor_comm);
+  MPI_Comm neighbor_comm = dolfinx::MPI::neighbourhood_comm(comm, ranks, ranks);
 
   std::vector<std::vector<std::int64_t>> send_entities(ranks.size());
   std::vector<std::vector<std::int32_t>> send_index(ranks.size());
@@ -414,7 +411,6 @@ get_local_indexing(MPI_Comm comm, const common::IndexMap& vertex_map,
                            send_disp.data(), MPI_INT64_T, recv_data.data(),
                            recv_sizes.data(), recv_disp.data(), MPI_INT64_T,
                            neighbor_comm);
-    MPI_Comm_free(&neighbor_comm);
 
     // Map back received indices
     for (std::size_t r = 0; r < recv_disp.size() - 1; ++r)
@@ -436,7 +432,10 @@ get_local_indexing(MPI_Comm comm, const common::IndexMap& vertex_map,
            == ghost_indices.end());
   }
 
-  common::IndexMap index_map(comm, num_local, ghost_indices, ghost_owners);
+  // Ghost owners share vertices with the caller, so the (symmetric)
+  // vertex sharing neighbourhood contains the communication graph
+  common::IndexMap index_map(comm, num_local, ghost_indices, ghost_owners,
+                             {ranks, ranks});
 
   // Create map from initial numbering to new local indices
   std::vector<std::int32_t> new_entity_index(entity_index.size());
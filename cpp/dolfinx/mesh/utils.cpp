@@ -107,6 +107,41 @@ mesh::create_cell_partitioner(mesh::GhostMode ghost_mode,
   };
 }
 //-----------------------------------------------------------------------------
+mesh::CellPartitionFunction
+mesh::create_cell_partitioner(mesh::GhostMode ghost_mode,
+                              const CellCostFunction& cost,
+                              int num_constraints,
+                              const graph::weighted_partition_fn& partfn)
+{
+  return [partfn, cost, num_constraints, ghost_mode](
+             MPI_Comm comm, int nparts, const std::vector<CellType>& cell_types,
+             const std::vector<std::span<const std::int64_t>>& cells)
+             -> graph::AdjacencyList<std::int32_t>
+  {
+    spdlog::info("Compute weighted partition of cells across ranks");
+
+    // Compute distributed dual graph (for the cells on this process)
+    const graph::AdjacencyList dual_graph
+        = build_dual_graph(comm, cell_types, cells);
+
+    // Compute cell weights
+    const std::vector<std::int32_t> weights = cost(cell_types, cells);
+    if (weights.size()
+        != static_cast<std::size_t>(dual_graph.num_nodes() * num_constraints))
+    {
+      throw std::runtime_error("Number of cell weights and cells differ.");
+    }
+
+    // Just flag any kind of ghosting for now
+    bool ghosting = (ghost_mode != GhostMode::none);
+
+    // Compute partition
+    return partfn(comm, nparts, dual_graph,
+                  {.nodes = weights, .num_constraints = num_constraints},
+                  ghosting);
+  };
+}
+//-----------------------------------------------------------------------------
 std::vector<std::int32_t>
 mesh::compute_incident_entities(const Topology& topology,
                                 std::span<const std::int32_t> entities, int d0,
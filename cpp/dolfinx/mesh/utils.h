@@ -180,6 +180,24 @@ using CellPartitionFunction = std::function<graph::AdjacencyList<std::int32_t>(
     MPI_Comm comm, int nparts, const std::vector<CellType>& cell_types,
     const std::vector<std::span<const std::int64_t>>& cells)>;
 
+/// @brief Signature for functions that compute the cost (weight) of
+/// cells for partitioning.
+///
+/// Typical costs are the number of quadrature points of a cell, whether
+/// a cell has a facet with a boundary integral, or the relative cost of
+/// each cell type in a mixed-topology mesh.
+///
+/// @param[in] cell_types Cell types in the mesh
+/// @param[in] cells Lists of cells of each cell type, as passed to a
+/// CellPartitionFunction.
+/// @return Cell weights with shape `(num_cells, num_constraints)`,
+/// where `num_cells` is the total number of cells in `cells`. Cells are
+/// ordered by cell type, and then by their position in `cells[i]`.
+/// Weights must be non-negative. Storage is row-major.
+using CellCostFunction = std::function<std::vector<std::int32_t>(
+    const std::vector<CellType>& cell_types,
+    const std::vector<std::span<const std::int64_t>>& cells)>;
+
 /// @brief Extract topology from cell data, i.e. extract cell vertices.
 /// @param[in] cell_type The cell shape
 /// @param[in] layout The layout of geometry 'degrees-of-freedom' on the
@@ -733,6 +751,28 @@ CellPartitionFunction create_cell_partitioner(mesh::GhostMode ghost_mode
                                               const graph::partition_fn& partfn
                                               = &graph::partition_graph);
 
+/// @brief Create a function that computes destination rank for mesh
+/// cells in this rank by applying a weighted graph partitioner to the
+/// dual graph of the mesh.
+///
+/// The weight of each node of the dual graph is the cost of the cell,
+/// as computed by `cost`. This balances the total cost rather than the
+/// number of cells on each rank, which is important for e.g.
+/// mixed-topology meshes and meshes with costly boundary integrals.
+///
+/// @param[in] ghost_mode Type of ghosting to use
+/// @param[in] cost Function that computes the cell weights
+/// @param[in] num_constraints Number of weights computed by `cost` for
+/// each cell. Multiple balance constraints are supported by ParMETIS
+/// only.
+/// @param[in] partfn Weighted graph partitioning function
+/// @return Function that computes the destination ranks for each cell
+CellPartitionFunction
+create_cell_partitioner(mesh::GhostMode ghost_mode,
+                        const CellCostFunction& cost, int num_constraints = 1,
+                        const graph::weighted_partition_fn& partfn
+                        = &graph::weighted_partition_graph);
+
 /// @brief Compute incident indices
 /// @param[in] topology The topology
 /// @param[in] entities List of indices of topological dimension `d0`
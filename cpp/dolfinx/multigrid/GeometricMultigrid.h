@@ -0,0 +1,532 @@
+// Copyright (C) 2026 agent
+//
+// This file is part of DOLFINx (https://www.fenicsproject.org)
+//
+// SPDX-License-Identifier:    LGPL-3.0-or-later
+
+#pragma once
+
+#include "transfer.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <dolfinx/common/IndexMap.h>
+#include <dolfinx/common/MPI.h>
+#include <dolfinx/common/Timer.h>
+#include <dolfinx/common/log.h>
+#include <dolfinx/common/types.h>
+#include <dolfinx/la/MatrixCSR.h>
+#include <dolfinx/la/Vector.h>
+#include <dolfinx/la/dense_lu.h>
+#include <memory>
+#include <mpi.h>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace dolfinx::multigrid
+{
+
+/// Multigrid cycle type
+enum class CycleType
+{
+  V, ///< One coarse-level correction per level
+  W  ///< Two coarse-level corrections per level
+};
+
+/// Multigrid smoother
+enum class SmootherType
+{
+  jacobi,   ///< Damped Jacobi
+  chebyshev ///< Chebyshev polynomial of the Jacobi-preconditioned operator
+};
+
+/// Options for GeometricMultigrid
+struct MultigridOptions
+{
+  /// Cycle type
+  CycleType cycle = CycleType::V;
+
+  /// Smoother
+  SmootherType smoother = SmootherType::chebyshev;
+
+  /// Number of pre-smoothing steps
+  int pre_smooth = 1;
+
+  /// Number of post-smoothing steps
+  int post_smooth = 1;
+
+  /// Damping factor for the Jacobi smoother
+  double jacobi_weight = 2.0 / 3.0;
+
+  /// Polynomial degree of a Chebyshev smoothing step
+  int chebyshev_degree = 3;
+
+  /// Lower and upper bounds of the eigenvalue interval targeted by the
+  /// Chebyshev smoother, relative to the estimated largest eigenvalue
+  /// of the Jacobi-preconditioned operator
+  std::array<double, 2> chebyshev_bounds = {0.1, 1.1};
+
+  /// Number of power iterations used to estimate the largest eigenvalue
+  /// of the Jacobi-preconditioned operator
+  int eigenvalue_iterations = 10;
+
+  /// The coarsest operator is gathered onto process 0 and solved with a
+  /// dense LU factorisation if its global size does not exceed this
+  /// value
+  std::int64_t coarse_max_size = 5000;
+
+  /// Number of smoothing steps on the coarsest level when it is too
+  /// large to be gathered
+  int coarse_smooth = 20;
+};
+
+namespace impl
+{
+/// @brief Compute the inverse of the diagonal of the owned rows of a
+/// square matrix.
+template <dolfinx::scalar T>
+std::vector<T> inverse_diagonal(const la::MatrixCSR<T>& A)
+{
+  auto [bs0, bs1] = A.block_size();
+  if (bs0 != bs1)
+    throw std::runtime_error("Multigrid requires square matrix blocks.");
+
+  const std::int32_t num_rows = A.num_owned_rows();
+  const auto& row_ptr = A.row_ptr();
+  const auto& cols = A.cols();
+  const auto& values = A.values();
+  std::vector<T> d(num_rows * bs0, 0);
+  for (std::int32_t i = 0; i < num_rows; ++i)
+  {
+    auto it = std::find(std::next(cols.begin(), row_ptr[i]),
+                        std::next(cols.begin(), row_ptr[i + 1]), i);
+    if (it == std::next(cols.begin(), row_ptr[i + 1]))
+      throw std::runtime_error("Matrix has a missing diagonal entry.");
+    const std::size_t j = std::distance(cols.begin(), it);
+    for (int k = 0; k < bs0; ++k)
+    {
+      const T dk = values[j * bs0 * bs1 + k * bs1 + k];
+      if (dk == T(0))
+        throw std::runtime_error("Matrix has a zero diagonal entry.");
+      d[i * bs0 + k] = T(1) / dk;
+    }
+  }
+
+  return d;
+}
+} // namespace impl
+
+/// @brief Geometric multigrid solver and preconditioner for operators
+/// stored as la::MatrixCSR.
+///
+/// The operators are provided on each level of a hierarchy of nested
+/// spaces (e.g. assembled on the levels of a multigrid::MeshHierarchy)
+/// and levels are connected by multigrid::TransferOperator. Smoothing
+/// uses damped Jacobi or Chebyshev iteration of the
+/// Jacobi-preconditioned operator, which only require matrix-vector
+/// products and are fully parallel.
+///
+/// If the coarsest operator is small (see
+/// MultigridOptions::coarse_max_size), it is agglomerated onto process
+/// 0 and solved directly. Otherwise the coarsest level is smoothed.
+///
+/// All operations use native DOLFINx linear algebra, i.e. PETSc is not
+/// required.
+///
+/// @tparam T Scalar type.
+/// @tparam U Mesh geometry scalar type.
+template <dolfinx::scalar T,
+          std::floating_point U = dolfinx::scalar_value_type_t<T>>
+class GeometricMultigrid
+{
+public:
+  /// @brief Create a geometric multigrid solver.
+  /// @param[in] A Operator on each level, ordered from coarsest to
+  /// finest. Each operator must be square, with the rows and columns of
+  /// the owned part in the same order, and have the values for owned
+  /// rows accumulated (i.e. reverse scattered).
+  /// @param[in] transfer Transfer operators, where `transfer[i]` maps
+  /// between the space of `A[i]` and the space of `A[i + 1]`.
+  /// @param[in] options Multigrid options.
+  GeometricMultigrid(std::vector<std::shared_ptr<la::MatrixCSR<T>>> A,
+                     std::vector<TransferOperator<T, U>>&& transfer,
+                     const MultigridOptions& options = {})
+      : _A(std::move(A)), _transfer(std::move(transfer)), _options(options)
+  {
+    if (_A.empty())
+      throw std::runtime_error("Multigrid requires at least one level.");
+    if (_transfer.size() + 1 != _A.size())
+    {
+      throw std::runtime_error(
+          "Number of transfer operators does not match number of levels.");
+    }
+
+    common::Timer timer("Multigrid: setup");
+    for (std::size_t l = 0; l < _A.size(); ++l)
+    {
+      const la::MatrixCSR<T>& Al = *_A[l];
+      _dinv.push_back(impl::inverse_diagonal(Al));
+      _d.emplace_back(_dinv.back().size());
+
+      const int bs = Al.block_size()[1];
+      _x.emplace_back(Al.index_map(1), bs);
+      _b.emplace_back(Al.index_map(1), bs);
+      _r.emplace_back(Al.index_map(1), bs);
+      _w.emplace_back(Al.index_map(1), bs);
+    }
+
+    // Prepare coarse solver
+    setup_coarse_solver();
+
+    // Estimate largest eigenvalue of the Jacobi-preconditioned
+    // operators
+    _lmax.resize(_A.size(), 0);
+    if (_options.smoother == SmootherType::chebyshev)
+    {
+      for (std::size_t l = _coarse_direct ? 1 : 0; l < _A.size(); ++l)
+      {
+        _lmax[l] = estimate_max_eigenvalue(l);
+        spdlog::info("Multigrid level {}: estimated largest eigenvalue {}", l,
+                     _lmax[l]);
+      }
+    }
+  }
+
+  /// @brief Number of levels.
+  int num_levels() const { return _A.size(); }
+
+  /// @brief Apply one multigrid cycle with a zero initial guess, i.e.
+  /// apply the multigrid preconditioner.
+  /// @param[in] b Right-hand side on the finest level. Only owned
+  /// entries are used.
+  /// @param[out] x Approximate solution. Owned entries are set and
+  /// ghost entries are not updated.
+  void apply(const la::Vector<T>& b, la::Vector<T>& x)
+  {
+    common::Timer timer("Multigrid: apply");
+    const std::size_t l = _A.size() - 1;
+    std::span<T> xl = _x[l].mutable_array();
+    const std::int32_t size = num_owned(_x[l]);
+    std::copy_n(b.array().begin(), size, _b[l].mutable_array().begin());
+    std::fill_n(xl.begin(), size, T(0));
+    cycle(l);
+    std::copy_n(xl.begin(), size, x.mutable_array().begin());
+  }
+
+  /// @brief Solve `A x = b` on the finest level by multigrid
+  /// iteration.
+  /// @param[in] b Right-hand side. Only owned entries are used.
+  /// @param[in,out] x Initial guess on input, solution on output. Owned
+  /// entries are set and ghost entries are not updated.
+  /// @param[in] rtol Relative tolerance on the residual norm.
+  /// @param[in] max_it Maximum number of cycles.
+  /// @return Number of cycles and the final relative residual norm.
+  std::pair<int, double> solve(const la::Vector<T>& b, la::Vector<T>& x,
+                               double rtol = 1e-8, int max_it = 100)
+  {
+    common::Timer timer("Multigrid: solve");
+    const std::size_t l = _A.size() - 1;
+    const std::int32_t size = num_owned(_x[l]);
+    std::copy_n(b.array().begin(), size, _b[l].mutable_array().begin());
+    std::copy_n(x.array().begin(), size, _x[l].mutable_array().begin());
+
+    const double b_norm = la::norm(_b[l]);
+    residual(l);
+    double r_norm = la::norm(_r[l]);
+    int it = 0;
+    while (r_norm > rtol * b_norm and it < max_it)
+    {
+      cycle(l);
+      residual(l);
+      r_norm = la::norm(_r[l]);
+      ++it;
+      spdlog::info("Multigrid iteration {}: relative residual {}", it,
+                   r_norm / b_norm);
+    }
+
+    std::copy_n(_x[l].array().begin(), size, x.mutable_array().begin());
+    return {it, b_norm > 0 ? r_norm / b_norm : 0};
+  }
+
+private:
+  // Number of owned entries in a vector
+  static std::int32_t num_owned(const la::Vector<T>& x)
+  {
+    return x.index_map()->size_local() * x.bs();
+  }
+
+  // Compute the residual r = b - A x (owned entries)
+  void residual(std::size_t l)
+  {
+    const std::int32_t size = num_owned(_x[l]);
+    std::span<T> w = _w[l].mutable_array();
+    std::fill_n(w.begin(), size, T(0));
+    _A[l]->mult(_x[l], _w[l]);
+    std::span<const T> b = _b[l].array();
+    std::span<T> r = _r[l].mutable_array();
+    for (std::int32_t i = 0; i < size; ++i)
+      r[i] = b[i] - w[i];
+  }
+
+  // Apply smoothing steps to x on level l
+  void smooth(std::size_t l, int steps)
+  {
+    std::span<T> x = _x[l].mutable_array();
+    std::span<const T> r = _r[l].array();
+    const std::vector<T>& dinv = _dinv[l];
+    if (_options.smoother == SmootherType::jacobi)
+    {
+      const T omega = _options.jacobi_weight;
+      for (int s = 0; s < steps; ++s)
+      {
+        residual(l);
+        for (std::size_t i = 0; i < dinv.size(); ++i)
+          x[i] += omega * dinv[i] * r[i];
+      }
+    }
+    else
+    {
+      using R = dolfinx::scalar_value_type_t<T>;
+      const R a = _options.chebyshev_bounds[0] * _lmax[l];
+      const R b = _options.chebyshev_bounds[1] * _lmax[l];
+      const R theta = (b + a) / 2;
+      const R delta = (b - a) / 2;
+      const R sigma = theta / delta;
+      std::vector<T>& d = _d[l];
+      for (int s = 0; s < steps; ++s)
+      {
+        R rho = 1 / sigma;
+        residual(l);
+        for (std::size_t i = 0; i < d.size(); ++i)
+          d[i] = dinv[i] * r[i] / theta;
+        for (int k = 1;; ++k)
+        {
+          for (std::size_t i = 0; i < d.size(); ++i)
+            x[i] += d[i];
+          if (k == _options.chebyshev_degree)
+            break;
+
+          residual(l);
+          const R rho1 = 1 / (2 * sigma - rho);
+          for (std::size_t i = 0; i < d.size(); ++i)
+            d[i] = rho1 * rho * d[i] + 2 * rho1 / delta * dinv[i] * r[i];
+          rho = rho1;
+        }
+      }
+    }
+  }
+
+  // Apply a multigrid cycle on level l, using the current x as initial
+  // guess
+  void cycle(std::size_t l)
+  {
+    if (l == 0)
+    {
+      coarse_solve();
+      return;
+    }
+
+    smooth(l, _options.pre_smooth);
+
+    // Restrict residual and compute correction on the coarser level
+    residual(l);
+    TransferOperator<T, U>& transfer = _transfer[l - 1];
+    transfer.restrict_to(_r[l], _b[l - 1]);
+    std::fill_n(_x[l - 1].mutable_array().begin(), num_owned(_x[l - 1]),
+                T(0));
+    const int num_corrections = _options.cycle == CycleType::W ? 2 : 1;
+    for (int i = 0; i < num_corrections; ++i)
+      cycle(l - 1);
+
+    // Prolong correction
+    transfer.prolong(_x[l - 1], _w[l]);
+    std::span<T> x = _x[l].mutable_array();
+    std::span<const T> w = _w[l].array();
+    for (std::int32_t i = 0; i < num_owned(_x[l]); ++i)
+      x[i] += w[i];
+
+    smooth(l, _options.post_smooth);
+  }
+
+  // Estimate the largest eigenvalue of D^{-1} A by power iteration
+  auto estimate_max_eigenvalue(std::size_t l)
+  {
+    using R = dolfinx::scalar_value_type_t<T>;
+    const std::int32_t size = num_owned(_x[l]);
+    const std::int64_t offset
+        = _x[l].index_map()->local_range()[0] * _x[l].bs();
+    std::span<T> x = _x[l].mutable_array();
+    for (std::int32_t i = 0; i < size; ++i)
+      x[i] = 1 + std::sin(R(offset + i));
+
+    R lambda = 0;
+    std::span<const T> w = _w[l].array();
+    for (int k = 0; k < _options.eigenvalue_iterations; ++k)
+    {
+      const R x_norm = la::norm(_x[l]);
+      std::fill_n(_w[l].mutable_array().begin(), size, T(0));
+      _A[l]->mult(_x[l], _w[l]);
+      for (std::int32_t i = 0; i < size; ++i)
+        x[i] = _dinv[l][i] * w[i];
+      lambda = la::norm(_x[l]) / x_norm;
+    }
+
+    return lambda;
+  }
+
+  // Gather the coarsest operator onto process 0 and factorise it if it
+  // is small enough
+  void setup_coarse_solver()
+  {
+    const la::MatrixCSR<T>& A = *_A[0];
+    auto row_map = A.index_map(0);
+    MPI_Comm comm = row_map->comm();
+    auto [bs0, bs1] = A.block_size();
+    const std::int64_t n = row_map->size_global() * bs0;
+    if (n > _options.coarse_max_size)
+    {
+      spdlog::info("Multigrid coarse level too large to agglomerate ({})", n);
+      return;
+    }
+
+    common::Timer timer("Multigrid: agglomerate coarse level");
+
+    // Pack (row, column, value) of owned entries with global indices
+    const std::int32_t num_rows = A.num_owned_rows();
+    const auto& row_ptr = A.row_ptr();
+    const auto& values = A.values();
+    std::vector<std::int64_t> cols(row_ptr[num_rows]);
+    A.index_map(1)->local_to_global(
+        std::span(A.cols().data(), row_ptr[num_rows]), cols);
+    const std::int64_t row_offset = row_map->local_range()[0];
+    std::vector<std::int64_t> entries;
+    std::vector<T> entry_values;
+    entries.reserve(2 * row_ptr[num_rows] * bs0 * bs1);
+    entry_values.reserve(row_ptr[num_rows] * bs0 * bs1);
+    for (std::int32_t i = 0; i < num_rows; ++i)
+    {
+      for (std::int64_t j = row_ptr[i]; j < row_ptr[i + 1]; ++j)
+      {
+        for (int k0 = 0; k0 < bs0; ++k0)
+        {
+          for (int k1 = 0; k1 < bs1; ++k1)
+          {
+            entries.push_back((row_offset + i) * bs0 + k0);
+            entries.push_back(cols[j] * bs1 + k1);
+            entry_values.push_back(values[j * bs0 * bs1 + k0 * bs1 + k1]);
+          }
+        }
+      }
+    }
+
+    // Gather entries on process 0
+    const int rank = dolfinx::MPI::rank(comm);
+    const int size = dolfinx::MPI::size(comm);
+    const int num_entries = entry_values.size();
+    std::vector<int> num_entries_all(rank == 0 ? size : 0);
+    MPI_Gather(&num_entries, 1, MPI_INT, num_entries_all.data(), 1, MPI_INT,
+               0, comm);
+    std::vector<int> disp(num_entries_all.size() + 1, 0);
+    std::partial_sum(num_entries_all.begin(), num_entries_all.end(),
+                     std::next(disp.begin()));
+    std::vector<T> values_all(rank == 0 ? disp.back() : 0);
+    MPI_Gatherv(entry_values.data(), num_entries,
+                dolfinx::MPI::mpi_type<T>(), values_all.data(),
+                num_entries_all.data(), disp.data(),
+                dolfinx::MPI::mpi_type<T>(), 0, comm);
+
+    std::for_each(num_entries_all.begin(), num_entries_all.end(),
+                  [](auto& n) { n *= 2; });
+    std::for_each(disp.begin(), disp.end(), [](auto& d) { d *= 2; });
+    std::vector<std::int64_t> entries_all(rank == 0 ? disp.back() : 0);
+    MPI_Gatherv(entries.data(), entries.size(), MPI_INT64_T,
+                entries_all.data(), num_entries_all.data(), disp.data(),
+                MPI_INT64_T, 0, comm);
+
+    // Gather the number of owned rows, which is required to gather
+    // and scatter vectors
+    const int num_owned_rows = num_rows * bs0;
+    _coarse_counts.resize(rank == 0 ? size : 0);
+    MPI_Gather(&num_owned_rows, 1, MPI_INT, _coarse_counts.data(), 1, MPI_INT,
+               0, comm);
+    _coarse_disp.assign(_coarse_counts.size() + 1, 0);
+    std::partial_sum(_coarse_counts.begin(), _coarse_counts.end(),
+                     std::next(_coarse_disp.begin()));
+
+    // Build and factorise dense operator
+    if (rank == 0)
+    {
+      _coarse_lu.assign(n * n, 0);
+      for (std::size_t e = 0; e < values_all.size(); ++e)
+        _coarse_lu[entries_all[2 * e] * n + entries_all[2 * e + 1]]
+            += values_all[e];
+      _coarse_perm.resize(n);
+      if (!la::impl::lu_factor<T>(_coarse_lu, _coarse_perm))
+        throw std::runtime_error("Coarse multigrid operator is singular.");
+      _coarse_b.resize(n);
+      _coarse_x.resize(n);
+    }
+
+    _coarse_direct = true;
+  }
+
+  // Solve on the coarsest level
+  void coarse_solve()
+  {
+    if (!_coarse_direct)
+    {
+      smooth(0, _options.coarse_smooth);
+      return;
+    }
+
+    MPI_Comm comm = _x[0].index_map()->comm();
+    const int size = num_owned(_x[0]);
+    MPI_Gatherv(_b[0].array().data(), size, dolfinx::MPI::mpi_type<T>(),
+                _coarse_b.data(), _coarse_counts.data(), _coarse_disp.data(),
+                dolfinx::MPI::mpi_type<T>(), 0, comm);
+    if (dolfinx::MPI::rank(comm) == 0)
+    {
+      la::impl::lu_solve<T>(_coarse_lu, _coarse_perm, _coarse_b,
+                            std::span<T>(_coarse_x));
+    }
+    MPI_Scatterv(_coarse_x.data(), _coarse_counts.data(), _coarse_disp.data(),
+                 dolfinx::MPI::mpi_type<T>(), _x[0].mutable_array().data(),
+                 size, dolfinx::MPI::mpi_type<T>(), 0, comm);
+  }
+
+  // Operators
+  std::vector<std::shared_ptr<la::MatrixCSR<T>>> _A;
+
+  // Transfer operators between levels
+  std::vector<TransferOperator<T, U>> _transfer;
+
+  // Options
+  MultigridOptions _options;
+
+  // Inverse of the operator diagonal and Chebyshev work array on each
+  // level
+  std::vector<std::vector<T>> _dinv, _d;
+
+  // Estimated largest eigenvalue of D^{-1} A on each level
+  std::vector<dolfinx::scalar_value_type_t<T>> _lmax;
+
+  // Solution, right-hand side, residual and work vectors on each level
+  std::vector<la::Vector<T>> _x, _b, _r, _w;
+
+  // True if the coarsest level is agglomerated and solved directly
+  bool _coarse_direct = false;
+
+  // Dense LU factorisation of the coarsest operator (on process 0) and
+  // layout of owned rows on each process
+  std::vector<T> _coarse_lu;
+  std::vector<std::int32_t> _coarse_perm;
+  std::vector<int> _coarse_counts, _coarse_disp;
+  std::vector<T> _coarse_b, _coarse_x;
+};
+
+} // namespace dolfinx::multigrid
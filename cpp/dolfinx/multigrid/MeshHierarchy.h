@@ -0,0 +1,186 @@
+// Copyright (C) 2026 agent
+//
+// This file is part of DOLFINx (https://www.fenicsproject.org)
+//
+// SPDX-License-Identifier:    LGPL-3.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <dolfinx/common/IndexMap.h>
+#include <dolfinx/common/Timer.h>
+#include <dolfinx/common/log.h>
+#include <dolfinx/mesh/Mesh.h>
+#include <dolfinx/mesh/Topology.h>
+#include <dolfinx/refinement/plaza.h>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace dolfinx::multigrid
+{
+
+/// @brief A sequence of nested meshes created by successive refinement
+/// of a coarse mesh.
+///
+/// Each level is created from the previous level using Plaza
+/// refinement without redistribution, so that every cell of a fine
+/// mesh is on the same process as its parent cell. For each level the
+/// hierarchy stores, for the cells of the refined mesh (in the cell
+/// ordering of the refined mesh), the index of the parent cell in the
+/// next coarser mesh and the cell-local index of the parent facet of
+/// each facet. These maps are used to build transfer operators between
+/// levels, see multigrid::TransferOperator.
+///
+/// @note Meshes with ghost cells are not supported.
+template <std::floating_point T>
+class MeshHierarchy
+{
+public:
+  /// @brief Create a hierarchy with a single (coarse) level.
+  /// @param[in] mesh The coarsest mesh.
+  explicit MeshHierarchy(std::shared_ptr<mesh::Mesh<T>> mesh)
+      : _meshes({mesh}), _parent_cells(1), _parent_facets(1)
+  {
+    assert(mesh);
+    auto topology = mesh->topology();
+    assert(topology);
+    if (topology->cell_type() != mesh::CellType::triangle
+        and topology->cell_type() != mesh::CellType::tetrahedron)
+    {
+      throw std::runtime_error("Mesh hierarchy only defined for simplices");
+    }
+
+    if (topology->index_map(topology->dim())->num_ghosts() > 0)
+      throw std::runtime_error("Ghosted meshes are not supported");
+  }
+
+  /// @brief Create a hierarchy by uniform refinement of a coarse mesh.
+  /// @param[in] mesh The coarsest mesh.
+  /// @param[in] num_refinements Number of uniform refinements, i.e.
+  /// the hierarchy has `num_refinements + 1` levels.
+  MeshHierarchy(std::shared_ptr<mesh::Mesh<T>> mesh, int num_refinements)
+      : MeshHierarchy(mesh)
+  {
+    for (int i = 0; i < num_refinements; ++i)
+      refine();
+  }
+
+  /// @brief Add a level by uniform refinement of the finest mesh.
+  void refine()
+  {
+    auto [mesh, parent_cell, parent_facet] = refinement::plaza::refine(
+        *_meshes.back(), false,
+        refinement::plaza::Option::parent_cell_and_facet);
+    add_level(std::move(mesh), parent_cell, parent_facet);
+  }
+
+  /// @brief Add a level by refinement of marked edges of the finest
+  /// mesh.
+  /// @param[in] edges Indices of the edges of the finest mesh that
+  /// should be split.
+  void refine(std::span<const std::int32_t> edges)
+  {
+    auto [mesh, parent_cell, parent_facet] = refinement::plaza::refine(
+        *_meshes.back(), edges, false,
+        refinement::plaza::Option::parent_cell_and_facet);
+    add_level(std::move(mesh), parent_cell, parent_facet);
+  }
+
+  /// @brief Number of levels in the hierarchy.
+  int num_levels() const { return _meshes.size(); }
+
+  /// @brief The mesh on a level.
+  /// @param[in] level Level index, where 0 is the coarsest level.
+  /// @return The mesh.
+  std::shared_ptr<mesh::Mesh<T>> mesh(int level) const
+  {
+    return _meshes.at(level);
+  }
+
+  /// @brief Parent cell of each cell on a level.
+  /// @param[in] level Level index (`level > 0`).
+  /// @return The (process-local) index of the parent cell in the mesh
+  /// on `level - 1` for each cell of the mesh on `level`.
+  std::span<const std::int32_t> parent_cells(int level) const
+  {
+    check_level(level);
+    return _parent_cells[level];
+  }
+
+  /// @brief Parent facets of each cell on a level.
+  /// @param[in] level Level index (`level > 0`).
+  /// @return For each cell of the mesh on `level`, the index (local to
+  /// the parent cell) of the parent facet of each facet of the cell,
+  /// or -1 if the facet is interior to the parent cell
+  /// (`shape=(num_cells, tdim + 1)`).
+  std::span<const std::int8_t> parent_facets(int level) const
+  {
+    check_level(level);
+    return _parent_facets[level];
+  }
+
+private:
+  // Check that a level has parent data
+  void check_level(int level) const
+  {
+    if (level < 1 or level >= num_levels())
+    {
+      throw std::runtime_error("Invalid mesh hierarchy level: "
+                               + std::to_string(level));
+    }
+  }
+
+  // Append refined mesh and re-order the parent data from the cell
+  // ordering of the refinement to the cell ordering of the refined
+  // mesh
+  void add_level(mesh::Mesh<T>&& mesh,
+                 std::span<const std::int32_t> parent_cell,
+                 std::span<const std::int8_t> parent_facet)
+  {
+    common::Timer timer("Mesh hierarchy: add level");
+
+    auto topology = mesh.topology();
+    const int tdim = topology->dim();
+    auto cell_map = topology->index_map(tdim);
+    assert(cell_map);
+    const std::vector<std::int64_t>& original_cell_index
+        = topology->original_cell_index[0];
+    assert(original_cell_index.size() == parent_cell.size());
+    const std::int64_t offset = cell_map->local_range()[0];
+
+    std::vector<std::int32_t> cells(parent_cell.size());
+    std::vector<std::int8_t> facets(parent_facet.size());
+    for (std::size_t c = 0; c < cells.size(); ++c)
+    {
+      const std::int64_t c0 = original_cell_index[c] - offset;
+      assert(c0 >= 0 and c0 < (std::int64_t)cells.size());
+      cells[c] = parent_cell[c0];
+      std::copy_n(std::next(parent_facet.begin(), c0 * (tdim + 1)), tdim + 1,
+                  std::next(facets.begin(), c * (tdim + 1)));
+    }
+
+    spdlog::info("Mesh hierarchy level {}: {} cells", _meshes.size(),
+                 cell_map->size_global());
+
+    _meshes.push_back(std::make_shared<mesh::Mesh<T>>(std::move(mesh)));
+    _parent_cells.push_back(std::move(cells));
+    _parent_facets.push_back(std::move(facets));
+  }
+
+  // Meshes, from coarsest to finest
+  std::vector<std::shared_ptr<mesh::Mesh<T>>> _meshes;
+
+  // Parent cell for each cell on each level (empty on level 0)
+  std::vector<std::vector<std::int32_t>> _parent_cells;
+
+  // Parent facet for each facet of each cell on each level (empty on
+  // level 0)
+  std::vector<std::vector<std::int8_t>> _parent_facets;
+};
+
+} // namespace dolfinx::multigrid
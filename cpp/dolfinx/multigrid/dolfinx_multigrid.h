@@ -0,0 +1,15 @@
+#pragma once
+
+/// @brief Geometric multigrid.
+///
+/// Hierarchies of nested meshes, transfer operators between the levels
+/// of a hierarchy and geometric multigrid solvers.
+namespace dolfinx::multigrid
+{
+}
+
+// DOLFINx multigrid interface
+
+#include <dolfinx/multigrid/GeometricMultigrid.h>
+#include <dolfinx/multigrid/MeshHierarchy.h>
+#include <dolfinx/multigrid/transfer.h>
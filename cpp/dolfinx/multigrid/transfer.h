@@ -0,0 +1,562 @@
+// Copyright (C) 2026 agent
+//
+// This file is part of DOLFINx (https://www.fenicsproject.org)
+//
+// SPDX-License-Identifier:    LGPL-3.0-or-later
+
+#pragma once
+
+#include "MeshHierarchy.h"
+#include <algorithm>
+#include <array>
+#include <basix/mdspan.hpp>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <dolfinx/common/IndexMap.h>
+#include <dolfinx/common/Timer.h>
+#include <dolfinx/fem/CoordinateElement.h>
+#include <dolfinx/fem/DofMap.h>
+#include <dolfinx/fem/FiniteElement.h>
+#include <dolfinx/fem/Function.h>
+#include <dolfinx/fem/FunctionSpace.h>
+#include <dolfinx/fem/interpolate.h>
+#include <dolfinx/fem/sparsitybuild.h>
+#include <dolfinx/la/MatrixCSR.h>
+#include <dolfinx/la/SparsityPattern.h>
+#include <dolfinx/la/Vector.h>
+#include <dolfinx/mesh/Mesh.h>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace dolfinx::multigrid
+{
+namespace impl
+{
+/// @brief Compute the element transfer matrices between a coarse space
+/// and a nested fine space.
+///
+/// For each cell `c` of the fine mesh, the matrix that interpolates
+/// the basis functions of `V0` on the parent cell of `c` into `V1` on
+/// `c` is computed and passed to `mat_set` together with the cell
+/// degrees-of-freedom of `V1` (rows) and `V0` (columns). The matrix
+/// has shape `(V1 space dimension, V0 space dimension)` (row-major).
+///
+/// The basis functions of `V0` are evaluated by mapping the
+/// interpolation points of `V1` to the reference cell of the parent
+/// cell, which avoids the point location required for interpolation
+/// between non-matching meshes.
+///
+/// @param[in] V0 Coarse space.
+/// @param[in] V1 Fine space.
+/// @param[in] parent_cells Parent cell in the mesh of `V0` of each
+/// cell in the mesh of `V1`.
+/// @param[in] mat_set Function called with `(dofs1, dofs0, A)` for each
+/// fine cell.
+template <dolfinx::scalar T, std::floating_point U>
+void transfer_matrix(const fem::FunctionSpace<U>& V0,
+                     const fem::FunctionSpace<U>& V1,
+                     std::span<const std::int32_t> parent_cells,
+                     auto&& mat_set)
+{
+  using mdspan2_t = MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
+      U, MDSPAN_IMPL_STANDARD_NAMESPACE::dextents<std::size_t, 2>>;
+  using cmdspan2_t = MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
+      const U, MDSPAN_IMPL_STANDARD_NAMESPACE::dextents<std::size_t, 2>>;
+  using mdspan3_t = MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
+      U, MDSPAN_IMPL_STANDARD_NAMESPACE::dextents<std::size_t, 3>>;
+  using cmdspan4_t = MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
+      const U, MDSPAN_IMPL_STANDARD_NAMESPACE::dextents<std::size_t, 4>>;
+
+  auto mesh0 = V0.mesh();
+  assert(mesh0);
+  auto mesh1 = V1.mesh();
+  assert(mesh1);
+  const int tdim = mesh1->topology()->dim();
+  const std::size_t gdim = mesh1->geometry().dim();
+
+  // Get elements
+  std::shared_ptr<const fem::FiniteElement<U>> e0 = V0.element();
+  assert(e0);
+  std::shared_ptr<const fem::FiniteElement<U>> e1 = V1.element();
+  assert(e1);
+  if (e0->map_type() != basix::maps::type::identity
+      or e1->map_type() != basix::maps::type::identity)
+  {
+    throw std::runtime_error(
+        "Transfer operators require elements with an identity map.");
+  }
+
+  const int bs0 = e0->block_size();
+  const int bs1 = e1->block_size();
+  if (bs0 != bs1 or V0.value_size() != V1.value_size())
+  {
+    throw std::runtime_error(
+        "Transfer operators require spaces with the same value shape.");
+  }
+
+  // The parent cell is mapped to the reference cell using the
+  // (constant) inverse Jacobian
+  const fem::CoordinateElement<U>& cmap0 = mesh0->geometry().cmap();
+  const fem::CoordinateElement<U>& cmap1 = mesh1->geometry().cmap();
+  if (!cmap0.is_affine())
+    throw std::runtime_error("Transfer operators require affine cells.");
+
+  std::span<const std::uint32_t> cell_info0, cell_info1;
+  if (e0->needs_dof_transformations())
+  {
+    mesh0->topology_mutable()->create_entity_permutations();
+    cell_info0 = std::span(mesh0->topology()->get_cell_permutation_info());
+  }
+  if (e1->needs_dof_transformations())
+  {
+    mesh1->topology_mutable()->create_entity_permutations();
+    cell_info1 = std::span(mesh1->topology()->get_cell_permutation_info());
+  }
+
+  auto dofmap0 = V0.dofmap();
+  assert(dofmap0);
+  auto dofmap1 = V1.dofmap();
+  assert(dofmap1);
+
+  auto apply_dof_transformation0
+      = e0->template dof_transformation_fn<U>(fem::doftransform::standard);
+  auto apply_inverse_dof_transform1 = e1->template dof_transformation_fn<T>(
+      fem::doftransform::inverse_transpose);
+
+  // Get sizes of elements
+  const std::size_t space_dim0 = e0->space_dimension();
+  const std::size_t space_dim1 = e1->space_dimension();
+  const std::size_t dim0 = space_dim0 / bs0;
+  const std::size_t value_size0 = e0->reference_value_size() / bs0;
+
+  // Get geometry data
+  auto x_dofmap0 = mesh0->geometry().dofmap();
+  auto x_dofmap1 = mesh1->geometry().dofmap();
+  std::span<const U> x_g0 = mesh0->geometry().x();
+  std::span<const U> x_g1 = mesh1->geometry().x();
+
+  // Evaluate fine coordinate map basis at the fine interpolation
+  // points
+  const auto [X1, X1shape] = e1->interpolation_points();
+  const std::size_t num_points = X1shape[0];
+  std::array<std::size_t, 4> phi1_shape = cmap1.tabulate_shape(0, num_points);
+  std::vector<U> phi1_b(
+      std::reduce(phi1_shape.begin(), phi1_shape.end(), 1, std::multiplies{}));
+  cmdspan4_t phi1(phi1_b.data(), phi1_shape);
+  cmap1.tabulate(0, X1, X1shape, phi1_b);
+
+  // Evaluate coarse coordinate map derivatives at the reference origin
+  std::vector<U> X0ref(tdim, 0);
+  std::array<std::size_t, 4> phi0_shape = cmap0.tabulate_shape(1, 1);
+  std::vector<U> phi0_b(
+      std::reduce(phi0_shape.begin(), phi0_shape.end(), 1, std::multiplies{}));
+  cmdspan4_t phi0(phi0_b.data(), phi0_shape);
+  cmap0.tabulate(1, X0ref, {1, X0ref.size()}, phi0_b);
+  auto dphi0 = MDSPAN_IMPL_STANDARD_NAMESPACE::submdspan(
+      phi0, std::pair(1, tdim + 1), 0,
+      MDSPAN_IMPL_STANDARD_NAMESPACE::full_extent, 0);
+
+  // Get the interpolation operator (matrix) `Pi` that maps a function
+  // evaluated at the interpolation points to the element degrees of
+  // freedom, i.e. dofs = Pi f_x
+  const auto [_Pi_1, pi_shape] = e1->interpolation_operator();
+  cmdspan2_t Pi_1(_Pi_1.data(), pi_shape);
+  const bool interpolation_ident = e1->interpolation_ident();
+
+  // Create working arrays
+  std::vector<U> coord_dofs0_b(cmap0.dim() * gdim);
+  mdspan2_t coord_dofs0(coord_dofs0_b.data(), cmap0.dim(), gdim);
+  std::vector<U> coord_dofs1_b(cmap1.dim() * gdim);
+  mdspan2_t coord_dofs1(coord_dofs1_b.data(), cmap1.dim(), gdim);
+  std::vector<U> x_b(num_points * gdim);
+  mdspan2_t x(x_b.data(), num_points, gdim);
+  std::vector<U> X0_b(num_points * tdim);
+  mdspan2_t X0(X0_b.data(), num_points, tdim);
+  std::vector<U> J_b(gdim * tdim);
+  mdspan2_t J(J_b.data(), gdim, tdim);
+  std::vector<U> K_b(tdim * gdim);
+  mdspan2_t K(K_b.data(), tdim, gdim);
+  std::vector<U> basis0_b(num_points * dim0 * value_size0);
+  mdspan3_t basis0(basis0_b.data(), num_points, dim0, value_size0);
+
+  // Basis values unrolled for block size (num_points, dof, value_size)
+  std::vector<U> basis_values_b(num_points * space_dim0 * V1.value_size());
+  mdspan3_t basis_values(basis_values_b.data(), num_points, space_dim0,
+                         V1.value_size());
+
+  std::vector<T> Ab(space_dim0 * space_dim1);
+  std::vector<T> local1(space_dim1);
+
+  auto cell_map1 = mesh1->topology()->index_map(tdim);
+  assert(cell_map1);
+  const std::int32_t num_cells = cell_map1->size_local();
+  if (parent_cells.size() < std::size_t(num_cells))
+    throw std::runtime_error("Parent cell map is too small for fine mesh.");
+  for (std::int32_t c = 0; c < num_cells; ++c)
+  {
+    const std::int32_t p = parent_cells[c];
+
+    // Get cell geometries
+    auto x_dofs0 = MDSPAN_IMPL_STANDARD_NAMESPACE::submdspan(
+        x_dofmap0, p, MDSPAN_IMPL_STANDARD_NAMESPACE::full_extent);
+    for (std::size_t i = 0; i < x_dofs0.size(); ++i)
+      for (std::size_t j = 0; j < gdim; ++j)
+        coord_dofs0(i, j) = x_g0[3 * x_dofs0[i] + j];
+    auto x_dofs1 = MDSPAN_IMPL_STANDARD_NAMESPACE::submdspan(
+        x_dofmap1, c, MDSPAN_IMPL_STANDARD_NAMESPACE::full_extent);
+    for (std::size_t i = 0; i < x_dofs1.size(); ++i)
+      for (std::size_t j = 0; j < gdim; ++j)
+        coord_dofs1(i, j) = x_g1[3 * x_dofs1[i] + j];
+
+    // Physical coordinates of the fine interpolation points
+    std::fill(x_b.begin(), x_b.end(), 0);
+    for (std::size_t q = 0; q < num_points; ++q)
+      for (std::size_t k = 0; k < coord_dofs1.extent(0); ++k)
+        for (std::size_t j = 0; j < gdim; ++j)
+          x(q, j) += phi1(0, q, k, 0) * coord_dofs1(k, j);
+
+    // Pull back the points to the reference cell of the parent
+    std::fill(J_b.begin(), J_b.end(), 0);
+    cmap0.compute_jacobian(dphi0, coord_dofs0, J);
+    cmap0.compute_jacobian_inverse(J, K);
+    std::array<U, 3> x0 = {0, 0, 0};
+    for (std::size_t i = 0; i < gdim; ++i)
+      x0[i] = coord_dofs0(0, i);
+    fem::CoordinateElement<U>::pull_back_affine(X0, K, x0, x);
+
+    // Evaluate the coarse basis at the points and apply DOF
+    // transformations of the parent cell
+    e0->tabulate(basis0_b, X0_b, {num_points, std::size_t(tdim)}, 0);
+    std::transform(basis0_b.begin(), basis0_b.end(), basis0_b.begin(),
+                   [atol = 1e-14](auto v)
+                   { return std::abs(v) < atol ? 0.0 : v; });
+    for (std::size_t q = 0; q < num_points; ++q)
+    {
+      apply_dof_transformation0(
+          std::span(basis0.data_handle() + q * dim0 * value_size0,
+                    dim0 * value_size0),
+          cell_info0, p, value_size0);
+    }
+
+    // Unroll basis functions for block size
+    for (std::size_t q = 0; q < num_points; ++q)
+      for (std::size_t i = 0; i < dim0; ++i)
+        for (std::size_t j = 0; j < value_size0; ++j)
+          for (int k = 0; k < bs0; ++k)
+            basis_values(q, i * bs0 + k, j * bs0 + k) = basis0(q, i, j);
+
+    // Apply interpolation matrix of V1 to the basis values
+    if (interpolation_ident)
+    {
+      MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
+          T, MDSPAN_IMPL_STANDARD_NAMESPACE::dextents<std::size_t, 3>>
+          A(Ab.data(), num_points, V1.value_size(), space_dim0);
+      for (std::size_t i = 0; i < basis_values.extent(0); ++i)
+        for (std::size_t j = 0; j < basis_values.extent(1); ++j)
+          for (std::size_t k = 0; k < basis_values.extent(2); ++k)
+            A(i, k, j) = basis_values(i, j, k);
+    }
+    else
+    {
+      for (std::size_t i = 0; i < basis_values.extent(1); ++i)
+      {
+        auto values = MDSPAN_IMPL_STANDARD_NAMESPACE::submdspan(
+            basis_values, MDSPAN_IMPL_STANDARD_NAMESPACE::full_extent, i,
+            MDSPAN_IMPL_STANDARD_NAMESPACE::full_extent);
+        fem::impl::interpolation_apply(Pi_1, values, std::span(local1), bs1);
+        for (std::size_t j = 0; j < local1.size(); ++j)
+          Ab[space_dim0 * j + i] = local1[j];
+      }
+    }
+
+    apply_inverse_dof_transform1(Ab, cell_info1, c, space_dim0);
+    mat_set(dofmap1->cell_dofs(c), dofmap0->cell_dofs(p), Ab);
+  }
+}
+
+/// @brief Call `f` with the matrix insertion functor of `A` for its
+/// block size.
+template <dolfinx::scalar T>
+void dispatch_block_size(la::MatrixCSR<T>& A, auto&& f)
+{
+  auto [bs0, bs1] = A.block_size();
+  if (bs0 == 1 and bs1 == 1)
+    f(A.template mat_set_values<1, 1>());
+  else if (bs0 == 2 and bs1 == 2)
+    f(A.template mat_set_values<2, 2>());
+  else if (bs0 == 3 and bs1 == 3)
+    f(A.template mat_set_values<3, 3>());
+  else
+  {
+    throw std::runtime_error("Transfer matrix not supported for block size "
+                             + std::to_string(bs0));
+  }
+}
+} // namespace impl
+
+/// @brief Create the prolongation matrix from a coarse space to a
+/// nested fine space.
+///
+/// The prolongation matrix \f$P\f$ interpolates a function in the
+/// coarse space \f$V_0\f$ into the fine space \f$V_1\f$, i.e. \f$u_1 =
+/// P u_0\f$. The rows are the degrees-of-freedom of `V1` and the
+/// columns the degrees-of-freedom of `V0`. Both spaces must use
+/// elements with an identity map (e.g. Lagrange), and the mesh of `V1`
+/// must be a refinement of the mesh of `V0` with the cells of `V1` on
+/// the same process as their parents (see multigrid::MeshHierarchy).
+///
+/// @param[in] V0 Coarse space.
+/// @param[in] V1 Fine space.
+/// @param[in] parent_cells Parent cell in the mesh of `V0` of each
+/// cell in the mesh of `V1`.
+/// @return Prolongation matrix. Values are set in the owned rows only,
+/// i.e. the matrix should not be reverse scattered.
+template <dolfinx::scalar T, std::floating_point U>
+la::MatrixCSR<T>
+create_prolongation_matrix(const fem::FunctionSpace<U>& V0,
+                           const fem::FunctionSpace<U>& V1,
+                           std::span<const std::int32_t> parent_cells)
+{
+  common::Timer timer("Multigrid: create prolongation matrix");
+
+  auto dofmap0 = V0.dofmap();
+  assert(dofmap0);
+  auto dofmap1 = V1.dofmap();
+  assert(dofmap1);
+
+  const int tdim = V1.mesh()->topology()->dim();
+  std::vector<std::int32_t> cells(
+      V1.mesh()->topology()->index_map(tdim)->size_local());
+  std::iota(cells.begin(), cells.end(), 0);
+  la::SparsityPattern sp(V1.mesh()->comm(),
+                         {dofmap1->index_map, dofmap0->index_map},
+                         {dofmap1->index_map_bs(), dofmap0->index_map_bs()});
+  fem::sparsitybuild::cells(sp, {cells, parent_cells.first(cells.size())},
+                            {*dofmap1, *dofmap0});
+  sp.finalize();
+
+  la::MatrixCSR<T> A(sp);
+  impl::dispatch_block_size(
+      A, [&](auto&& mat_set)
+      { impl::transfer_matrix<T, U>(V0, V1, parent_cells, mat_set); });
+
+  return A;
+}
+
+/// @brief Create the restriction matrix from a nested fine space to a
+/// coarse space.
+///
+/// The restriction matrix is the transpose of the prolongation matrix
+/// (see multigrid::create_prolongation_matrix), \f$R = P^{T}\f$. It
+/// maps residuals on the fine space to the coarse space. The rows are
+/// the degrees-of-freedom of `V0` and the columns the
+/// degrees-of-freedom of `V1`.
+///
+/// @param[in] V0 Coarse space.
+/// @param[in] V1 Fine space.
+/// @param[in] parent_cells Parent cell in the mesh of `V0` of each
+/// cell in the mesh of `V1`.
+/// @return Restriction matrix, with ghost rows accumulated on the
+/// owning processes.
+template <dolfinx::scalar T, std::floating_point U>
+la::MatrixCSR<T>
+create_restriction_matrix(const fem::FunctionSpace<U>& V0,
+                          const fem::FunctionSpace<U>& V1,
+                          std::span<const std::int32_t> parent_cells)
+{
+  common::Timer timer("Multigrid: create restriction matrix");
+
+  auto dofmap0 = V0.dofmap();
+  assert(dofmap0);
+  auto dofmap1 = V1.dofmap();
+  assert(dofmap1);
+
+  const int tdim = V1.mesh()->topology()->dim();
+  std::vector<std::int32_t> cells(
+      V1.mesh()->topology()->index_map(tdim)->size_local());
+  std::iota(cells.begin(), cells.end(), 0);
+  la::SparsityPattern sp(V1.mesh()->comm(),
+                         {dofmap0->index_map, dofmap1->index_map},
+                         {dofmap0->index_map_bs(), dofmap1->index_map_bs()});
+  fem::sparsitybuild::cells(sp, {parent_cells.first(cells.size()), cells},
+                            {*dofmap0, *dofmap1});
+  sp.finalize();
+
+  // Each entry of P is computed on every fine cell that shares the
+  // fine degree-of-freedom. To avoid accumulating duplicates across
+  // processes, an entry is only set by the process that owns the fine
+  // degree-of-freedom; set (rather than add) avoids duplicates from
+  // cells on the same process.
+  const int bs = dofmap1->bs();
+  const std::int32_t size1 = dofmap1->index_map->size_local();
+  la::MatrixCSR<T> A(sp);
+  std::vector<T> At;
+  impl::dispatch_block_size(
+      A,
+      [&](auto&& mat_set)
+      {
+        impl::transfer_matrix<T, U>(
+            V0, V1, parent_cells,
+            [&](std::span<const std::int32_t> dofs1,
+                std::span<const std::int32_t> dofs0, std::span<const T> Ab)
+            {
+              const std::size_t m = dofs1.size() * bs;
+              const std::size_t n = dofs0.size() * bs;
+              At.resize(Ab.size());
+              for (std::size_t i = 0; i < m; ++i)
+              {
+                const bool owned = dofs1[i / bs] < size1;
+                for (std::size_t j = 0; j < n; ++j)
+                  At[j * m + i] = owned ? Ab[i * n + j] : T(0);
+              }
+              mat_set(dofs0, dofs1, At);
+            });
+      });
+  A.scatter_rev();
+
+  return A;
+}
+
+/// @brief Transfer operators between a coarse space and a nested fine
+/// space.
+///
+/// The prolongation and restriction matrices (see
+/// multigrid::create_prolongation_matrix and
+/// multigrid::create_restriction_matrix) are assembled once when the
+/// operator is created. Transfer of a function is then a sparse
+/// matrix-vector product.
+///
+/// @tparam T Scalar type.
+/// @tparam U Mesh geometry scalar type.
+template <dolfinx::scalar T,
+          std::floating_point U = dolfinx::scalar_value_type_t<T>>
+class TransferOperator
+{
+public:
+  /// @brief Create transfer operators.
+  /// @param[in] V0 Coarse space.
+  /// @param[in] V1 Fine space.
+  /// @param[in] parent_cells Parent cell in the mesh of `V0` of each
+  /// cell in the mesh of `V1`.
+  TransferOperator(std::shared_ptr<const fem::FunctionSpace<U>> V0,
+                   std::shared_ptr<const fem::FunctionSpace<U>> V1,
+                   std::span<const std::int32_t> parent_cells)
+      : _V0(V0), _V1(V1),
+        _P(create_prolongation_matrix<T, U>(*V0, *V1, parent_cells)),
+        _R(create_restriction_matrix<T, U>(*V0, *V1, parent_cells)),
+        _x0(_P.index_map(1), _P.block_size()[1]),
+        _x1(_R.index_map(1), _R.block_size()[1])
+  {
+  }
+
+  /// @brief The coarse space.
+  std::shared_ptr<const fem::FunctionSpace<U>> V0() const { return _V0; }
+
+  /// @brief The fine space.
+  std::shared_ptr<const fem::FunctionSpace<U>> V1() const { return _V1; }
+
+  /// @brief The prolongation matrix.
+  const la::MatrixCSR<T>& prolongation() const { return _P; }
+
+  /// @brief The restriction matrix.
+  const la::MatrixCSR<T>& restriction() const { return _R; }
+
+  /// @brief Compute `x1 = P x0`.
+  /// @param[in] x0 Vector on the coarse space. Only owned entries are
+  /// used.
+  /// @param[out] x1 Vector on the fine space. Owned entries are set
+  /// and ghost entries are not updated.
+  void prolong(const la::Vector<T>& x0, la::Vector<T>& x1)
+  {
+    apply(_P, _x0, x0, x1);
+  }
+
+  /// @brief Compute `x0 = R x1`.
+  /// @param[in] x1 Vector on the fine space. Only owned entries are
+  /// used.
+  /// @param[out] x0 Vector on the coarse space. Owned entries are set
+  /// and ghost entries are not updated.
+  void restrict_to(const la::Vector<T>& x1, la::Vector<T>& x0)
+  {
+    apply(_R, _x1, x1, x0);
+  }
+
+  /// @brief Interpolate a function on the coarse space into the fine
+  /// space.
+  /// @param[out] u1 Function on the fine space.
+  /// @param[in] u0 Function on the coarse space.
+  void interpolate(fem::Function<T, U>& u1, const fem::Function<T, U>& u0)
+  {
+    if (u0.function_space() != _V0 or u1.function_space() != _V1)
+    {
+      throw std::runtime_error("Functions are not defined on the spaces of "
+                               "the transfer operator.");
+    }
+
+    prolong(*u0.x(), *u1.x());
+    u1.x()->scatter_fwd();
+  }
+
+private:
+  // Compute y = A x, using the work vector w (with the column index
+  // map of A)
+  static void apply(la::MatrixCSR<T>& A, la::Vector<T>& w,
+                    const la::Vector<T>& x, la::Vector<T>& y)
+  {
+    const std::int32_t size0 = w.index_map()->size_local() * w.bs();
+    std::copy_n(x.array().begin(), size0, w.mutable_array().begin());
+    const std::int32_t size1 = y.index_map()->size_local() * y.bs();
+    std::fill_n(y.mutable_array().begin(), size1, T(0));
+    A.mult(w, y);
+  }
+
+  // Coarse and fine spaces
+  std::shared_ptr<const fem::FunctionSpace<U>> _V0, _V1;
+
+  // Prolongation and restriction matrices
+  la::MatrixCSR<T> _P, _R;
+
+  // Work vectors compatible with the column index maps of the matrices
+  la::Vector<T> _x0, _x1;
+};
+
+/// @brief Create the transfer operators between consecutive levels of
+/// a mesh hierarchy.
+/// @param[in] hierarchy The mesh hierarchy.
+/// @param[in] V Function space on each level of the hierarchy. `V[i]`
+/// must be defined on `hierarchy.mesh(i)`.
+/// @return Transfer operators, where entry `i` transfers between
+/// levels `i` and `i + 1`.
+template <dolfinx::scalar T, std::floating_point U>
+std::vector<TransferOperator<T, U>> create_transfer_operators(
+    const MeshHierarchy<U>& hierarchy,
+    const std::vector<std::shared_ptr<const fem::FunctionSpace<U>>>& V)
+{
+  if ((int)V.size() != hierarchy.num_levels())
+  {
+    throw std::runtime_error(
+        "Number of function spaces does not match number of levels.");
+  }
+
+  std::vector<TransferOperator<T, U>> operators;
+  operators.reserve(V.size() - 1);
+  for (std::size_t i = 0; i + 1 < V.size(); ++i)
+  {
+    if (V[i]->mesh() != hierarchy.mesh(i)
+        or V[i + 1]->mesh() != hierarchy.mesh(i + 1))
+    {
+      throw std::runtime_error(
+          "Function space is not defined on the mesh hierarchy level.");
+    }
+    operators.emplace_back(V[i], V[i + 1], hierarchy.parent_cells(i + 1));
+  }
+
+  return operators;
+}
+
+} // namespace dolfinx::multigrid
@@ -7,7 +7,10 @@
 #ifdef HAS_PETSC
 
 #include "NewtonSolver.h"
+#include <algorithm>
+#include <cmath>
 #include <dolfinx/common/MPI.h>
+#include <dolfinx/common/Timer.h>
 #include <dolfinx/common/log.h>
 #include <dolfinx/la/petsc.h>
 #include <string>
@@ -84,6 +87,8 @@ nls::petsc::NewtonSolver::~NewtonSolver()
     VecDestroy(&_b);
   if (_dx)
     VecDestroy(&_dx);
+  if (_x0)
+    VecDestroy(&_x0);
   if (_matJ)
     MatDestroy(&_matJ);
   if (_matP)
@@ -147,6 +152,7 @@ std::pair<int, bool> nls::petsc::NewtonSolver::solve(Vec x)
   // Reset iteration counts
   _iteration = 0;
   _krylov_iterations = 0;
+  _jacobian_updates = 0;
   _residual = -1;
 
   if (!_fnF)
@@ -161,10 +167,31 @@ std::pair<int, bool> nls::petsc::NewtonSolver::solve(Vec x)
                              "been provided to the NewtonSolver.");
   }
 
-  if (_system)
-    _system(x);
+  if (jacobian_reuse < 0)
+    throw std::runtime_error("Jacobian reuse count must be non-negative.");
+  if (line_search and line_search_max_it < 1)
+  {
+    throw std::runtime_error(
+        "Maximum number of line search iterations must be positive.");
+  }
+
+  // Compute the residual F(x) and, if required, its norm
+  const bool need_norm = jacobian_reuse > 0 or eisenstat_walker or line_search;
+  auto compute_residual = [this, need_norm](Vec x) -> double
+  {
+    common::Timer timer("NewtonSolver: residual");
+    if (_system)
+      _system(x);
+    _fnF(x, _b);
+    PetscReal r = 0.0;
+    if (need_norm)
+      VecNorm(_b, NORM_2, &r);
+    return r;
+  };
+
   assert(_b);
-  _fnF(x, _b);
+  double rnorm = compute_residual(x);
+  double rnorm_prev = rnorm;
 
   // Check convergence
   bool newton_converged = false;
@@ -182,8 +209,8 @@ std::pair<int, bool> nls::petsc::NewtonSolver::solve(Vec x)
                              + convergence_criterion);
   }
 
-  // FIXME: check that this is efficient if A and/or P are unchanged
-  // Set operators
+  // Set operators. The Krylov solver re-uses the preconditioner if the
+  // operators have not been modified between solves.
   if (_matP)
     _solver.set_operators(_matJ, _matP);
   else
@@ -191,33 +218,106 @@ std::pair<int, bool> nls::petsc::NewtonSolver::solve(Vec x)
 
   if (!_dx)
     MatCreateVecs(_matJ, &_dx, nullptr);
+  if (line_search and !_x0)
+    VecDuplicate(_dx, &_x0);
+
+  // Krylov solver tolerances, restored after the solve when using
+  // Eisenstat-Walker forcing terms
+  KSP ksp = _solver.ksp();
+  PetscReal ksp_rtol, ksp_atol, ksp_dtol;
+  PetscInt ksp_maxits;
+  KSPGetTolerances(ksp, &ksp_rtol, &ksp_atol, &ksp_dtol, &ksp_maxits);
+  double eta = ew_eta0;
 
   // Start iterations
+  int reuse_count = 0;
   while (!newton_converged and _iteration < max_it)
   {
-    // Compute Jacobian
-    assert(_matJ);
-    _fnJ(x, _matJ);
+    // Update the Jacobian at the first iteration, after the maximum
+    // number of re-uses, or if the convergence rate has degraded
+    const bool update_jacobian
+        = _iteration == 0 or reuse_count >= jacobian_reuse
+          or rnorm > jacobian_reuse_rate * rnorm_prev;
+    if (update_jacobian or reuse_preconditioner)
+    {
+      common::Timer timer("NewtonSolver: Jacobian");
+      assert(_matJ);
+      _fnJ(x, _matJ);
+      if (_fnP and update_jacobian)
+        _fnP(x, _matP);
+    }
 
-    if (_fnP)
-      _fnP(x, _matP);
+    if (update_jacobian)
+    {
+      ++_jacobian_updates;
+      reuse_count = 0;
+    }
+    else
+      ++reuse_count;
+
+    if (jacobian_reuse > 0)
+    {
+      KSPSetReusePreconditioner(ksp,
+                                update_jacobian ? PETSC_FALSE : PETSC_TRUE);
+    }
+
+    // Eisenstat-Walker (choice 2) forcing term, with safeguard
+    if (eisenstat_walker)
+    {
+      if (_iteration > 0)
+      {
+        double eta_new = ew_gamma * std::pow(rnorm / rnorm_prev, ew_alpha);
+        const double eta_safe = ew_gamma * std::pow(eta, ew_alpha);
+        if (eta_safe > 0.1)
+          eta_new = std::max(eta_new, eta_safe);
+        eta = std::min(eta_new, ew_eta_max);
+      }
+      KSPSetTolerances(ksp, eta, ksp_atol, ksp_dtol, ksp_maxits);
+    }
 
     // Perform linear solve and update total number of Krylov iterations
-    _krylov_iterations += _solver.solve(_dx, _b);
+    {
+      common::Timer timer("NewtonSolver: linear solve");
+      _krylov_iterations += _solver.solve(_dx, _b);
+    }
+
+    // Update solution and compute F
+    rnorm_prev = rnorm;
+    if (line_search)
+    {
+      // Backtracking line search on ||F||, x = x0 - lambda * dx
+      common::Timer timer("NewtonSolver: line search");
+      VecCopy(x, _x0);
+      double lambda = relaxation_parameter;
+      for (int k = 0; k < line_search_max_it; ++k)
+      {
+        VecWAXPY(x, -lambda, _dx, _x0);
+        rnorm = compute_residual(x);
+        if (rnorm <= (1.0 - line_search_c1 * lambda) * rnorm_prev
+            or k == line_search_max_it - 1)
+        {
+          break;
+        }
+        lambda *= 0.5;
+      }
 
-    // Update solution
-    this->_update_solution(*this, _dx, x);
+      // Scale dx to the step taken for the incremental criterion
+      VecScale(_dx, lambda);
+      if (report and lambda < relaxation_parameter
+          and dolfinx::MPI::rank(_comm.comm()) == 0)
+      {
+        spdlog::info("Newton line search: step length {}", lambda);
+      }
+    }
+    else
+    {
+      this->_update_solution(*this, _dx, x);
+      rnorm = compute_residual(x);
+    }
 
     // Increment iteration count
     ++_iteration;
 
-    // FIXME: This step is not needed if residual is based on dx and
-    //        this has converged.
-    // FIXME: But, this function call may update internal variables, etc.
-    // Compute F
-    if (_system)
-      _system(x);
-    _fnF(x, _b);
     // Initialize _residual0
     if (_iteration == 1)
     {
@@ -245,13 +345,19 @@ std::pair<int, bool> nls::petsc::NewtonSolver::solve(Vec x)
       throw std::runtime_error("Unknown convergence criterion string.");
   }
 
+  // Restore Krylov solver settings
+  if (eisenstat_walker)
+    KSPSetTolerances(ksp, ksp_rtol, ksp_atol, ksp_dtol, ksp_maxits);
+  if (jacobian_reuse > 0)
+    KSPSetReusePreconditioner(ksp, PETSC_FALSE);
+
   if (newton_converged)
   {
     if (dolfinx::MPI::rank(_comm.comm()) == 0)
     {
-      spdlog::info("Newton solver finished in {} iterations and {} linear "
-                   "solver iterations.",
-                   _iteration, _krylov_iterations);
+      spdlog::info("Newton solver finished in {} iterations, {} Jacobian "
+                   "updates and {} linear solver iterations.",
+                   _iteration, _jacobian_updates, _krylov_iterations);
     }
   }
   else
@@ -280,6 +386,11 @@ int nls::petsc::NewtonSolver::krylov_iterations() const
 //-----------------------------------------------------------------------------
 int nls::petsc::NewtonSolver::iteration() const { return _iteration; }
 //-----------------------------------------------------------------------------
+int nls::petsc::NewtonSolver::jacobian_updates() const
+{
+  return _jacobian_updates;
+}
+//-----------------------------------------------------------------------------
 double nls::petsc::NewtonSolver::residual() const { return _residual; }
 //-----------------------------------------------------------------------------
 double nls::petsc::NewtonSolver::residual0() const { return _residual0; }
@@ -29,6 +29,25 @@ namespace nls::petsc
 
 /// This class defines a Newton solver for nonlinear systems of
 /// equations of the form \f$F(x) = 0\f$.
+///
+/// By default the Jacobian (and preconditioner) is re-computed at
+/// every iteration and the linear systems are solved to the tolerance
+/// of the Krylov solver. Options are provided to reduce the cost of a
+/// Newton iteration:
+///
+/// - Modified Newton: the Jacobian and preconditioner are re-used for
+///   up to NewtonSolver::jacobian_reuse iterations, or until the
+///   residual reduction ratio exceeds NewtonSolver::jacobian_reuse_rate.
+///   With NewtonSolver::reuse_preconditioner the Jacobian is re-computed
+///   at every iteration and only the preconditioner is re-used.
+/// - Inexact Newton: the relative tolerance of the Krylov solver is
+///   set at each iteration using the Eisenstat-Walker (choice 2)
+///   forcing terms.
+/// - Backtracking line search on the residual norm.
+///
+/// The time spent in each phase is recorded in the timers
+/// `NewtonSolver: residual`, `NewtonSolver: Jacobian`, `NewtonSolver:
+/// linear solve` and `NewtonSolver: line search`.
 
 class NewtonSolver
 {
@@ -129,6 +148,10 @@ public:
   /// @return Initial residual
   double residual0() const;
 
+  /// @brief Get number of Jacobian updates since solve started.
+  /// @return Number of updates.
+  int jacobian_updates() const;
+
   /// @brief Get MPI communicator.
   MPI_Comm comm() const;
 
@@ -154,6 +177,41 @@ public:
   /// Relaxation parameter
   double relaxation_parameter = 1.0;
 
+  /// Maximum number of consecutive iterations for which the Jacobian
+  /// (or preconditioner) is re-used. If zero, the Jacobian is updated
+  /// at every iteration.
+  int jacobian_reuse = 0;
+
+  /// Update the Jacobian if the ratio of successive residual norms
+  /// exceeds this value. Only used if `jacobian_reuse > 0`.
+  double jacobian_reuse_rate = 0.5;
+
+  /// If true, the Jacobian is updated at every iteration and only the
+  /// preconditioner is re-used. Only used if `jacobian_reuse > 0`.
+  bool reuse_preconditioner = false;
+
+  /// Use Eisenstat-Walker forcing terms for the relative tolerance of
+  /// the Krylov solver
+  bool eisenstat_walker = false;
+
+  /// Eisenstat-Walker: initial and maximum forcing term
+  double ew_eta0 = 0.5, ew_eta_max = 0.9;
+
+  /// Eisenstat-Walker: parameters gamma and alpha of the forcing term
+  /// \f$\eta_{k} = \gamma (\|F_{k}\| / \|F_{k-1}\|)^{\alpha}\f$
+  double ew_gamma = 0.9, ew_alpha = 1.5;
+
+  /// Use a backtracking line search on the residual norm. The step
+  /// length is halved until the Armijo condition is satisfied. The line
+  /// search replaces the function set by NewtonSolver::set_update.
+  bool line_search = false;
+
+  /// Line search: maximum number of step length reductions
+  int line_search_max_it = 10;
+
+  /// Line search: sufficient decrease parameter
+  double line_search_c1 = 1e-4;
+
 private:
   // Function for computing the residual vector. The first argument is
   // the latest solution vector x and the second argument is the
@@ -195,6 +253,9 @@ private:
   // Number of iterations
   int _iteration;
 
+  // Number of Jacobian updates since solve began
+  int _jacobian_updates = 0;
+
   // Most recent residual and initial residual
   double _residual, _residual0;
 
@@ -204,6 +265,9 @@ private:
   // Solution vector
   Vec _dx = nullptr;
 
+  // Solution at start of line search
+  Vec _x0 = nullptr;
+
   // MPI communicator
   dolfinx::MPI::Comm _comm;
 };
@@ -0,0 +1,564 @@
+// Copyright (C) 2026 agent
+//
+// This file is part of DOLFINx (https://www.fenicsproject.org)
+//
+// SPDX-License-Identifier:    LGPL-3.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <dolfinx/common/IndexMap.h>
+#include <dolfinx/common/MPI.h>
+#include <dolfinx/common/Timer.h>
+#include <dolfinx/common/log.h>
+#include <dolfinx/common/types.h>
+#include <dolfinx/la/Vector.h>
+#include <dolfinx/la/dense_lu.h>
+#include <functional>
+#include <limits>
+#include <mpi.h>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace dolfinx::nls
+{
+
+/// Nonlinear iteration
+enum class NonlinearMethod
+{
+  newton,  ///< Newton's method
+  broyden, ///< Limited-memory (good) Broyden method
+  anderson ///< Anderson acceleration of a (preconditioned) fixed-point
+           ///< iteration
+};
+
+namespace impl
+{
+/// @brief Process-local contribution to the inner product `a^{H} b` of
+/// the first `n` entries of two arrays.
+template <typename T>
+T local_inner(std::span<const T> a, std::span<const T> b, std::size_t n)
+{
+  return std::transform_reduce(
+      a.begin(), std::next(a.begin(), n), b.begin(), static_cast<T>(0),
+      std::plus{},
+      [](T a, T b) -> T
+      {
+        if constexpr (std::is_same<T, std::complex<double>>::value
+                      or std::is_same<T, std::complex<float>>::value)
+        {
+          return std::conj(a) * b;
+        }
+        else
+          return a * b;
+      });
+}
+} // namespace impl
+
+/// @brief Newton and quasi-Newton solvers for nonlinear systems of
+/// equations \f$F(x) = 0\f$ on distributed vectors.
+///
+/// The solver operates directly on dolfinx::la::Vector objects and does
+/// not depend on PETSc. The linear solver used to compute a Newton
+/// update is supplied as a function that solves \f$J \delta x = b\f$,
+/// where \f$J\f$ is the most recent Jacobian. This can, for example,
+/// wrap a solver for a la::MatrixCSR operator (see
+/// multigrid::GeometricMultigrid) or a matrix-free method. The function
+/// set by NonlinearSolver::setJ is called whenever the Jacobian should
+/// be updated.
+///
+/// For the Broyden and Anderson methods, the initial (inverse)
+/// Jacobian approximation \f$H_{0}\f$ is the inverse of the Jacobian at
+/// the initial guess (and at each restart) if a linear solver has been
+/// set, otherwise it is the identity. Broyden's method stores the
+/// update steps of the inverse Jacobian approximation (see C. T.
+/// Kelley, Iterative Methods for Linear and Nonlinear Equations, SIAM,
+/// 1995) and restarts when NonlinearSolver::memory steps are stored.
+/// Anderson acceleration (type II) is applied to the fixed-point
+/// iteration \f$x \leftarrow x - \beta H_{0} F(x)\f$, where \f$\beta\f$
+/// is the relaxation parameter.
+///
+/// Only owned entries of the vectors are used in the iteration. Ghost
+/// values of the solution vector are updated before the residual and
+/// Jacobian functions are called.
+///
+/// @tparam V The vector type, e.g. la::Vector<double>.
+template <typename V>
+class NonlinearSolver
+{
+public:
+  /// Scalar type
+  using value_type = typename V::value_type;
+
+  /// Real type for norms and tolerances
+  using real_type = dolfinx::scalar_value_type_t<value_type>;
+
+  /// @brief Create a nonlinear solver.
+  /// @param[in] method The nonlinear iteration.
+  explicit NonlinearSolver(NonlinearMethod method = NonlinearMethod::newton)
+      : method(method)
+  {
+  }
+
+  /// @brief Set the function for computing the residual.
+  /// @param[in] F Function that computes the residual `b = F(x)`. Only
+  /// owned entries of `b` are used.
+  void setF(std::function<void(const V& x, V& b)> F) { _fnF = F; }
+
+  /// @brief Set the function for updating the Jacobian (optional).
+  /// @param[in] J Function that updates the Jacobian at `x`, e.g. by
+  /// assembling into a matrix used by the linear solver.
+  void setJ(std::function<void(const V& x)> J) { _fnJ = J; }
+
+  /// @brief Set the linear solver.
+  /// @param[in] solve Function that solves `J dx = b` for the most
+  /// recent Jacobian `J` and returns the number of linear iterations.
+  /// Only owned entries of `b` and `dx` are used.
+  void set_linear_solver(std::function<int(const V& b, V& dx)> solve)
+  {
+    _solve = solve;
+  }
+
+  /// @brief Set the function that is called before the residual or
+  /// Jacobian are computed.
+  /// @param[in] form The function to call. It takes the latest solution
+  /// vector `x` as an argument.
+  void set_form(std::function<void(V& x)> form) { _system = form; }
+
+  /// @brief Solve the nonlinear problem \f$F(x) = 0\f$.
+  /// @param[in,out] x Initial guess on input, solution on output.
+  /// @return (number of iterations, whether iteration converged)
+  std::pair<int, bool> solve(V& x)
+  {
+    common::Timer timer("NonlinearSolver: solve");
+    if (!_fnF)
+      throw std::runtime_error("Residual function has not been set.");
+    if (method == NonlinearMethod::newton and !_solve)
+      throw std::runtime_error("Newton's method requires a linear solver.");
+    if (memory < 1)
+      throw std::runtime_error("Nonlinear solver memory must be positive.");
+
+    _iteration = 0;
+    _linear_iterations = 0;
+    _jacobian_updates = 0;
+    init(x);
+
+    _residual0 = compute_residual(x);
+    _residual = _residual0;
+    bool converged = check_convergence();
+    while (!converged and _iteration < max_it)
+    {
+      switch (method)
+      {
+      case NonlinearMethod::newton:
+        newton_step(x);
+        break;
+      case NonlinearMethod::broyden:
+        broyden_step(x);
+        break;
+      case NonlinearMethod::anderson:
+        anderson_step(x);
+        break;
+      }
+
+      ++_iteration;
+      _residual = compute_residual(x);
+      converged = check_convergence();
+    }
+
+    if (converged)
+    {
+      if (dolfinx::MPI::rank(_comm) == 0)
+      {
+        spdlog::info("Nonlinear solver finished in {} iterations, {} "
+                     "Jacobian updates and {} linear solver iterations.",
+                     _iteration, _jacobian_updates, _linear_iterations);
+      }
+    }
+    else
+    {
+      if (error_on_nonconvergence)
+      {
+        if (_iteration == max_it)
+        {
+          throw std::runtime_error("Nonlinear solver did not converge "
+                                   "because maximum number of iterations "
+                                   "reached");
+        }
+        else
+          throw std::runtime_error("Nonlinear solver did not converge");
+      }
+      else
+        spdlog::warn("Nonlinear solver did not converge.");
+    }
+
+    return {_iteration, converged};
+  }
+
+  /// @brief The number of nonlinear iterations.
+  int iteration() const { return _iteration; }
+
+  /// @brief Number of linear solver iterations since solve started.
+  int linear_iterations() const { return _linear_iterations; }
+
+  /// @brief Number of Jacobian updates since solve started.
+  int jacobian_updates() const { return _jacobian_updates; }
+
+  /// @brief Current residual norm.
+  real_type residual() const { return _residual; }
+
+  /// @brief Initial residual norm.
+  real_type residual0() const { return _residual0; }
+
+  /// Nonlinear iteration
+  NonlinearMethod method;
+
+  /// Maximum number of iterations
+  int max_it = 50;
+
+  /// Relative tolerance on the residual norm
+  double rtol = 1e-9;
+
+  /// Absolute tolerance on the residual norm
+  double atol = 1e-10;
+
+  /// Monitor convergence
+  bool report = true;
+
+  /// Throw error if solver fails to converge
+  bool error_on_nonconvergence = true;
+
+  /// Relaxation parameter (Newton), or mixing parameter (Anderson)
+  double relaxation_parameter = 1.0;
+
+  /// Number of stored Broyden steps before a restart, or depth of the
+  /// Anderson history
+  int memory = 10;
+
+private:
+  // Number of owned entries in a vector
+  static std::int32_t num_owned(const V& x)
+  {
+    return x.index_map()->size_local() * x.bs();
+  }
+
+  // Create work vectors
+  void init(const V& x)
+  {
+    _comm = x.index_map()->comm();
+    auto compatible = [&x](const std::vector<V>& v)
+    {
+      return !v.empty() and v.front().index_map() == x.index_map()
+             and v.front().bs() == x.bs();
+    };
+    if (!compatible(_work))
+    {
+      _work.clear();
+      for (int i = 0; i < 4; ++i)
+        _work.emplace_back(x.index_map(), x.bs());
+    }
+
+    _num_history = 0;
+    _history_start = 0;
+    if (method != NonlinearMethod::newton)
+    {
+      std::size_t size = method == NonlinearMethod::broyden ? memory + 1
+                                                            : 2 * memory;
+      if (_history.size() != size or !compatible(_history))
+      {
+        _history.clear();
+        for (std::size_t i = 0; i < size; ++i)
+          _history.emplace_back(x.index_map(), x.bs());
+      }
+      _snorm2.resize(memory + 1);
+    }
+  }
+
+  // Update ghosts of x, call the form and residual functions and return
+  // the norm of the residual
+  real_type compute_residual(V& x)
+  {
+    common::Timer timer("NonlinearSolver: residual");
+    x.scatter_fwd();
+    if (_system)
+      _system(x);
+    _fnF(x, _work[0]);
+    return la::norm(_work[0]);
+  }
+
+  // Test for convergence
+  bool check_convergence() const
+  {
+    const real_type relative_residual
+        = _residual0 > 0 ? _residual / _residual0 : 0;
+    if (report and dolfinx::MPI::rank(_comm) == 0)
+    {
+      spdlog::info("Nonlinear iteration {}"
+                   ": r (abs) = {} (tol = {}), r (rel) = {} (tol = {})",
+                   _iteration, _residual, atol, relative_residual, rtol);
+    }
+
+    return relative_residual < rtol or _residual < atol;
+  }
+
+  // Update the Jacobian at x
+  void update_jacobian(const V& x)
+  {
+    if (_fnJ)
+    {
+      common::Timer timer("NonlinearSolver: Jacobian");
+      _fnJ(x);
+      ++_jacobian_updates;
+    }
+  }
+
+  // Compute z = -H0 b, where H0 is the inverse of the most recent
+  // Jacobian if a linear solver is set, and otherwise the identity
+  void apply_h0(const V& b, V& z)
+  {
+    const std::int32_t n = num_owned(b);
+    std::span<value_type> _z = z.mutable_array();
+    if (_solve)
+    {
+      common::Timer timer("NonlinearSolver: linear solve");
+      _linear_iterations += _solve(b, z);
+      std::for_each_n(_z.begin(), n, [](auto& v) { v = -v; });
+    }
+    else
+    {
+      std::transform(b.array().begin(), std::next(b.array().begin(), n),
+                     _z.begin(), [](auto v) { return -v; });
+    }
+  }
+
+  // Newton step x <- x - relaxation_parameter * J^{-1} F(x)
+  void newton_step(V& x)
+  {
+    update_jacobian(x);
+    V& dx = _work[1];
+    {
+      common::Timer timer("NonlinearSolver: linear solve");
+      _linear_iterations += _solve(_work[0], dx);
+    }
+
+    std::span<value_type> _x = x.mutable_array();
+    std::span<const value_type> _dx = dx.array();
+    const value_type omega = relaxation_parameter;
+    for (std::int32_t i = 0; i < num_owned(x); ++i)
+      _x[i] -= omega * _dx[i];
+  }
+
+  // Broyden step. The steps s_0, ..., s_n are stored in _history.
+  void broyden_step(V& x)
+  {
+    const std::int32_t n = num_owned(x);
+    V& z = _work[1];
+
+    // Restart with z = -H0 F(x) and a new Jacobian when memory is
+    // exhausted
+    if (_num_history == memory + 1)
+      _num_history = 0;
+    if (_num_history == 0)
+      update_jacobian(x);
+    apply_h0(_work[0], z);
+
+    std::span<value_type> _z = z.mutable_array();
+    if (_num_history > 0)
+    {
+      // Apply the stored rank-one updates of the inverse Jacobian
+      for (int j = 0; j < _num_history - 1; ++j)
+      {
+        const value_type a = la::inner_product(_history[j], z) / _snorm2[j];
+        std::span<const value_type> sj1 = _history[j + 1].array();
+        for (std::int32_t i = 0; i < n; ++i)
+          _z[i] += a * sj1[i];
+      }
+
+      const int k = _num_history - 1;
+      const value_type d
+          = value_type(1) - la::inner_product(_history[k], z) / _snorm2[k];
+      if (std::abs(d) < std::numeric_limits<real_type>::epsilon())
+      {
+        // Update is singular, restart with z = -H0 F(x)
+        _num_history = 0;
+        update_jacobian(x);
+        apply_h0(_work[0], z);
+      }
+      else
+        std::for_each_n(_z.begin(), n, [d](auto& v) { v /= d; });
+    }
+
+    // Store step and update solution
+    std::copy_n(_z.begin(), n,
+                _history[_num_history].mutable_array().begin());
+    _snorm2[_num_history] = la::squared_norm(_history[_num_history]);
+    ++_num_history;
+    std::span<value_type> _x = x.mutable_array();
+    for (std::int32_t i = 0; i < n; ++i)
+      _x[i] += _z[i];
+  }
+
+  // Anderson (type II) step. The differences of iterates and of
+  // preconditioned residuals are stored in a circular buffer in
+  // _history, with dx_i in _history[i] and dg_i in _history[memory +
+  // i].
+  void anderson_step(V& x)
+  {
+    const std::int32_t n = num_owned(x);
+    V& g = _work[1];
+    V& g_prev = _work[2];
+    V& x_prev = _work[3];
+    if (_iteration == 0)
+      update_jacobian(x);
+    apply_h0(_work[0], g);
+
+    std::span<const value_type> _g = g.array();
+    std::span<value_type> _x = x.mutable_array();
+    if (_iteration > 0)
+    {
+      // Append dx = x - x_prev and dg = g - g_prev to the history
+      int k;
+      if (_num_history < memory)
+        k = (_history_start + _num_history++) % memory;
+      else
+      {
+        k = _history_start;
+        _history_start = (_history_start + 1) % memory;
+      }
+
+      std::span<value_type> dx = _history[k].mutable_array();
+      std::span<value_type> dg = _history[memory + k].mutable_array();
+      std::span<const value_type> _xp = x_prev.array();
+      std::span<const value_type> _gp = g_prev.array();
+      for (std::int32_t i = 0; i < n; ++i)
+      {
+        dx[i] = _x[i] - _xp[i];
+        dg[i] = _g[i] - _gp[i];
+      }
+    }
+
+    std::copy_n(_x.begin(), n, x_prev.mutable_array().begin());
+    std::copy_n(_g.begin(), n, g_prev.mutable_array().begin());
+
+    // Solve the least-squares problem min ||g - dG gamma|| by the
+    // normal equations, computing all inner products with a single
+    // reduction
+    const std::size_t m = _num_history;
+    std::vector<value_type> gamma;
+    if (m > 0)
+    {
+      std::vector<value_type> local(m * m + m);
+      for (std::size_t i = 0; i < m; ++i)
+      {
+        std::span<const value_type> dgi
+            = _history[memory + (_history_start + i) % memory].array();
+        for (std::size_t j = i; j < m; ++j)
+        {
+          std::span<const value_type> dgj
+              = _history[memory + (_history_start + j) % memory].array();
+          local[i * m + j] = impl::local_inner(dgi, dgj, n);
+        }
+        local[m * m + i] = impl::local_inner(dgi, _g, n);
+      }
+
+      std::vector<value_type> global(local.size());
+      MPI_Allreduce(local.data(), global.data(), global.size(),
+                    dolfinx::MPI::mpi_type<value_type>(), MPI_SUM, _comm);
+      std::vector<value_type> G(m * m);
+      for (std::size_t i = 0; i < m; ++i)
+      {
+        for (std::size_t j = i; j < m; ++j)
+        {
+          G[i * m + j] = global[i * m + j];
+          if constexpr (std::is_same_v<value_type, real_type>)
+            G[j * m + i] = global[i * m + j];
+          else
+            G[j * m + i] = std::conj(global[i * m + j]);
+        }
+      }
+      gamma.assign(std::next(global.begin(), m * m), global.end());
+
+      // Regularise to guard against (near) linear dependence
+      real_type trace = 0;
+      for (std::size_t i = 0; i < m; ++i)
+        trace += std::real(G[i * m + i]);
+      const real_type eps
+          = 100 * std::numeric_limits<real_type>::epsilon() * trace / m;
+      for (std::size_t i = 0; i < m; ++i)
+        G[i * m + i] += eps;
+
+      std::vector<std::int32_t> perm(m);
+      if (la::impl::lu_factor<value_type>(G, perm))
+      {
+        const std::vector<value_type> rhs = gamma;
+        la::impl::lu_solve<value_type>(G, perm, rhs, gamma);
+      }
+      else
+      {
+        spdlog::warn("Anderson least-squares problem is singular, "
+                     "clearing history.");
+        gamma.clear();
+        _num_history = 0;
+        _history_start = 0;
+      }
+    }
+
+    // x <- x + beta g - sum_i gamma_i (dx_i + beta dg_i)
+    const value_type beta = relaxation_parameter;
+    for (std::int32_t i = 0; i < n; ++i)
+      _x[i] += beta * _g[i];
+    for (std::size_t j = 0; j < gamma.size(); ++j)
+    {
+      const int k = (_history_start + j) % memory;
+      std::span<const value_type> dx = _history[k].array();
+      std::span<const value_type> dg = _history[memory + k].array();
+      for (std::int32_t i = 0; i < n; ++i)
+        _x[i] -= gamma[j] * (dx[i] + beta * dg[i]);
+    }
+  }
+
+  // Residual function
+  std::function<void(const V& x, V& b)> _fnF;
+
+  // Jacobian update function
+  std::function<void(const V& x)> _fnJ;
+
+  // Linear solver
+  std::function<int(const V& b, V& dx)> _solve;
+
+  // Function called before the residual and Jacobian functions
+  std::function<void(V& x)> _system;
+
+  // Work vectors: residual F(x), step/preconditioned residual, and
+  // the previous preconditioned residual and iterate (Anderson)
+  std::vector<V> _work;
+
+  // Broyden steps or Anderson differences
+  std::vector<V> _history;
+
+  // Squared norms of the Broyden steps
+  std::vector<real_type> _snorm2;
+
+  // Number of stored history entries and position of the oldest entry
+  // (Anderson)
+  int _num_history = 0, _history_start = 0;
+
+  // Iteration counts
+  int _iteration = 0, _linear_iterations = 0, _jacobian_updates = 0;
+
+  // Most recent and initial residual norms
+  real_type _residual = 0, _residual0 = 0;
+
+  // Communicator of the solution vector
+  MPI_Comm _comm = MPI_COMM_NULL;
+};
+
+} // namespace dolfinx::nls
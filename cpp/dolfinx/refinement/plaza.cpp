@@ -8,12 +8,14 @@
 #include "utils.h"
 #include <dolfinx/common/IndexMap.h>
 #include <dolfinx/common/Timer.h>
+#include <dolfinx/common/log.h>
 #include <dolfinx/graph/AdjacencyList.h>
 #include <dolfinx/mesh/Geometry.h>
 #include <dolfinx/mesh/Mesh.h>
 #include <dolfinx/mesh/MeshTags.h>
 #include <dolfinx/mesh/Topology.h>
 #include <dolfinx/mesh/utils.h>
+#include <algorithm>
 #include <limits>
 #include <numeric>
 #include <vector>
@@ -183,11 +185,12 @@ get_tetrahedra(std::span<const std::int64_t> indices,
 } // namespace
 
 //-----------------------------------------------------------------------------
-void plaza::impl::enforce_rules(MPI_Comm comm,
-                                const graph::AdjacencyList<int>& shared_edges,
-                                std::span<std::int8_t> marked_edges,
-                                const mesh::Topology& topology,
-                                std::span<const std::int32_t> long_edge)
+std::int32_t
+plaza::impl::enforce_rules(MPI_Comm comm,
+                           const graph::AdjacencyList<int>& shared_edges,
+                           std::span<std::int8_t> marked_edges,
+                           const mesh::Topology& topology,
+                           std::span<const std::int32_t> long_edge)
 {
   common::Timer t0("PLAZA: Enforce rules");
 
@@ -198,11 +201,27 @@ void plaza::impl::enforce_rules(MPI_Comm comm,
   assert(map_e);
   auto map_f = topology.index_map(2);
   assert(map_f);
+  const std::int32_t num_edges = map_e->size_local() + map_e->num_ghosts();
   const std::int32_t num_faces = map_f->size_local() + map_f->num_ghosts();
 
   auto f_to_e = topology.connectivity(2, 1);
   assert(f_to_e);
 
+  // Build (process-local) edge-to-face connectivity
+  std::vector<std::int32_t> e_to_f_offsets(num_edges + 1, 0);
+  for (std::int32_t e : f_to_e->array())
+    ++e_to_f_offsets[e + 1];
+  std::partial_sum(e_to_f_offsets.begin(), e_to_f_offsets.end(),
+                   e_to_f_offsets.begin());
+  std::vector<std::int32_t> e_to_f(e_to_f_offsets.back());
+  {
+    std::vector<std::int32_t> pos(e_to_f_offsets.begin(),
+                                  std::prev(e_to_f_offsets.end()));
+    for (std::int32_t f = 0; f < num_faces; ++f)
+      for (std::int32_t e : f_to_e->links(f))
+        e_to_f[pos[e]++] = f;
+  }
+
   // Get number of neighbors
   int indegree(-1), outdegree(-2), weighted(-1);
   MPI_Dist_graph_neighbors_count(comm, &indegree, &outdegree, &weighted);
@@ -210,42 +229,90 @@ void plaza::impl::enforce_rules(MPI_Comm comm,
   const int num_neighbors = indegree;
   std::vector<std::vector<std::int32_t>> marked_for_update(num_neighbors);
 
-  std::int32_t update_count = 1;
-  while (update_count > 0)
+  // Mark the longest edge of faces that have a marked edge. Newly
+  // marked edges are propagated to their faces until no more edges
+  // are marked, so that each round of communication only has to
+  // propagate markers across process boundaries.
+  std::vector<std::int32_t> faces(num_faces);
+  std::iota(faces.rbegin(), faces.rend(), 0);
+  auto propagate = [&]()
   {
-    update_count = 0;
-    update_logical_edgefunction(comm, marked_for_update, marked_edges, *map_e);
-    for (int i = 0; i < num_neighbors; ++i)
-      marked_for_update[i].clear();
-
-    for (int f = 0; f < num_faces; ++f)
+    while (!faces.empty())
     {
+      const std::int32_t f = faces.back();
+      faces.pop_back();
+
       const std::int32_t long_e = long_edge[f];
       if (marked_edges[long_e])
         continue;
 
-      bool any_marked = false;
-      for (auto edge : f_to_e->links(f))
-        any_marked = any_marked or marked_edges[edge];
-
-      if (any_marked)
+      auto edges = f_to_e->links(f);
+      if (std::none_of(edges.begin(), edges.end(),
+                       [&marked_edges](auto e) { return marked_edges[e]; }))
       {
-        if (!marked_edges[long_e])
-        {
-          marked_edges[long_e] = true;
-
-          // Add sharing neighbors to update set
-          for (int rank : shared_edges.links(long_e))
-            marked_for_update[rank].push_back(long_e);
-        }
-        ++update_count;
+        continue;
       }
+
+      marked_edges[long_e] = true;
+
+      // Add sharing neighbors to update set
+      for (int rank : shared_edges.links(long_e))
+        marked_for_update[rank].push_back(long_e);
+
+      // Faces of the marked edge may now require refinement
+      faces.insert(faces.end(),
+                   std::next(e_to_f.begin(), e_to_f_offsets[long_e]),
+                   std::next(e_to_f.begin(), e_to_f_offsets[long_e + 1]));
     }
+  };
+
+  // Edges that are shared with other processes
+  std::vector<std::int32_t> shared;
+  for (std::int32_t e = 0; e < shared_edges.num_nodes(); ++e)
+    if (!shared_edges.links(e).empty())
+      shared.push_back(e);
+  std::vector<std::int8_t> shared_marked(shared.size());
+
+  std::int32_t num_rounds = 0;
+  propagate();
+  while (true)
+  {
+    // Determine if any process has markers to send. The reduction is
+    // overlapped with the exchange of markers.
+    std::int32_t num_send = 0;
+    for (auto& edges : marked_for_update)
+      num_send += edges.size();
+    std::int32_t num_send_global = 0;
+    MPI_Request request;
+    MPI_Iallreduce(&num_send, &num_send_global, 1, MPI_INT32_T, MPI_SUM, comm,
+                   &request);
+
+    for (std::size_t i = 0; i < shared.size(); ++i)
+      shared_marked[i] = marked_edges[shared[i]];
+    update_logical_edgefunction(comm, marked_for_update, marked_edges, *map_e);
+    for (auto& edges : marked_for_update)
+      edges.clear();
 
-    const std::int32_t update_count_old = update_count;
-    MPI_Allreduce(&update_count_old, &update_count, 1, MPI_INT32_T, MPI_SUM,
-                  comm);
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+    ++num_rounds;
+    if (num_send_global == 0)
+      break;
+
+    // Propagate markers received from other processes
+    for (std::size_t i = 0; i < shared.size(); ++i)
+    {
+      if (const std::int32_t e = shared[i];
+          !shared_marked[i] and marked_edges[e])
+      {
+        faces.insert(faces.end(), std::next(e_to_f.begin(), e_to_f_offsets[e]),
+                     std::next(e_to_f.begin(), e_to_f_offsets[e + 1]));
+      }
+    }
+    propagate();
   }
+
+  spdlog::info("PLAZA: Marker propagation required {} rounds", num_rounds);
+  return num_rounds;
 }
 //-----------------------------------------------------------------------------
 std::pair<std::array<std::int32_t, 32>, std::size_t>
@@ -8,12 +8,14 @@
 #include <cmath>
 #include <cstdint>
 #include <dolfinx/common/MPI.h>
+#include <dolfinx/common/Timer.h>
 #include <dolfinx/graph/AdjacencyList.h>
 #include <dolfinx/mesh/Geometry.h>
 #include <dolfinx/mesh/Mesh.h>
 #include <dolfinx/mesh/Topology.h>
 #include <dolfinx/mesh/utils.h>
 #include <span>
+#include <thread>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -136,12 +138,20 @@ get_simplices(std::span<const std::int64_t> indices,
               std::span<const std::int32_t> longest_edge, int tdim,
               bool uniform);
 
-/// Propagate edge markers according to rules (longest edge of each
-/// face must be marked, if any edge of face is marked)
-void enforce_rules(MPI_Comm comm, const graph::AdjacencyList<int>& shared_edges,
-                   std::span<std::int8_t> marked_edges,
-                   const mesh::Topology& topology,
-                   std::span<const std::int32_t> long_edge);
+/// @brief Propagate edge markers according to rules (longest edge of
+/// each face must be marked, if any edge of face is marked).
+///
+/// Markers are propagated to a fixed point on each process before
+/// markers on shared edges are communicated, so the number of rounds
+/// of communication depends on how often markers cross process
+/// boundaries rather than on the length of the propagation paths.
+///
+/// @return Number of rounds of communication.
+std::int32_t enforce_rules(MPI_Comm comm,
+                           const graph::AdjacencyList<int>& shared_edges,
+                           std::span<std::int8_t> marked_edges,
+                           const mesh::Topology& topology,
+                           std::span<const std::int32_t> long_edge);
 
 /// @brief Get the longest edge of each face (using local mesh index)
 ///
@@ -156,6 +166,7 @@ template <std::floating_point T>
 std::pair<std::vector<std::int32_t>, std::vector<std::int8_t>>
 face_long_edge(const mesh::Mesh<T>& mesh)
 {
+  common::Timer t0("PLAZA: Compute longest edges");
   const int tdim = mesh.topology()->dim();
   // FIXME: cleanup these calls? Some of the happen internally again.
   mesh.topology_mutable()->create_entities(1);
@@ -289,6 +300,7 @@ face_long_edge(const mesh::Mesh<T>& mesh)
 /// than sqrt(2)/2
 /// @param[in] option Option to compute additional information relating refined
 /// and original mesh entities
+/// @param[in] num_threads Number of threads used to refine cells
 /// @return (0) The new mesh topology, (1) the new flattened mesh geometry, (3)
 /// Shape of the new geometry_shape, (4) Map from new cells to parent cells
 /// and (5) map from refined facets to parent facets.
@@ -302,7 +314,7 @@ compute_refinement(MPI_Comm neighbor_comm,
                    const mesh::Mesh<T>& mesh,
                    std::span<const std::int32_t> long_edge,
                    std::span<const std::int8_t> edge_ratio_ok,
-                   plaza::Option option)
+                   plaza::Option option, int num_threads = 1)
 {
   int tdim = mesh.topology()->dim();
   int num_cell_edges = tdim * 3 - 3;
@@ -313,13 +325,10 @@ compute_refinement(MPI_Comm neighbor_comm,
                              or option == plaza::Option::parent_cell_and_facet;
 
   // Make new vertices in parallel
-  const auto [new_vertex_map, new_vertex_coords, xshape]
+  common::Timer t0("PLAZA: Create new vertices");
+  auto [new_vertex_map, new_vertex_coords, xshape]
       = create_new_vertices(neighbor_comm, shared_edges, mesh, marked_edges);
-
-  std::vector<std::int32_t> parent_cell;
-  std::vector<std::int8_t> parent_facet;
-  std::vector<std::int64_t> indices(num_cell_vertices + num_cell_edges);
-  std::vector<std::int32_t> simplex_set;
+  t0.stop();
 
   auto map_c = mesh.topology()->index_map(tdim);
   assert(map_c);
@@ -339,105 +348,151 @@ compute_refinement(MPI_Comm neighbor_comm,
 
   const std::int32_t num_cells = map_c->size_local();
 
-  // Iterate over all cells, and refine if cell has a marked edge
-  std::vector<std::int64_t> cell_topology;
-  for (int c = 0; c < num_cells; ++c)
+  common::Timer t1("PLAZA: Refine cells");
+
+  // Refine the cells in the range [c0, c1) that have a marked edge,
+  // appending the new cells and parent data to the output arrays
+  auto refine_cells = [&, &new_vertex_map = new_vertex_map](
+                          std::int32_t c0, std::int32_t c1,
+                          std::vector<std::int64_t>& cell_topology,
+                          std::vector<std::int32_t>& parent_cell,
+                          std::vector<std::int8_t>& parent_facet)
   {
-    // Create vector of indices in the order [vertices][edges], 3+3 in
-    // 2D, 4+6 in 3D
-
-    // Copy vertices
-    auto vertices = c_to_v->links(c);
-    for (std::size_t v = 0; v < vertices.size(); ++v)
-      indices[v] = global_indices[vertices[v]];
-
-    // Get cell-local indices of marked edges
-    auto edges = c_to_e->links(c);
-    bool no_edge_marked = true;
-    for (std::size_t ei = 0; ei < edges.size(); ++ei)
+    std::vector<std::int64_t> indices(num_cell_vertices + num_cell_edges);
+    std::vector<std::int32_t> longest_edge;
+    for (std::int32_t c = c0; c < c1; ++c)
     {
-      if (marked_edges[edges[ei]])
+      // Create vector of indices in the order [vertices][edges], 3+3
+      // in 2D, 4+6 in 3D
+
+      // Copy vertices
+      auto vertices = c_to_v->links(c);
+      for (std::size_t v = 0; v < vertices.size(); ++v)
+        indices[v] = global_indices[vertices[v]];
+
+      // Get cell-local indices of marked edges
+      auto edges = c_to_e->links(c);
+      bool no_edge_marked = true;
+      for (std::size_t ei = 0; ei < edges.size(); ++ei)
       {
-        no_edge_marked = false;
-        auto it = new_vertex_map.find(edges[ei]);
-        assert(it != new_vertex_map.end());
-        indices[num_cell_vertices + ei] = it->second;
+        if (marked_edges[edges[ei]])
+        {
+          no_edge_marked = false;
+          auto it = new_vertex_map.find(edges[ei]);
+          assert(it != new_vertex_map.end());
+          indices[num_cell_vertices + ei] = it->second;
+        }
+        else
+          indices[num_cell_vertices + ei] = -1;
       }
-      else
-        indices[num_cell_vertices + ei] = -1;
-    }
 
-    if (no_edge_marked)
-    {
-      // Copy over existing cell to new topology
-      for (auto v : vertices)
-        cell_topology.push_back(global_indices[v]);
+      if (no_edge_marked)
+      {
+        // Copy over existing cell to new topology
+        for (auto v : vertices)
+          cell_topology.push_back(global_indices[v]);
 
-      if (compute_parent_cell)
-        parent_cell.push_back(c);
+        if (compute_parent_cell)
+          parent_cell.push_back(c);
 
-      if (compute_facets)
-      {
-        if (tdim == 3)
-          parent_facet.insert(parent_facet.end(), {0, 1, 2, 3});
-        else
-          parent_facet.insert(parent_facet.end(), {0, 1, 2});
+        if (compute_facets)
+        {
+          if (tdim == 3)
+            parent_facet.insert(parent_facet.end(), {0, 1, 2, 3});
+          else
+            parent_facet.insert(parent_facet.end(), {0, 1, 2});
+        }
       }
-    }
-    else
-    {
-      // Need longest edges of each face in cell local indexing. NB in
-      // 2D the face is the cell itself, and there is just one entry.
-      std::vector<std::int32_t> longest_edge;
-      for (auto f : c_to_f->links(c))
-        longest_edge.push_back(long_edge[f]);
-
-      // Convert to cell local index
-      for (std::int32_t& p : longest_edge)
+      else
       {
-        for (std::size_t ej = 0; ej < edges.size(); ++ej)
+        // Need longest edges of each face in cell local indexing. NB
+        // in 2D the face is the cell itself, and there is just one
+        // entry.
+        longest_edge.clear();
+        for (auto f : c_to_f->links(c))
+          longest_edge.push_back(long_edge[f]);
+
+        // Convert to cell local index
+        for (std::int32_t& p : longest_edge)
         {
-          if (p == edges[ej])
+          for (std::size_t ej = 0; ej < edges.size(); ++ej)
           {
-            p = ej;
-            break;
+            if (p == edges[ej])
+            {
+              p = ej;
+              break;
+            }
           }
         }
-      }
 
-      const bool uniform = (tdim == 2) ? edge_ratio_ok[c] : false;
-      const auto [simplex_set_b, simplex_set_size]
-          = get_simplices(indices, longest_edge, tdim, uniform);
-      std::span<const std::int32_t> simplex_set(simplex_set_b.data(),
-                                                simplex_set_size);
+        const bool uniform = (tdim == 2) ? edge_ratio_ok[c] : false;
+        const auto [simplex_set_b, simplex_set_size]
+            = get_simplices(indices, longest_edge, tdim, uniform);
+        std::span<const std::int32_t> simplex_set(simplex_set_b.data(),
+                                                  simplex_set_size);
 
-      // Save parent index
-      const std::int32_t ncells = simplex_set.size() / num_cell_vertices;
-      if (compute_parent_cell)
-      {
-        for (std::int32_t i = 0; i < ncells; ++i)
-          parent_cell.push_back(c);
-      }
-
-      if (compute_facets)
-      {
-        if (tdim == 3)
+        // Save parent index
+        const std::int32_t ncells = simplex_set.size() / num_cell_vertices;
+        if (compute_parent_cell)
         {
-          auto npf = compute_parent_facets<3>(simplex_set);
-          parent_facet.insert(parent_facet.end(), npf.begin(),
-                              std::next(npf.begin(), simplex_set.size()));
+          for (std::int32_t i = 0; i < ncells; ++i)
+            parent_cell.push_back(c);
         }
-        else
+
+        if (compute_facets)
         {
-          auto npf = compute_parent_facets<2>(simplex_set);
-          parent_facet.insert(parent_facet.end(), npf.begin(),
-                              std::next(npf.begin(), simplex_set.size()));
+          if (tdim == 3)
+          {
+            auto npf = compute_parent_facets<3>(simplex_set);
+            parent_facet.insert(parent_facet.end(), npf.begin(),
+                                std::next(npf.begin(), simplex_set.size()));
+          }
+          else
+          {
+            auto npf = compute_parent_facets<2>(simplex_set);
+            parent_facet.insert(parent_facet.end(), npf.begin(),
+                                std::next(npf.begin(), simplex_set.size()));
+          }
         }
+
+        // Convert from cell local index to mesh index and add to cells
+        for (std::int32_t v : simplex_set)
+          cell_topology.push_back(indices[v]);
       }
+    }
+  };
 
-      // Convert from cell local index to mesh index and add to cells
-      for (std::int32_t v : simplex_set)
-        cell_topology.push_back(indices[v]);
+  std::vector<std::int64_t> cell_topology;
+  std::vector<std::int32_t> parent_cell;
+  std::vector<std::int8_t> parent_facet;
+  if (num_threads <= 1)
+    refine_cells(0, num_cells, cell_topology, parent_cell, parent_facet);
+  else
+  {
+    // Refine blocks of cells on each thread and concatenate the
+    // results in cell order
+    std::vector<std::vector<std::int64_t>> cell_topology_t(num_threads);
+    std::vector<std::vector<std::int32_t>> parent_cell_t(num_threads);
+    std::vector<std::vector<std::int8_t>> parent_facet_t(num_threads);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < num_threads; ++i)
+    {
+      auto [c0, c1] = dolfinx::MPI::local_range(i, num_cells, num_threads);
+      threads.emplace_back(refine_cells, c0, c1, std::ref(cell_topology_t[i]),
+                           std::ref(parent_cell_t[i]),
+                           std::ref(parent_facet_t[i]));
+    }
+    for (auto& t : threads)
+      t.join();
+
+    for (int i = 0; i < num_threads; ++i)
+    {
+      cell_topology.insert(cell_topology.end(), cell_topology_t[i].begin(),
+                           cell_topology_t[i].end());
+      parent_cell.insert(parent_cell.end(), parent_cell_t[i].begin(),
+                         parent_cell_t[i].end());
+      parent_facet.insert(parent_facet.end(), parent_facet_t[i].begin(),
+                          parent_facet_t[i].end());
     }
   }
 
@@ -461,14 +516,16 @@ compute_refinement(MPI_Comm neighbor_comm,
 /// redistribute after refinement
 /// @param[in] option Control the computation of parent facets, parent
 /// cells. If an option is unselected, an empty list is returned.
+/// @param[in] num_threads Number of threads used to refine cells
 /// @return Refined mesh and optional parent cell index, parent facet
 /// indices
 template <std::floating_point T>
 std::tuple<mesh::Mesh<T>, std::vector<std::int32_t>, std::vector<std::int8_t>>
-refine(const mesh::Mesh<T>& mesh, bool redistribute, Option option)
+refine(const mesh::Mesh<T>& mesh, bool redistribute, Option option,
+       int num_threads = 1)
 {
   auto [cell_adj, new_coords, xshape, parent_cell, parent_facet]
-      = compute_refinement_data(mesh, option);
+      = compute_refinement_data(mesh, option, num_threads);
 
   if (dolfinx::MPI::size(mesh.comm()) == 1)
   {
@@ -508,14 +565,15 @@ refine(const mesh::Mesh<T>& mesh, bool redistribute, Option option)
 /// redistribute after refinement
 /// @param[in] option Control the computation of parent facets, parent
 /// cells. If an option is unselected, an empty list is returned.
+/// @param[in] num_threads Number of threads used to refine cells
 /// @return New Mesh and optional parent cell index, parent facet indices
 template <std::floating_point T>
 std::tuple<mesh::Mesh<T>, std::vector<std::int32_t>, std::vector<std::int8_t>>
 refine(const mesh::Mesh<T>& mesh, std::span<const std::int32_t> edges,
-       bool redistribute, Option option)
+       bool redistribute, Option option, int num_threads = 1)
 {
   auto [cell_adj, new_vertex_coords, xshape, parent_cell, parent_facet]
-      = compute_refinement_data(mesh, edges, option);
+      = compute_refinement_data(mesh, edges, option, num_threads);
 
   if (dolfinx::MPI::size(mesh.comm()) == 1)
   {
@@ -551,6 +609,7 @@ refine(const mesh::Mesh<T>& mesh, std::span<const std::int32_t> edges,
 /// @param[in] mesh Input mesh to be refined
 /// @param[in] option Control computation of parent facets and parent
 /// cells. If an option is unselected, an empty list is returned.
+/// @param[in] num_threads Number of threads used to refine cells
 /// @return New mesh data: cell topology, vertex coordinates, vertex
 /// coordinates shape, and optional parent cell index, and parent facet
 /// indices.
@@ -558,7 +617,8 @@ template <std::floating_point T>
 std::tuple<graph::AdjacencyList<std::int64_t>, std::vector<T>,
            std::array<std::size_t, 2>, std::vector<std::int32_t>,
            std::vector<std::int8_t>>
-compute_refinement_data(const mesh::Mesh<T>& mesh, Option option)
+compute_refinement_data(const mesh::Mesh<T>& mesh, Option option,
+                        int num_threads = 1)
 {
   common::Timer t0("PLAZA: refine");
   auto topology = mesh.topology();
@@ -604,7 +664,7 @@ compute_refinement_data(const mesh::Mesh<T>& mesh, Option option)
           comm,
           std::vector<std::int8_t>(map_e->size_local() + map_e->num_ghosts(),
                                    true),
-          edge_ranks, mesh, long_edge, edge_ratio_ok, option);
+          edge_ranks, mesh, long_edge, edge_ratio_ok, option, num_threads);
   MPI_Comm_free(&comm);
 
   return {std::move(cell_adj), std::move(new_vertex_coords), xshape,
@@ -618,6 +678,7 @@ compute_refinement_data(const mesh::Mesh<T>& mesh, Option option)
 /// refinement
 /// @param[in] option Control the computation of parent facets, parent
 /// cells. If an option is unselected, an empty list is returned.
+/// @param[in] num_threads Number of threads used to refine cells
 /// @return New mesh data: cell topology, vertex coordinates and parent
 /// cell index, and stored parent facet indices (if requested).
 template <std::floating_point T>
@@ -625,7 +686,8 @@ std::tuple<graph::AdjacencyList<std::int64_t>, std::vector<T>,
            std::array<std::size_t, 2>, std::vector<std::int32_t>,
            std::vector<std::int8_t>>
 compute_refinement_data(const mesh::Mesh<T>& mesh,
-                        std::span<const std::int32_t> edges, Option option)
+                        std::span<const std::int32_t> edges, Option option,
+                        int num_threads = 1)
 {
   common::Timer t0("PLAZA: refine");
   auto topology = mesh.topology();
@@ -691,7 +753,8 @@ compute_refinement_data(const mesh::Mesh<T>& mesh,
 
   auto [cell_adj, new_vertex_coords, xshape, parent_cell, parent_facet]
       = impl::compute_refinement(comm, marked_edges, edge_ranks, mesh,
-                                 long_edge, edge_ratio_ok, option);
+                                 long_edge, edge_ratio_ok, option,
+                                 num_threads);
   MPI_Comm_free(&comm);
 
   return {std::move(cell_adj), std::move(new_vertex_coords), xshape,
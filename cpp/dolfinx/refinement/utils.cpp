@@ -112,10 +112,7 @@ refinement::adjust_indices(const common::IndexMap& map, std::int32_t n)
   std::span src = map.src();
   std::span dest = map.dest();
 
-  MPI_Comm comm;
-  MPI_Dist_graph_create_adjacent(map.comm(), src.size(), src.data(),
-                                 MPI_UNWEIGHTED, dest.size(), dest.data(),
-                                 MPI_UNWEIGHTED, MPI_INFO_NULL, false, &comm);
+  MPI_Comm comm = dolfinx::MPI::neighbourhood_comm(map.comm(), src, dest);
 
   // Communicate offset to neighbors
   std::vector<std::int64_t> offsets(src.size(), 0);
@@ -123,8 +120,6 @@ refinement::adjust_indices(const common::IndexMap& map, std::int32_t n)
   MPI_Neighbor_allgather(&global_offset, 1, MPI_INT64_T, offsets.data(), 1,
                          MPI_INT64_T, comm);
 
-  MPI_Comm_free(&comm);
-
   int local_size = map.size_local();
   std::vector<std::int64_t> global_indices = map.global_indices();
 
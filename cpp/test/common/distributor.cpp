@@ -0,0 +1,75 @@
+// Copyright (C) 2026 agent
+//
+// This file is part of DOLFINx (https://www.fenicsproject.org)
+//
+// SPDX-License-Identifier:    LGPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+#include <dolfinx/common/Distributor.h>
+#include <dolfinx/common/MPI.h>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace dolfinx;
+
+namespace
+{
+void test_distributor()
+{
+  const int mpi_size = dolfinx::MPI::size(MPI_COMM_WORLD);
+  const int mpi_rank = dolfinx::MPI::rank(MPI_COMM_WORLD);
+
+  // Create data with a different number of rows on each rank
+  const std::int32_t num_rows = 20 + 7 * mpi_rank;
+  std::int64_t offset = 0;
+  const std::int64_t num_rows_local = num_rows;
+  MPI_Exscan(&num_rows_local, &offset, 1, MPI_INT64_T, MPI_SUM,
+             MPI_COMM_WORLD);
+  if (mpi_rank == 0)
+    offset = 0;
+  std::int64_t num_rows_global = 0;
+  MPI_Allreduce(&num_rows_local, &num_rows_global, 1, MPI_INT64_T, MPI_SUM,
+                MPI_COMM_WORLD);
+
+  std::vector<std::int64_t> x0(num_rows);
+  std::iota(x0.begin(), x0.end(), offset);
+  std::vector<double> x1(3 * num_rows);
+  for (std::int32_t i = 0; i < num_rows; ++i)
+    for (int j = 0; j < 3; ++j)
+      x1[3 * i + j] = 0.5 * (offset + i) + j;
+
+  // Request random rows, with repeated indices
+  std::mt19937 engine(mpi_rank);
+  std::uniform_int_distribution<std::int64_t> dist(0, num_rows_global - 1);
+  std::vector<std::int64_t> indices(50);
+  std::generate(indices.begin(), indices.end(), [&]() { return dist(engine); });
+  indices.push_back(indices.front());
+
+  common::Distributor distributor(MPI_COMM_WORLD, indices, MPI_COMM_WORLD,
+                                  num_rows);
+  CHECK(distributor.num_rows() == num_rows);
+
+  for (int pass = 0; pass < 2; ++pass)
+  {
+    auto [y0, y1] = distributor.distribute<std::int64_t, double>(
+        {1, 3}, x0, x1);
+    CHECK(y0 == std::vector<std::int64_t>(indices.begin(), indices.end()));
+    CHECK(y1
+          == dolfinx::MPI::distribute_data(MPI_COMM_WORLD, indices,
+                                           MPI_COMM_WORLD, x1, 3));
+    if (mpi_size > 1)
+      CHECK(distributor.statistics().rounds == 1);
+    CHECK(distributor.statistics().bytes_received % (8 + 3 * 8) == 0);
+
+    // Change data, keeping the row distribution
+    for (double& v : x1)
+      v *= 2;
+  }
+}
+} // namespace
+
+TEST_CASE("Distribute data with cached pattern", "[distributor]")
+{
+  CHECK_NOTHROW(test_distributor());
+}
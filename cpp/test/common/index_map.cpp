@@ -4,11 +4,14 @@
 //
 // SPDX-License-Identifier:    LGPL-3.0-or-later
 
+#include <algorithm>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
 #include <dolfinx/common/IndexMap.h>
 #include <dolfinx/common/MPI.h>
 #include <dolfinx/common/Scatterer.h>
+#include <dolfinx/common/Timer.h>
+#include <dolfinx/common/timing.h>
 #include <numeric>
 #include <set>
 #include <vector>
@@ -57,6 +60,34 @@ void test_scatter_fwd(int n)
 
   CHECK(std::all_of(data_ghost.begin(), data_ghost.end(), [=](auto i)
                     { return i == val * ((mpi_rank + 1) % mpi_size); }));
+
+  // Scatter through shared memory, twice to check that the window is
+  // reused
+  requests = sct.create_request_vector(decltype(sct)::type::shm);
+  std::vector<std::int64_t> local_buffer(sct.local_buffer_size(), 0);
+  auto pack_fn = [](auto&& in, auto&& idx, auto&& out)
+  {
+    for (std::size_t i = 0; i < idx.size(); ++i)
+      out[i] = in[idx[i]];
+  };
+  auto unpack_fn = [](auto&& in, auto&& idx, auto&& out, auto op)
+  {
+    for (std::size_t i = 0; i < idx.size(); ++i)
+      out[idx[i]] = op(out[idx[i]], in[i]);
+  };
+  for (std::int64_t v : {val, 2 * val})
+  {
+    std::fill(data_local.begin(), data_local.end(), v * mpi_rank);
+    std::vector<std::int64_t> remote_buffer(sct.remote_buffer_size(), 0);
+    std::fill(data_ghost.begin(), data_ghost.end(), 0);
+    sct.scatter_fwd_begin<std::int64_t>(data_local, local_buffer,
+                                        remote_buffer, pack_fn, requests,
+                                        decltype(sct)::type::shm);
+    sct.scatter_fwd_end<std::int64_t>(remote_buffer, data_ghost, unpack_fn,
+                                      requests);
+    CHECK(std::all_of(data_ghost.begin(), data_ghost.end(), [=](auto i)
+                      { return i == v * ((mpi_rank + 1) % mpi_size); }));
+  }
 }
 
 void test_scatter_rev()
@@ -125,6 +156,18 @@ void test_scatter_rev()
 
   sum = std::reduce(data_local.begin(), data_local.end(), 0);
   CHECK(sum == 2 * n * value * num_ghosts);
+
+  // Scatter through shared memory, with the caller packing the data
+  requests = sct.create_request_vector(decltype(sct)::type::shm);
+  pack_fn(std::span<const std::int64_t>(data_ghost), sct.remote_indices(),
+          std::span<std::int64_t>(remote_buffer));
+  sct.scatter_rev_begin<std::int64_t>(remote_buffer, local_buffer, requests,
+                                      decltype(sct)::type::shm);
+  sct.scatter_rev_end<std::int64_t>(local_buffer, data_local, unpack_fn,
+                                    std::plus<std::int64_t>(), requests);
+
+  sum = std::reduce(data_local.begin(), data_local.end(), 0);
+  CHECK(sum == 3 * n * value * num_ghosts);
 }
 
 void test_consensus_exchange()
@@ -156,6 +199,155 @@ void test_consensus_exchange()
 
   CHECK(dest_ranks0 == dest_ranks1);
 }
+void test_global_to_local()
+{
+  const int mpi_size = dolfinx::MPI::size(MPI_COMM_WORLD);
+  const int mpi_rank = dolfinx::MPI::rank(MPI_COMM_WORLD);
+  const int size_local = 100;
+
+  // Create some ghost entries (in reverse order) on next process
+  const int num_ghosts = (mpi_size - 1) * 3;
+  std::vector<std::int64_t> ghosts(num_ghosts);
+  for (int i = 0; i < num_ghosts; ++i)
+    ghosts[i] = (mpi_rank + 1) % mpi_size * size_local + num_ghosts - 1 - i;
+  std::vector<int> owners(ghosts.size(), (mpi_rank + 1) % mpi_size);
+  const common::IndexMap map(MPI_COMM_WORLD, size_local, ghosts, owners);
+
+  // Map all local indices to global and back, and add indices that are
+  // not on this process
+  std::vector<std::int32_t> indices(size_local + num_ghosts);
+  std::iota(indices.begin(), indices.end(), 0);
+  std::vector<std::int64_t> global(indices.size());
+  map.local_to_global(indices, global);
+  global.push_back(-1);
+  global.push_back(map.size_global());
+
+  std::vector<std::int32_t> local_ref = indices;
+  local_ref.insert(local_ref.end(), {-1, -1});
+
+  // Repeat the queries to make a batch that is split across threads
+  std::vector<std::int64_t> global_batch;
+  std::vector<std::int32_t> local_batch_ref;
+  for (int i = 0; i < 2000; ++i)
+  {
+    global_batch.insert(global_batch.end(), global.begin(), global.end());
+    local_batch_ref.insert(local_batch_ref.end(), local_ref.begin(),
+                           local_ref.end());
+  }
+
+  for (int num_threads : {1, 4})
+  {
+    std::vector<std::int32_t> local(global_batch.size());
+    map.global_to_local(global_batch, local, num_threads);
+    CHECK(local == local_batch_ref);
+  }
+}
+
+void test_node_ghost_volume()
+{
+  const int mpi_size = dolfinx::MPI::size(MPI_COMM_WORLD);
+  const int mpi_rank = dolfinx::MPI::rank(MPI_COMM_WORLD);
+  const int size_local = 10;
+
+  // Ghost 3 entries owned by the next rank and 5 entries owned by the
+  // rank after that
+  std::vector<std::int64_t> ghosts;
+  std::vector<int> owners;
+  for (auto [n, num] : {std::pair{1, 3}, std::pair{2, 5}})
+  {
+    if (n < mpi_size)
+    {
+      const int owner = (mpi_rank + n) % mpi_size;
+      for (int i = 0; i < num; ++i)
+      {
+        ghosts.push_back(std::int64_t(owner) * size_local + i);
+        owners.push_back(owner);
+      }
+    }
+  }
+  const common::IndexMap map(MPI_COMM_WORLD, size_local, ghosts, owners);
+
+  // Compute nodes of two consecutive ranks, e.g. on 4 ranks rank 0
+  // ghosts 3 entries from rank 1 (same node) and 5 from rank 2 (other
+  // node), and rank 3 ghosts 3 entries from rank 0 (other node) and 5
+  // from rank 1 (other node)
+  const std::array<std::int64_t, 2> volume2 = map.node_ghost_volume(2);
+  std::array<std::int64_t, 2> volume_ref = {0, 0};
+  for (std::size_t i = 0; i < owners.size(); ++i)
+    ++volume_ref[owners[i] / 2 == mpi_rank / 2 ? 0 : 1];
+  CHECK(volume2 == volume_ref);
+  if (mpi_size == 4 and mpi_rank == 0)
+    CHECK(volume2 == std::array<std::int64_t, 2>{3, 5});
+  if (mpi_size == 4 and mpi_rank == 3)
+    CHECK(volume2 == std::array<std::int64_t, 2>{0, 8});
+
+  // Each rank is a compute node
+  CHECK(map.node_ghost_volume(1)
+        == std::array<std::int64_t, 2>{0, std::int64_t(ghosts.size())});
+
+  // Compute nodes from shared memory
+  std::array<std::int64_t, 2> volume = map.node_ghost_volume();
+  CHECK(volume[0] + volume[1] == std::int64_t(ghosts.size()));
+}
+
+/// Create ghosts of the first entries on each of the `num_nbrs` next
+/// ranks
+std::pair<std::vector<std::int64_t>, std::vector<int>>
+create_ring_ghosts(int size_local, int num_nbrs, int num_ghosts_per_nbr)
+{
+  const int mpi_size = dolfinx::MPI::size(MPI_COMM_WORLD);
+  const int mpi_rank = dolfinx::MPI::rank(MPI_COMM_WORLD);
+  std::vector<std::int64_t> ghosts;
+  std::vector<int> owners;
+  for (int n = 1; n <= std::min(num_nbrs, mpi_size - 1); ++n)
+  {
+    const int owner = (mpi_rank + n) % mpi_size;
+    for (int i = 0; i < num_ghosts_per_nbr; ++i)
+    {
+      ghosts.push_back(std::int64_t(owner) * size_local + i);
+      owners.push_back(owner);
+    }
+  }
+  return {std::move(ghosts), std::move(owners)};
+}
+
+void test_neighbourhood_constructor()
+{
+  const int mpi_rank = dolfinx::MPI::rank(MPI_COMM_WORLD);
+  const int size_local = 10;
+
+  auto [ghosts, owners] = create_ring_ghosts(size_local, 2, 3);
+  const common::IndexMap parent(MPI_COMM_WORLD, size_local, ghosts, owners);
+
+  // Keep only the ghosts owned by the next rank on even ranks, so the
+  // new graph is a strict subset of the parent graph
+  if (mpi_rank % 2 == 0)
+  {
+    auto n = std::distance(
+        owners.begin(), std::find_if(owners.begin(), owners.end(),
+                                     [&](int r) { return r != owners[0]; }));
+    ghosts.resize(n);
+    owners.resize(n);
+  }
+
+  const common::IndexMap map0(MPI_COMM_WORLD, size_local, ghosts, owners);
+  const common::IndexMap map1(MPI_COMM_WORLD, size_local, ghosts, owners,
+                              {parent.src(), parent.dest()});
+  CHECK(std::ranges::equal(map0.src(), map1.src()));
+  CHECK(std::ranges::equal(map0.dest(), map1.dest()));
+  CHECK(map0.local_range() == map1.local_range());
+  CHECK(map0.size_global() == map1.size_global());
+  CHECK(std::ranges::equal(map0.ghosts(), map1.ghosts()));
+
+  // Owners that are not candidate source ranks are an error. The check
+  // is made before any communication, so all ranks throw.
+  if (dolfinx::MPI::size(MPI_COMM_WORLD) > 1)
+  {
+    CHECK_THROWS_AS(common::IndexMap(MPI_COMM_WORLD, size_local, ghosts,
+                                     owners, {std::span<const int>(), {}}),
+                    std::runtime_error);
+  }
+}
 } // namespace
 
 TEST_CASE("Scatter forward using IndexMap", "[index_map_scatter_fwd]")
@@ -174,3 +366,54 @@ TEST_CASE("Communication graph edges via consensus exchange",
 {
   CHECK_NOTHROW(test_consensus_exchange());
 }
+
+TEST_CASE("Global-to-local index map", "[index_map_global_to_local]")
+{
+  CHECK_NOTHROW(test_global_to_local());
+}
+
+TEST_CASE("Ghost volume on compute node", "[index_map_node_ghost_volume]")
+{
+  CHECK_NOTHROW(test_node_ghost_volume());
+}
+
+TEST_CASE("IndexMap with known neighbourhood", "[index_map_neighbourhood]")
+{
+  CHECK_NOTHROW(test_neighbourhood_constructor());
+}
+
+TEST_CASE("Benchmark IndexMap construction", "[!benchmark]")
+{
+  // Construction is collective, so use a fixed number of repetitions
+  // and report the timings (max over ranks). Run with an increasing
+  // number of ranks to measure how throughput scales.
+  const int size_local = 100000;
+  const int num_repeats = 20;
+  auto [ghosts, owners] = create_ring_ghosts(size_local, 6, 1000);
+  const common::IndexMap parent(MPI_COMM_WORLD, size_local, ghosts, owners);
+
+  for (int i = 0; i < num_repeats; ++i)
+  {
+    common::Timer t("IndexMap: construct with consensus");
+    common::IndexMap map(MPI_COMM_WORLD, size_local, ghosts, owners);
+  }
+
+  for (int i = 0; i < num_repeats; ++i)
+  {
+    common::Timer t("IndexMap: construct with known neighbourhood");
+    common::IndexMap map(MPI_COMM_WORLD, size_local, ghosts, owners,
+                         {parent.src(), parent.dest()});
+  }
+
+  for (int i = 0; i < num_repeats; ++i)
+  {
+    common::Timer t("IndexMap: construct with src/dest");
+    common::IndexMap map(MPI_COMM_WORLD, size_local,
+                         {std::vector(parent.src().begin(), parent.src().end()),
+                          std::vector(parent.dest().begin(),
+                                      parent.dest().end())},
+                         ghosts, owners);
+  }
+
+  list_timings(MPI_COMM_WORLD, {TimingType::wall});
+}
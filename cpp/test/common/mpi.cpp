@@ -0,0 +1,97 @@
+// Copyright (C) 2026 agent
+//
+// This file is part of DOLFINx (https://www.fenicsproject.org)
+//
+// SPDX-License-Identifier:    LGPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+#include <dolfinx/common/MPI.h>
+#include <vector>
+
+using namespace dolfinx;
+
+namespace
+{
+/// Check that a neighbourhood communicator sends to `dest` and receives
+/// from `src`
+bool check_neighbourhood(MPI_Comm comm, const std::vector<int>& src,
+                         const std::vector<int>& dest)
+{
+  const int mpi_rank = dolfinx::MPI::rank(MPI_COMM_WORLD);
+  std::vector<int> send(dest.size(), mpi_rank);
+  std::vector<int> recv(src.size(), -1);
+  send.reserve(1);
+  recv.reserve(1);
+  MPI_Neighbor_alltoall(send.data(), 1, MPI_INT, recv.data(), 1, MPI_INT,
+                        comm);
+  return recv == src;
+}
+
+void test_neighbourhood_comm_cache()
+{
+  const int mpi_size = dolfinx::MPI::size(MPI_COMM_WORLD);
+  const int mpi_rank = dolfinx::MPI::rank(MPI_COMM_WORLD);
+
+  // Ring neighbourhood
+  std::vector<int> src = {(mpi_rank + mpi_size - 1) % mpi_size};
+  std::vector<int> dest = {(mpi_rank + 1) % mpi_size};
+
+  MPI_Comm comm0 = dolfinx::MPI::neighbourhood_comm(MPI_COMM_WORLD, src, dest);
+  CHECK(check_neighbourhood(comm0, src, dest));
+
+  // Use other cached communicators, then get the ring communicator
+  // from the cache again and use it
+  for (std::size_t k = 2; k < 6; ++k)
+  {
+    std::vector<int> s(k, src.front()), d(k, dest.front());
+    MPI_Comm comm = dolfinx::MPI::neighbourhood_comm(MPI_COMM_WORLD, s, d);
+    CHECK(check_neighbourhood(comm, s, d));
+  }
+  MPI_Comm comm1 = dolfinx::MPI::neighbourhood_comm(MPI_COMM_WORLD, src, dest);
+  CHECK(comm1 == comm0);
+  CHECK(check_neighbourhood(comm1, src, dest));
+
+  // Overflow the cache with other patterns, then check that the ring
+  // pattern still gets a valid communicator
+  for (std::size_t k = 2; k < 22; ++k)
+  {
+    std::vector<int> s(k, src.front()), d(k, dest.front());
+    dolfinx::MPI::neighbourhood_comm(MPI_COMM_WORLD, s, d);
+  }
+  MPI_Comm comm2 = dolfinx::MPI::neighbourhood_comm(MPI_COMM_WORLD, src, dest);
+  CHECK(check_neighbourhood(comm2, src, dest));
+}
+
+void test_neighbourhood_comm_cache_empty()
+{
+  const int mpi_rank = dolfinx::MPI::rank(MPI_COMM_WORLD);
+
+  // Two patterns that are empty on rank 0 and differ on other ranks
+  // (self-edges with multiplicity 1 and 2)
+  std::vector<int> nbrs0, nbrs1;
+  if (mpi_rank > 0)
+  {
+    nbrs0 = {mpi_rank};
+    nbrs1 = {mpi_rank, mpi_rank};
+  }
+
+  MPI_Comm comm0
+      = dolfinx::MPI::neighbourhood_comm(MPI_COMM_WORLD, nbrs0, nbrs0);
+  MPI_Comm comm1
+      = dolfinx::MPI::neighbourhood_comm(MPI_COMM_WORLD, nbrs1, nbrs1);
+  CHECK(check_neighbourhood(comm1, nbrs1, nbrs1));
+
+  // Rank 0 matches both patterns, but only the first matches on all
+  // ranks
+  MPI_Comm comm2
+      = dolfinx::MPI::neighbourhood_comm(MPI_COMM_WORLD, nbrs0, nbrs0);
+  CHECK(comm2 == comm0);
+  CHECK(check_neighbourhood(comm2, nbrs0, nbrs0));
+}
+} // namespace
+
+TEST_CASE("Cached neighbourhood communicators", "[mpi_neighbourhood_comm]")
+{
+  CHECK_NOTHROW(test_neighbourhood_comm_cache());
+  CHECK_NOTHROW(test_neighbourhood_comm_cache_empty());
+}
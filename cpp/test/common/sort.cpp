@@ -4,12 +4,139 @@
 //
 // SPDX-License-Identifier:    LGPL-3.0-or-later
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
 #include <dolfinx/common/sort.h>
+#include <array>
 #include <functional>
+#include <numeric>
 #include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+/// Single-threaded radix sort with a fixed digit width, used as the
+/// baseline in the benchmarks
+template <typename T, int BITS = 8>
+void radix_sort_baseline(std::span<T> array)
+{
+  if (array.size() <= 1)
+    return;
+
+  T max_value = *std::max_element(array.begin(), array.end());
+  constexpr int bucket_size = 1 << BITS;
+  T mask = (T(1) << BITS) - 1;
+  int its = 0;
+  while (max_value)
+  {
+    max_value >>= BITS;
+    its++;
+  }
+
+  std::array<std::int32_t, bucket_size> counter;
+  std::array<std::int32_t, bucket_size + 1> offset;
+  std::int32_t mask_offset = 0;
+  std::vector<T> buffer(array.size());
+  std::span<T> current_perm = array;
+  std::span<T> next_perm = buffer;
+  for (int i = 0; i < its; i++)
+  {
+    std::fill(counter.begin(), counter.end(), 0);
+    for (T c : current_perm)
+      counter[(c & mask) >> mask_offset]++;
+    offset[0] = 0;
+    std::partial_sum(counter.begin(), counter.end(), std::next(offset.begin()));
+    for (T c : current_perm)
+    {
+      std::int32_t bucket = (c & mask) >> mask_offset;
+      std::int32_t new_pos = offset[bucket + 1] - counter[bucket];
+      next_perm[new_pos] = c;
+      counter[bucket]--;
+    }
+
+    mask = mask << BITS;
+    mask_offset += BITS;
+    std::swap(current_perm, next_perm);
+  }
+
+  if (its % 2 != 0)
+    std::copy(buffer.begin(), buffer.end(), array.begin());
+}
+
+/// Single-threaded radix argsort with a fixed digit width, used as the
+/// baseline in the benchmarks
+template <typename T, int BITS = 16>
+void argsort_radix_baseline(std::span<const T> array,
+                            std::span<std::int32_t> perm)
+{
+  if (array.size() <= 1)
+    return;
+
+  const auto [min, max] = std::minmax_element(array.begin(), array.end());
+  T range = *max - *min + 1;
+  constexpr int bucket_size = 1 << BITS;
+  T mask = (T(1) << BITS) - 1;
+  std::int32_t mask_offset = 0;
+  int its = 0;
+  while (range)
+  {
+    range >>= BITS;
+    its++;
+  }
+
+  std::array<std::int32_t, bucket_size> counter;
+  std::array<std::int32_t, bucket_size + 1> offset;
+  std::vector<std::int32_t> perm2(perm.size());
+  std::span<std::int32_t> current_perm = perm;
+  std::span<std::int32_t> next_perm = perm2;
+  for (int i = 0; i < its; i++)
+  {
+    std::fill(counter.begin(), counter.end(), 0);
+    for (auto cp : current_perm)
+      counter[((array[cp] - *min) & mask) >> mask_offset]++;
+    offset[0] = 0;
+    std::partial_sum(counter.begin(), counter.end(), std::next(offset.begin()));
+    for (auto cp : current_perm)
+    {
+      std::int32_t bucket = ((array[cp] - *min) & mask) >> mask_offset;
+      std::int32_t pos = offset[bucket + 1] - counter[bucket];
+      next_perm[pos] = cp;
+      counter[bucket]--;
+    }
+
+    std::swap(current_perm, next_perm);
+    mask = mask << BITS;
+    mask_offset += BITS;
+  }
+
+  if (its % 2 == 1)
+    std::copy(perm2.begin(), perm2.end(), perm.begin());
+}
+
+/// Row sort by a sequence of single-threaded argsorts, one per column,
+/// used as the baseline in the benchmarks
+template <typename T>
+std::vector<std::int32_t> sort_by_perm_baseline(std::span<const T> x,
+                                                std::size_t shape1)
+{
+  const std::size_t shape0 = x.size() / shape1;
+  std::vector<std::int32_t> perm(shape0);
+  std::iota(perm.begin(), perm.end(), 0);
+  std::vector<T> column(shape0);
+  for (std::size_t i = 0; i < shape1; ++i)
+  {
+    int col = shape1 - 1 - i;
+    for (std::size_t j = 0; j < shape0; ++j)
+      column[j] = x[j * shape1 + col];
+    argsort_radix_baseline<T>(column, perm);
+  }
+
+  return perm;
+}
+} // namespace
 
 TEMPLATE_TEST_CASE("Test radix sort", "[vector][template]", std::int32_t,
                    std::int64_t)
@@ -69,3 +196,145 @@ TEST_CASE("Test argsort bitset")
                        arr.data() + shape1 * index[i]));
   }
 }
+
+TEMPLATE_TEST_CASE("Test threaded radix sort and argsort", "[vector][template]",
+                   std::int32_t, std::int64_t)
+{
+  // Large enough for the work to be split across threads, and with
+  // negative values and a range that is not a multiple of the digit
+  // width
+  auto num_threads = GENERATE(1, 4);
+  const std::size_t vec_size = 1 << 18;
+  std::uniform_int_distribution<TestType> distribution(-50000, 900000);
+  std::mt19937 engine;
+  std::vector<TestType> vec(vec_size);
+  std::generate(vec.begin(), vec.end(), [&]() { return distribution(engine); });
+
+  std::vector<TestType> vec_sorted = vec;
+  dolfinx::radix_sort(std::span(vec_sorted), num_threads);
+  std::vector<TestType> vec_ref = vec;
+  std::sort(vec_ref.begin(), vec_ref.end());
+  REQUIRE(vec_sorted == vec_ref);
+
+  // Argsort must be stable
+  std::vector<std::int32_t> perm(vec.size());
+  std::iota(perm.begin(), perm.end(), 0);
+  dolfinx::argsort_radix<TestType>(vec, perm, num_threads);
+  std::vector<std::int32_t> perm_ref(vec.size());
+  std::iota(perm_ref.begin(), perm_ref.end(), 0);
+  std::stable_sort(perm_ref.begin(), perm_ref.end(),
+                   [&vec](auto a, auto b) { return vec[a] < vec[b]; });
+  REQUIRE(perm == perm_ref);
+}
+
+TEST_CASE("Test sort by key")
+{
+  auto num_threads = GENERATE(1, 4);
+  const std::size_t size = 1 << 18;
+  std::uniform_int_distribution<std::int64_t> distribution(0, 1000);
+  std::mt19937 engine;
+  std::vector<std::array<std::int64_t, 3>> keys(size);
+  for (auto& k : keys)
+    std::generate(k.begin(), k.end(), [&]() { return distribution(engine); });
+  std::vector<std::int32_t> values(size);
+  std::iota(values.begin(), values.end(), 0);
+
+  std::vector<std::array<std::int64_t, 3>> keys_ref = keys;
+  dolfinx::sort_by_key(std::span(keys), std::span(values), num_threads);
+
+  // Sorting is stable, so the values are the stable argsort of the keys
+  std::vector<std::int32_t> values_ref(size);
+  std::iota(values_ref.begin(), values_ref.end(), 0);
+  std::stable_sort(values_ref.begin(), values_ref.end(),
+                   [&keys_ref](auto a, auto b)
+                   { return keys_ref[a] < keys_ref[b]; });
+  REQUIRE(values == values_ref);
+  REQUIRE(std::is_sorted(keys.begin(), keys.end()));
+}
+
+TEST_CASE("Benchmark radix sort", "[!benchmark]")
+{
+  // Each run sorts its own copy of the unsorted data. The copies are
+  // made before the runs are timed.
+  const std::size_t size = 1 << 22;
+  std::uniform_int_distribution<std::int64_t> distribution(0, 1 << 30);
+  std::mt19937 engine;
+  std::vector<std::int64_t> vec(size);
+  std::generate(vec.begin(), vec.end(), [&]() { return distribution(engine); });
+  std::vector<std::array<std::int64_t, 2>> rows(size / 2);
+  for (std::size_t i = 0; i < rows.size(); ++i)
+    rows[i] = {vec[2 * i], vec[2 * i + 1]};
+  std::vector<std::int32_t> perm0(vec.size());
+  std::iota(perm0.begin(), perm0.end(), 0);
+  const int num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+  BENCHMARK_ADVANCED("std::sort")(Catch::Benchmark::Chronometer meter)
+  {
+    std::vector<std::vector<std::int64_t>> v(meter.runs(), vec);
+    meter.measure([&v](int i) { std::sort(v[i].begin(), v[i].end()); });
+  };
+  BENCHMARK_ADVANCED("radix_sort (baseline)")
+  (Catch::Benchmark::Chronometer meter)
+  {
+    std::vector<std::vector<std::int64_t>> v(meter.runs(), vec);
+    meter.measure([&v](int i) { radix_sort_baseline(std::span(v[i])); });
+  };
+  BENCHMARK_ADVANCED("radix_sort (1 thread)")
+  (Catch::Benchmark::Chronometer meter)
+  {
+    std::vector<std::vector<std::int64_t>> v(meter.runs(), vec);
+    meter.measure([&v](int i) { dolfinx::radix_sort(std::span(v[i])); });
+  };
+  BENCHMARK_ADVANCED("radix_sort (all threads)")
+  (Catch::Benchmark::Chronometer meter)
+  {
+    std::vector<std::vector<std::int64_t>> v(meter.runs(), vec);
+    meter.measure([&v, num_threads](int i)
+                  { dolfinx::radix_sort(std::span(v[i]), num_threads); });
+  };
+  BENCHMARK_ADVANCED("argsort_radix (baseline)")
+  (Catch::Benchmark::Chronometer meter)
+  {
+    std::vector<std::vector<std::int32_t>> perm(meter.runs(), perm0);
+    meter.measure([&](int i)
+                  { argsort_radix_baseline<std::int64_t>(vec, perm[i]); });
+  };
+  BENCHMARK_ADVANCED("argsort_radix (1 thread)")
+  (Catch::Benchmark::Chronometer meter)
+  {
+    std::vector<std::vector<std::int32_t>> perm(meter.runs(), perm0);
+    meter.measure([&](int i)
+                  { dolfinx::argsort_radix<std::int64_t>(vec, perm[i]); });
+  };
+  BENCHMARK_ADVANCED("argsort_radix (all threads)")
+  (Catch::Benchmark::Chronometer meter)
+  {
+    std::vector<std::vector<std::int32_t>> perm(meter.runs(), perm0);
+    meter.measure(
+        [&](int i) {
+          dolfinx::argsort_radix<std::int64_t>(vec, perm[i], num_threads);
+        });
+  };
+  BENCHMARK("sort_by_perm, 2 columns (baseline)")
+  {
+    return sort_by_perm_baseline<std::int64_t>(vec, 2);
+  };
+  BENCHMARK("sort_by_perm, 2 columns (1 thread)")
+  {
+    return dolfinx::sort_by_perm<std::int64_t>(vec, 2);
+  };
+  BENCHMARK_ADVANCED("sort_by_key, 2 columns (all threads)")
+  (Catch::Benchmark::Chronometer meter)
+  {
+    std::vector<std::vector<std::array<std::int64_t, 2>>> r(meter.runs(),
+                                                            rows);
+    std::vector<std::vector<std::int32_t>> values(
+        meter.runs(), std::vector<std::int32_t>(rows.size()));
+    meter.measure(
+        [&r, &values, num_threads](int i)
+        {
+          dolfinx::sort_by_key(std::span(r[i]), std::span(values[i]),
+                               num_threads);
+        });
+  };
+}
@@ -0,0 +1,147 @@
+// Copyright (C) 2026 agent
+//
+// This file is part of DOLFINx (https://www.fenicsproject.org)
+//
+// SPDX-License-Identifier:    LGPL-3.0-or-later
+//
+// Unit tests for graph partitioners
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstdlib>
+#include <dolfinx/common/MPI.h>
+#include <dolfinx/graph/AdjacencyList.h>
+#include <dolfinx/graph/partitioners.h>
+#include <mpi.h>
+#include <numeric>
+#include <vector>
+
+using namespace dolfinx;
+
+namespace
+{
+/// Partition a graph into blocks of consecutive global indices
+graph::AdjacencyList<std::int32_t>
+block_partition(MPI_Comm comm, int nparts,
+                const graph::AdjacencyList<std::int64_t>& graph, bool)
+{
+  const std::int64_t num_local = graph.num_nodes();
+  std::int64_t offset = 0, num_global = 0;
+  MPI_Exscan(&num_local, &offset, 1, MPI_INT64_T, MPI_SUM, comm);
+  if (dolfinx::MPI::rank(comm) == 0)
+    offset = 0;
+  MPI_Allreduce(&num_local, &num_global, 1, MPI_INT64_T, MPI_SUM, comm);
+
+  std::vector<std::int32_t> dest(num_local);
+  for (std::int64_t i = 0; i < num_local; ++i)
+    dest[i] = (offset + i) * nparts / num_global;
+  return graph::regular_adjacency_list(std::move(dest), 1);
+}
+
+/// Chain graph with 4 (rank + 1) nodes on each rank
+graph::AdjacencyList<std::int64_t> create_chain(MPI_Comm comm)
+{
+  const int rank = dolfinx::MPI::rank(comm);
+  const int size = dolfinx::MPI::size(comm);
+  const std::int64_t num_global = 2 * size * (size + 1);
+  const std::int64_t offset = 2 * rank * (rank + 1);
+  std::vector<std::int64_t> edges;
+  std::vector<std::int32_t> offsets = {0};
+  for (std::int64_t g = offset; g < offset + 4 * (rank + 1); ++g)
+  {
+    if (g > 0)
+      edges.push_back(g - 1);
+    if (g < num_global - 1)
+      edges.push_back(g + 1);
+    offsets.push_back(edges.size());
+  }
+  return graph::AdjacencyList<std::int64_t>(std::move(edges),
+                                            std::move(offsets));
+}
+
+void test_hierarchical_partitioner()
+{
+  const int rank = dolfinx::MPI::rank(MPI_COMM_WORLD);
+  const int size = dolfinx::MPI::size(MPI_COMM_WORLD);
+  constexpr int node_size = 2;
+  const int num_nodes = (size + node_size - 1) / node_size;
+
+  const graph::AdjacencyList<std::int64_t> g = create_chain(MPI_COMM_WORLD);
+  graph::partition_fn partfn
+      = graph::create_hierarchical_partitioner(block_partition, node_size);
+  const graph::AdjacencyList<std::int32_t> dest
+      = partfn(MPI_COMM_WORLD, size, g, false);
+  REQUIRE(dest.num_nodes() == g.num_nodes());
+
+  // Gather (global index, destination) of all graph nodes
+  std::vector<std::int32_t> dest_local(g.num_nodes());
+  for (std::int32_t i = 0; i < g.num_nodes(); ++i)
+  {
+    REQUIRE(dest.links(i).size() == 1);
+    dest_local[i] = dest.links(i).front();
+  }
+  const std::int64_t num_global = 2 * size * (size + 1);
+  std::vector<int> counts(size), disp(size + 1, 0);
+  const int num_local = g.num_nodes();
+  MPI_Allgather(&num_local, 1, MPI_INT, counts.data(), 1, MPI_INT,
+                MPI_COMM_WORLD);
+  std::partial_sum(counts.begin(), counts.end(), std::next(disp.begin()));
+  std::vector<std::int32_t> dest_global(num_global);
+  MPI_Allgatherv(dest_local.data(), num_local, MPI_INT32_T,
+                 dest_global.data(), counts.data(), disp.data(), MPI_INT32_T,
+                 MPI_COMM_WORLD);
+
+  // The partition is valid, and every rank gets an equal share of the
+  // graph nodes, also when the compute nodes have different numbers
+  // of ranks
+  CHECK(std::ranges::all_of(dest_global, [size](auto d)
+                            { return d >= 0 and d < size; }));
+  std::vector<std::int64_t> num_dest(size, 0);
+  for (auto d : dest_global)
+    ++num_dest[d];
+  for (std::int64_t n : num_dest)
+    CHECK(std::abs(n * size - num_global) <= 2 * size);
+
+  // The parts are contiguous blocks of the chain, in rank order
+  CHECK(std::ranges::is_sorted(dest_global));
+
+  // With one compute node, or one rank per compute node,
+  // `block_partition` is used directly
+  if (num_nodes == 1 or num_nodes == size)
+    return;
+
+  // Each graph node lands on the compute node that owns the rank that
+  // the first level partition assigned it to
+  for (std::int64_t i = 0; i < num_global; ++i)
+    CHECK(dest_global[i] / node_size == (i * size / num_global) / node_size);
+
+  // With ghosting the owner is unchanged, and the ghost ranks are the
+  // ranks that own neighbouring graph nodes
+  const graph::AdjacencyList<std::int32_t> dest_ghost
+      = partfn(MPI_COMM_WORLD, size, g, true);
+  const std::int64_t offset = 2 * rank * (rank + 1);
+  for (std::int32_t i = 0; i < g.num_nodes(); ++i)
+  {
+    auto links = dest_ghost.links(i);
+    REQUIRE(!links.empty());
+    CHECK(links.front() == dest_local[i]);
+    std::vector<std::int32_t> ghost_ref;
+    for (std::int64_t e : g.links(i))
+      if (dest_global[e] != dest_local[i])
+        ghost_ref.push_back(dest_global[e]);
+    std::ranges::sort(ghost_ref);
+    ghost_ref.erase(std::unique(ghost_ref.begin(), ghost_ref.end()),
+                    ghost_ref.end());
+    std::vector<std::int32_t> ghosts(std::next(links.begin()), links.end());
+    std::ranges::sort(ghosts);
+    CHECK(ghosts == ghost_ref);
+    CHECK(dest_global[offset + i] == dest_local[i]);
+  }
+}
+} // namespace
+
+TEST_CASE("Hierarchical graph partitioner", "[hierarchical_partitioner]")
+{
+  CHECK_NOTHROW(test_hierarchical_partitioner());
+}
@@ -4,24 +4,29 @@
 //
 // SPDX-License-Identifier:    LGPL-3.0-or-later
 
-#ifdef HAS_ADIOS2
-
 #include <algorithm>
+#include <basix/finite-element.h>
 #include <catch2/catch_test_macros.hpp>
 #include <concepts>
+#include <filesystem>
 #include <dolfinx/fem/Function.h>
 #include <dolfinx/fem/FunctionSpace.h>
 #include <dolfinx/fem/utils.h>
 #include <dolfinx/io/ADIOS2Writers.h>
+#include <dolfinx/io/XDMFFile.h>
+#include <dolfinx/io/XDMFTimeSeriesWriter.h>
+#include <dolfinx/io/checkpointing.h>
 #include <dolfinx/mesh/Mesh.h>
 #include <dolfinx/mesh/generation.h>
+#include <limits>
 #include <mpi.h>
+#include <vector>
 
 using namespace dolfinx;
 
 namespace
 {
-
+#ifdef HAS_ADIOS2
 template <std::floating_point T>
 void test_fides_mesh()
 {
@@ -109,8 +114,234 @@ void test_vtx_reuse_mesh()
 
   writer.write(1);
 }
+
+/// Write several steps asynchronously with the BP5 engine, modifying
+/// the function between steps, and read the steps back
+template <std::floating_point T>
+void test_vtx_async()
+{
+  auto mesh = std::make_shared<mesh::Mesh<T>>(
+      mesh::create_rectangle<T>(MPI_COMM_WORLD, {{{0.0, 0.0}, {1.0, 1.0}}},
+                                {22, 12}, mesh::CellType::triangle));
+
+  // Create a Basix continuous Lagrange element of degree 1
+  basix::FiniteElement e = basix::create_element<T>(
+      basix::element::family::P,
+      mesh::cell_type_to_basix_type(mesh::CellType::triangle), 1,
+      basix::element::lagrange_variant::unset,
+      basix::element::dpc_variant::unset, false);
+  auto V = std::make_shared<fem::FunctionSpace<T>>(
+      fem::create_functionspace(mesh, e));
+  auto u = std::make_shared<fem::Function<T>>(V);
+  u->name = "u";
+
+  // Asynchronous writing is only supported by BP5
+  std::filesystem::path f0
+      = "test_vtx_async_bpfile" + std::to_string(sizeof(T)) + ".bp";
+  CHECK_THROWS_AS(io::VTXWriter<T>(mesh->comm(), f0, {u}, "BPFile",
+                                   io::VTXMeshPolicy::update,
+                                   io::ADIOS2WriteMode::async),
+                  std::runtime_error);
+
+  constexpr int num_steps = 3;
+  std::filesystem::path f
+      = "test_vtx_async" + std::to_string(sizeof(T)) + ".bp";
+  {
+    io::VTXWriter<T> writer(mesh->comm(), f, {u}, "BP5",
+                            io::VTXMeshPolicy::update,
+                            io::ADIOS2WriteMode::async);
+    for (int s = 0; s < num_steps; ++s)
+    {
+      std::ranges::fill(u->x()->mutable_array(), s + 1);
+      writer.write(0.1 * s);
+    }
+    writer.close();
+  }
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  // Each rank reads back the block it wrote at each step
+  const int rank = dolfinx::MPI::rank(MPI_COMM_WORLD);
+  adios2::ADIOS adios(MPI_COMM_WORLD);
+  adios2::IO io = adios.DeclareIO("vtx-async-read");
+  io.SetEngine("BP5");
+  adios2::Engine engine = io.Open(f, adios2::Mode::Read);
+  int step = 0;
+  while (engine.BeginStep() == adios2::StepStatus::OK)
+  {
+    adios2::Variable<double> var_t = io.InquireVariable<double>("step");
+    REQUIRE(var_t);
+    double t = -1;
+    engine.Get(var_t, t, adios2::Mode::Sync);
+    CHECK(t == 0.1 * step);
+
+    adios2::Variable<T> var_u = io.InquireVariable<T>("u");
+    REQUIRE(var_u);
+    var_u.SetBlockSelection(rank);
+    std::vector<T> values;
+    engine.Get(var_u, values, adios2::Mode::Sync);
+    CHECK(values.size() == u->x()->array().size());
+    CHECK(std::ranges::all_of(values, [step](auto v)
+                              { return v == step + 1; }));
+    engine.EndStep();
+    ++step;
+  }
+  engine.Close();
+  CHECK(step == num_steps);
+}
+
+/// Write a function of degree `degree` on the first half of the ranks
+/// (if `subcomm` is true) or on all ranks, read it back on all ranks
+/// and compare against interpolation on the mesh that was read. The
+/// function is not symmetric on edges or facets, so a mismatch in the
+/// cell degree-of-freedom ordering of the two meshes changes the
+/// values.
+template <std::floating_point T>
+void test_checkpoint(mesh::CellType celltype, int degree, bool subcomm)
+{
+  const int rank = dolfinx::MPI::rank(MPI_COMM_WORLD);
+  const int size = dolfinx::MPI::size(MPI_COMM_WORLD);
+  MPI_Comm comm;
+  MPI_Comm_split(MPI_COMM_WORLD,
+                 (!subcomm or rank < std::max(size / 2, 1)) ? 0 : MPI_UNDEFINED,
+                 rank, &comm);
+
+  // Create a Basix continuous Lagrange element
+  basix::FiniteElement e = basix::create_element<T>(
+      basix::element::family::P, mesh::cell_type_to_basix_type(celltype),
+      degree, basix::element::lagrange_variant::equispaced,
+      basix::element::dpc_variant::unset, false);
+
+  auto f = [](auto x) -> std::pair<std::vector<T>, std::vector<std::size_t>>
+  {
+    std::vector<T> f;
+    for (std::size_t p = 0; p < x.extent(1); ++p)
+      f.push_back(x(0, p) * x(0, p) * x(0, p) + x(1, p) * x(1, p) * x(2, p)
+                  + x(0, p) * x(1, p));
+    return {f, {f.size()}};
+  };
+
+  std::filesystem::path file
+      = "test_checkpoint" + std::to_string(sizeof(T))
+        + std::to_string(mesh::cell_dim(celltype)) + std::to_string(degree)
+        + (subcomm ? "_sub" : "") + ".bp";
+  if (comm != MPI_COMM_NULL)
+  {
+    auto mesh = std::make_shared<mesh::Mesh<T>>(
+        mesh::cell_dim(celltype) == 2
+            ? mesh::create_rectangle<T>(comm, {{{0.0, 0.0}, {1.0, 1.0}}},
+                                        {8, 6}, celltype)
+            : mesh::create_box<T>(comm, {{{0.0, 0.0, 0.0}, {1.0, 1.0, 1.0}}},
+                                  {3, 2, 2}, celltype));
+    auto V = std::make_shared<fem::FunctionSpace<T>>(
+        fem::create_functionspace(mesh, e));
+    fem::Function<T> u(V);
+    u.interpolate(f);
+
+    adios2::ADIOS adios(comm);
+    adios2::IO io = adios.DeclareIO("checkpoint-write");
+    adios2::Engine engine = io.Open(file, adios2::Mode::Write);
+    io::checkpointing::write_mesh(io, engine, *mesh);
+    io::checkpointing::write_function(io, engine, u, 0.0);
+    std::span<T> x = u.x()->mutable_array();
+    std::transform(x.begin(), x.end(), x.begin(), [](auto v) { return 2 * v; });
+    io::checkpointing::write_function(io, engine, u, 1.0);
+    engine.Close();
+    MPI_Comm_free(&comm);
+  }
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  // Read back on a differently distributed mesh
+  adios2::ADIOS adios(MPI_COMM_WORLD);
+  adios2::IO io = adios.DeclareIO("checkpoint-read");
+  adios2::Engine engine = io.Open(file, adios2::Mode::ReadRandomAccess);
+  auto mesh1 = std::make_shared<mesh::Mesh<T>>(io::checkpointing::read_mesh<T>(
+      io, engine, MPI_COMM_WORLD, mesh::GhostMode::shared_facet));
+  auto V1 = std::make_shared<fem::FunctionSpace<T>>(
+      fem::create_functionspace(mesh1, e));
+  fem::Function<T> u1(V1);
+  io::checkpointing::read_function(io, engine, u1, 1.0);
+  engine.Close();
+
+  fem::Function<T> v1(V1);
+  v1.interpolate(f);
+  std::span<const T> x1 = u1.x()->array();
+  std::span<const T> y1 = v1.x()->array();
+  constexpr T eps = 100 * std::numeric_limits<T>::epsilon();
+  for (std::size_t i = 0; i < x1.size(); ++i)
+    CHECK(std::abs(x1[i] - 2 * y1[i]) < eps);
+}
+#endif
+
+template <std::floating_point T>
+void test_xdmf_time_series(io::MeshPolicy policy)
+{
+  auto mesh = std::make_shared<mesh::Mesh<T>>(
+      mesh::create_rectangle<T>(MPI_COMM_WORLD, {{{0.0, 0.0}, {1.0, 1.0}}},
+                                {6, 4}, mesh::CellType::triangle));
+  basix::FiniteElement e = basix::create_element<T>(
+      basix::element::family::P,
+      mesh::cell_type_to_basix_type(mesh::CellType::triangle), 1,
+      basix::element::lagrange_variant::unset,
+      basix::element::dpc_variant::unset, false);
+  auto V = std::make_shared<fem::FunctionSpace<T>>(
+      fem::create_functionspace(mesh, e));
+  auto u = std::make_shared<fem::Function<T>>(V);
+  auto v = std::make_shared<fem::Function<std::complex<T>>>(V);
+  u->name = "u";
+  v->name = "v";
+
+  std::filesystem::path f = "test_xdmf_time_series"
+                            + std::to_string(sizeof(T))
+                            + std::to_string(static_cast<int>(policy))
+                            + ".xdmf";
+  {
+    io::XDMFTimeSeriesWriter<T> writer(mesh->comm(), f, {u, v}, policy);
+    for (int i = 0; i < 3; ++i)
+    {
+      u->x()->set(i);
+      writer.write(0.1 * i);
+    }
+  }
+
+  // The file must be valid XDMF with the mesh as the first grid
+  io::XDMFFile file(MPI_COMM_WORLD, f, "r");
+  auto [cells, shape] = file.read_topology_data(
+      "mesh", "/Xdmf/Domain"
+                  + std::string(policy == io::MeshPolicy::reuse
+                                    ? ""
+                                    : "/Grid[@CollectionType='Temporal']"));
+  std::int64_t num_cells = shape[0];
+  MPI_Allreduce(MPI_IN_PLACE, &num_cells, 1, MPI_INT64_T, MPI_SUM,
+                MPI_COMM_WORLD);
+  CHECK(num_cells == 6 * 4 * 2);
+}
+
+void test_xdmf_time_series_open_error()
+{
+  auto mesh = std::make_shared<mesh::Mesh<double>>(mesh::create_rectangle(
+      MPI_COMM_WORLD, {{{0.0, 0.0}, {1.0, 1.0}}}, {2, 2},
+      mesh::CellType::triangle));
+  basix::FiniteElement e = basix::create_element<double>(
+      basix::element::family::P,
+      mesh::cell_type_to_basix_type(mesh::CellType::triangle), 1,
+      basix::element::lagrange_variant::unset,
+      basix::element::dpc_variant::unset, false);
+  auto V = std::make_shared<fem::FunctionSpace<double>>(
+      fem::create_functionspace(mesh, e));
+  auto u = std::make_shared<fem::Function<double>>(V);
+
+  // The XDMF file cannot be opened on rank 0 since a directory with
+  // the same name exists. All ranks must throw.
+  std::filesystem::path f = "test_xdmf_time_series_dir.xdmf";
+  if (dolfinx::MPI::rank(MPI_COMM_WORLD) == 0)
+    std::filesystem::create_directories(f);
+  MPI_Barrier(MPI_COMM_WORLD);
+  CHECK_THROWS_AS(io::XDMFTimeSeriesWriter<double>(mesh->comm(), f, {u}),
+                  std::runtime_error);
+}
 } // namespace
 
+#ifdef HAS_ADIOS2
 TEST_CASE("Fides output")
 {
   CHECK_NOTHROW(test_fides_mesh<float>());
@@ -119,10 +350,44 @@ TEST_CASE("Fides output")
   CHECK_NOTHROW(test_fides_function<double>());
 }
 
+TEST_CASE("Checkpointing")
+{
+  CHECK_NOTHROW(
+      test_checkpoint<float>(mesh::CellType::triangle, 2, false));
+  CHECK_NOTHROW(
+      test_checkpoint<double>(mesh::CellType::triangle, 2, false));
+
+  // Degree 3 elements on tetrahedra have edge degrees-of-freedom that
+  // are permuted, and degree 4 elements also have permuted facet
+  // degrees-of-freedom
+  CHECK_NOTHROW(
+      test_checkpoint<double>(mesh::CellType::tetrahedron, 3, false));
+  CHECK_NOTHROW(
+      test_checkpoint<double>(mesh::CellType::tetrahedron, 4, false));
+
+  // Write on a subset of the ranks, read on all ranks
+  CHECK_NOTHROW(
+      test_checkpoint<double>(mesh::CellType::tetrahedron, 3, true));
+  CHECK_NOTHROW(
+      test_checkpoint<double>(mesh::CellType::tetrahedron, 4, true));
+}
+
 TEST_CASE("VTX reuse mesh")
 {
   CHECK_NOTHROW(test_vtx_reuse_mesh<float>());
   CHECK_NOTHROW(test_vtx_reuse_mesh<double>());
 }
 
+TEST_CASE("VTX asynchronous write")
+{
+  CHECK_NOTHROW(test_vtx_async<float>());
+  CHECK_NOTHROW(test_vtx_async<double>());
+}
 #endif
+
+TEST_CASE("XDMF time series")
+{
+  CHECK_NOTHROW(test_xdmf_time_series<float>(io::MeshPolicy::reuse));
+  CHECK_NOTHROW(test_xdmf_time_series<double>(io::MeshPolicy::update));
+  CHECK_NOTHROW(test_xdmf_time_series_open_error());
+}
@@ -7,6 +7,8 @@
 // Unit tests for Distributed la::MatrixCSR
 
 #include "poisson.h"
+#include <algorithm>
+#include <basix/finite-element.h>
 #include <basix/mdspan.hpp>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
@@ -194,6 +196,18 @@ la::MatrixCSR<double> create_operator(MPI_Comm comm)
 
   std::for_each(y.array().begin(), y.array().end(),
                 [](auto a) { REQUIRE(std::abs(a) < 1e-13); });
+
+  // Native matrix-vector product should give the same result
+  la::Vector<double> z(col_map, 1);
+  A.mult(x, z);
+  for (std::int32_t i = 0; i < A.num_owned_rows(); ++i)
+    CHECK(z.array()[i] == Catch::Approx(y.array()[i]).margin(1e-13));
+
+  // Ghost update of x through shared memory should give the same result
+  z.set(0);
+  A.mult(x, z, la::Vector<double>::scatter_type::shm);
+  for (std::int32_t i = 0; i < A.num_owned_rows(); ++i)
+    CHECK(z.array()[i] == Catch::Approx(y.array()[i]).margin(1e-13));
 }
 
 void test_matrix()
@@ -233,6 +247,113 @@ void test_matrix()
   CHECK(Adense(4, 4) != Aref(4, 4));
 }
 
+void test_matrix_mult_blocked()
+{
+  auto map0 = std::make_shared<common::IndexMap>(MPI_COMM_SELF, 3);
+  la::SparsityPattern p(MPI_COMM_SELF, {map0, map0}, {2, 2});
+  p.insert(std::vector{0}, std::vector{0});
+  p.insert(std::vector{0}, std::vector{2});
+  p.insert(std::vector{1}, std::vector{1});
+  p.insert(std::vector{2}, std::vector{0});
+  p.finalize();
+
+  using T = double;
+  la::MatrixCSR<T> A(p);
+  std::vector<T>& values = A.values();
+  std::iota(values.begin(), values.end(), 1);
+
+  la::Vector<T> x(map0, 2);
+  la::Vector<T> y(map0, 2);
+  std::iota(x.mutable_array().begin(), x.mutable_array().end(), 1);
+  y.set(1);
+  A.mult(x, y);
+
+  // Compare to y = 1 + A x using the dense representation of A
+  const std::vector Adense = A.to_dense();
+  for (std::size_t i = 0; i < 6; ++i)
+  {
+    T yi = 1;
+    for (std::size_t j = 0; j < 6; ++j)
+      yi += Adense[i * 6 + j] * x.array()[j];
+    CHECK(y.array()[i] == Catch::Approx(yi));
+  }
+}
+
+/// Compare interpolation by fem::InterpolationOperator to
+/// fem::Function::interpolate
+void test_interpolation_operator()
+{
+  using T = double;
+  auto mesh = std::make_shared<mesh::Mesh<T>>(mesh::create_rectangle<T>(
+      MPI_COMM_WORLD, {{{0.0, 0.0}, {1.0, 1.0}}}, {6, 5},
+      mesh::CellType::triangle,
+      mesh::create_cell_partitioner(mesh::GhostMode::shared_facet)));
+
+  auto cell = mesh::cell_type_to_basix_type(mesh::CellType::triangle);
+  auto lagrange = [cell](int degree, bool discontinuous)
+  {
+    return basix::create_element<T>(
+        basix::element::family::P, cell, degree,
+        basix::element::lagrange_variant::gll_warped,
+        basix::element::dpc_variant::unset, discontinuous);
+  };
+  auto nedelec = basix::create_element<T>(
+      basix::element::family::N1E, cell, 1,
+      basix::element::lagrange_variant::legendre,
+      basix::element::dpc_variant::unset, false);
+  auto space = [mesh](const basix::FiniteElement<T>& e,
+                      const std::vector<std::size_t>& shape)
+  {
+    return std::make_shared<const fem::FunctionSpace<T>>(
+        fem::create_functionspace(mesh, e, shape));
+  };
+
+  // Pairs of spaces (interpolate from, interpolate to)
+  using V_t = std::shared_ptr<const fem::FunctionSpace<T>>;
+  const std::vector<std::pair<V_t, V_t>> spaces
+      = {{space(lagrange(2, false), {}), space(lagrange(1, false), {})},
+         {space(lagrange(2, false), {2}), space(lagrange(1, false), {2})},
+         {space(nedelec, {}), space(lagrange(1, true), {2})}};
+  for (auto& [V0, V1] : spaces)
+  {
+    const std::size_t value_size = V0->value_size();
+    auto f = [value_size](auto x)
+        -> std::pair<std::vector<T>, std::vector<std::size_t>>
+    {
+      const std::size_t num_points = x.extent(1);
+      std::vector<T> f(value_size * num_points);
+      for (std::size_t p = 0; p < num_points; ++p)
+      {
+        f[p] = x(0, p) * x(1, p) + 1;
+        if (value_size > 1)
+          f[num_points + p] = x(0, p) - x(1, p) * x(1, p);
+      }
+      return {f, {value_size, num_points}};
+    };
+
+    fem::Function<T> u0(V0);
+    u0.interpolate(f);
+    fem::Function<T> u1(V1);
+    fem::Function<T> u1_ref(V1);
+    u1_ref.interpolate(u0);
+
+    // Apply the operator twice to check that it can be re-used
+    fem::InterpolationOperator<T> op(V0, V1);
+    for (T scale : {1.0, 2.0})
+    {
+      std::span<T> x0 = u0.x()->mutable_array();
+      std::transform(x0.begin(), x0.end(), x0.begin(),
+                     [scale](auto x) { return scale * x; });
+      op.apply(u1, u0);
+
+      std::span<const T> x1 = u1.x()->array();
+      std::span<const T> x1_ref = u1_ref.x()->array();
+      for (std::size_t i = 0; i < x1.size(); ++i)
+        CHECK(x1[i] == Catch::Approx(scale * x1_ref[i]).margin(1e-12));
+    }
+  }
+}
+
 } // namespace
 
 TEST_CASE("Linear Algebra CSR Matrix", "[la_matrix]")
@@ -240,4 +361,10 @@ TEST_CASE("Linear Algebra CSR Matrix", "[la_matrix]")
   CHECK_NOTHROW(test_matrix());
   CHECK_NOTHROW(test_matrix_apply());
   CHECK_NOTHROW(test_matrix_norm());
+  CHECK_NOTHROW(test_matrix_mult_blocked());
+}
+
+TEST_CASE("Interpolation operator", "[interpolation_operator]")
+{
+  CHECK_NOTHROW(test_interpolation_operator());
 }
@@ -154,6 +154,42 @@ void test_distributed_mesh(mesh::CellPartitionFunction partitioner)
   if (subset_comm != MPI_COMM_NULL)
     MPI_Comm_free(&subset_comm);
 }
+
+[[maybe_unused]] void
+test_weighted_partition(const graph::weighted_partition_fn& partfn)
+{
+  // Cells with x < 0.25 are ten times as costly as the other cells
+  constexpr int n = 12;
+  auto cost = [](const std::vector<mesh::CellType>&,
+                 const std::vector<std::span<const std::int64_t>>& cells)
+  {
+    std::vector<std::int32_t> weights;
+    for (std::size_t c = 0; c < cells.front().size(); c += 8)
+      weights.push_back(cells.front()[c] % (n + 1) < n / 4 ? 10 : 1);
+    return weights;
+  };
+
+  mesh::Mesh<double> mesh = mesh::create_box(
+      MPI_COMM_WORLD, {{{0.0, 0.0, 0.0}, {1.0, 1.0, 1.0}}}, {n, n, n},
+      mesh::CellType::hexahedron,
+      mesh::create_cell_partitioner(mesh::GhostMode::none, cost, 1, partfn));
+
+  // Compute the cost of the owned cells from the cell coordinates
+  const int tdim = mesh.topology()->dim();
+  auto x_dofmap = mesh.geometry().dofmap();
+  std::span<const double> x = mesh.geometry().x();
+  double load = 0;
+  for (std::int32_t c = 0; c < mesh.topology()->index_map(tdim)->size_local();
+       ++c)
+  {
+    double x0 = 1;
+    for (std::size_t i = 0; i < x_dofmap.extent(1); ++i)
+      x0 = std::min(x0, x[3 * x_dofmap(c, i)]);
+    load += x0 < 0.24 ? 10 : 1;
+  }
+
+  CHECK(mesh::load_imbalance(mesh.comm(), load) < 1.2);
+}
 } // namespace
 
 /// Create a mesh on even ranks and distribute to all ranks in mpi_comm
@@ -194,3 +230,18 @@ TEST_CASE("Distributed Mesh", "[distributed_mesh]")
       mesh::GhostMode::none, graph::kahip::partitioner(1, 1, 0.03, false))));
 #endif
 }
+
+TEST_CASE("Weighted partition", "[weighted_partition]")
+{
+#ifdef HAS_PTSCOTCH
+  CHECK_NOTHROW(test_weighted_partition(graph::scotch::weighted_partitioner()));
+#endif
+#ifdef HAS_PARMETIS
+  CHECK_NOTHROW(
+      test_weighted_partition(graph::parmetis::weighted_partitioner()));
+#endif
+#ifdef HAS_KAHIP
+  CHECK_NOTHROW(test_weighted_partition(
+      graph::kahip::weighted_partitioner(1, 1, 0.03, false)));
+#endif
+}
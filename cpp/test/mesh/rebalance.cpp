@@ -0,0 +1,198 @@
+// Copyright (C) 2026 agent
+//
+// This file is part of DOLFINx (https://www.fenicsproject.org)
+//
+// SPDX-License-Identifier:    LGPL-3.0-or-later
+//
+// Unit tests for mesh redistribution
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <dolfinx/common/IndexMap.h>
+#include <dolfinx/common/MPI.h>
+#include <dolfinx/graph/AdjacencyList.h>
+#include <dolfinx/mesh/MeshTags.h>
+#include <dolfinx/mesh/generation.h>
+#include <dolfinx/mesh/rebalance.h>
+#include <dolfinx/mesh/utils.h>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <vector>
+
+using namespace dolfinx;
+
+namespace
+{
+constexpr int N = 16;
+
+/// Create a triangle mesh of the unit square with all cells on rank 0
+mesh::Mesh<double> create_mesh_rank0()
+{
+  auto part = [](MPI_Comm, int, const std::vector<mesh::CellType>&,
+                 const std::vector<std::span<const std::int64_t>>& cells)
+  {
+    return graph::regular_adjacency_list(
+        std::vector<std::int32_t>(cells.front().size() / 3, 0), 1);
+  };
+  return mesh::create_rectangle(MPI_COMM_WORLD, {{{0.0, 0.0}, {1.0, 1.0}}},
+                                {N, N}, mesh::CellType::triangle, part);
+}
+
+/// Minimum x-coordinate of the geometry nodes of each cell (owned and
+/// ghost)
+std::vector<double> cell_min_x(const mesh::Mesh<double>& mesh)
+{
+  const int tdim = mesh.topology()->dim();
+  auto cell_map = mesh.topology()->index_map(tdim);
+  auto x_dofmap = mesh.geometry().dofmap();
+  std::span<const double> x = mesh.geometry().x();
+  std::vector<double> min_x(cell_map->size_local() + cell_map->num_ghosts(),
+                            1);
+  for (std::size_t c = 0; c < min_x.size(); ++c)
+    for (std::size_t i = 0; i < x_dofmap.extent(1); ++i)
+      min_x[c] = std::min(min_x[c], x[3 * x_dofmap(c, i)]);
+  return min_x;
+}
+
+/// Cell weights with the cells with x < 0.25 ten times as costly as
+/// the other cells
+std::vector<double> weights(const mesh::Mesh<double>& mesh)
+{
+  const int tdim = mesh.topology()->dim();
+  std::vector<double> w = cell_min_x(mesh);
+  w.resize(mesh.topology()->index_map(tdim)->size_local());
+  std::transform(w.begin(), w.end(), w.begin(),
+                 [](auto x0) { return x0 < 0.24 ? 10.0 : 1.0; });
+  return w;
+}
+
+/// Facet tags with value 1 on x = 0 and value 2 on y = 0
+mesh::MeshTags<std::int32_t> facet_tags(const mesh::Mesh<double>& mesh)
+{
+  auto marker = [](int i)
+  {
+    return [i](auto x)
+    {
+      std::vector<std::int8_t> marked;
+      for (std::size_t p = 0; p < x.extent(1); ++p)
+        marked.push_back(std::abs(x(i, p)) < 1e-10);
+      return marked;
+    };
+  };
+  std::vector<std::int32_t> facets0 = mesh::locate_entities(mesh, 1, marker(0));
+  std::vector<std::int32_t> facets1 = mesh::locate_entities(mesh, 1, marker(1));
+
+  std::vector<std::pair<std::int32_t, std::int32_t>> tags;
+  for (auto f : facets0)
+    tags.emplace_back(f, 1);
+  for (auto f : facets1)
+    tags.emplace_back(f, 2);
+  std::sort(tags.begin(), tags.end());
+
+  std::vector<std::int32_t> indices, values;
+  for (auto [f, v] : tags)
+  {
+    indices.push_back(f);
+    values.push_back(v);
+  }
+  return mesh::MeshTags<std::int32_t>(mesh.topology(), 1, std::move(indices),
+                                      std::move(values));
+}
+
+void test_load_imbalance()
+{
+  const int size = dolfinx::MPI::size(MPI_COMM_WORLD);
+  const int rank = dolfinx::MPI::rank(MPI_COMM_WORLD);
+  const double imbalance = mesh::load_imbalance(MPI_COMM_WORLD, rank + 1);
+  CHECK(std::abs(imbalance - 2.0 * size / (size + 1)) < 1e-12);
+  CHECK(mesh::load_imbalance(MPI_COMM_WORLD, 0.0) == -1);
+}
+
+void test_rebalance()
+{
+  const int size = dolfinx::MPI::size(MPI_COMM_WORLD);
+  mesh::Mesh<double> mesh0 = create_mesh_rank0();
+  mesh::Mesh<double> mesh1 = mesh::rebalance(
+      mesh0, mesh::create_cell_partitioner(mesh::GhostMode::none));
+
+  auto map0 = mesh0.topology()->index_map(2);
+  auto map1 = mesh1.topology()->index_map(2);
+  CHECK(map1->size_global() == map0->size_global());
+  CHECK(map1->size_global() == 2 * N * N);
+  if (size > 1)
+    CHECK(map1->size_local() > 0);
+}
+
+void test_rebalance_weighted()
+{
+  const int size = dolfinx::MPI::size(MPI_COMM_WORLD);
+  mesh::Mesh<double> mesh0 = create_mesh_rank0();
+  std::vector<double> w0 = weights(mesh0);
+  std::optional<mesh::Mesh<double>> mesh1 = mesh::rebalance(mesh0, w0);
+  if (size == 1)
+  {
+    CHECK(!mesh1);
+    return;
+  }
+
+  REQUIRE(mesh1);
+  CHECK(mesh1->topology()->index_map(2)->size_global() == 2 * N * N);
+  std::vector<double> w1 = weights(*mesh1);
+  const double load = std::reduce(w1.begin(), w1.end(), 0.0);
+  CHECK(mesh::load_imbalance(mesh1->comm(), load) < 1.2);
+}
+
+void test_migrate_meshtags()
+{
+  mesh::Mesh<double> mesh0 = create_mesh_rank0();
+  mesh::Mesh<double> mesh1 = mesh::rebalance(
+      mesh0, mesh::create_cell_partitioner(mesh::GhostMode::shared_facet));
+
+  // Facet tags
+  {
+    mesh::MeshTags<std::int32_t> tags0 = facet_tags(mesh0);
+    mesh::MeshTags<std::int32_t> tags1
+        = mesh::migrate_meshtags(tags0, mesh0, mesh1);
+    mesh::MeshTags<std::int32_t> ref = facet_tags(mesh1);
+    CHECK(tags1.dim() == 1);
+    CHECK(std::ranges::equal(tags1.indices(), ref.indices()));
+    CHECK(std::ranges::equal(tags1.values(), ref.values()));
+  }
+
+  // Cell tags with floating point values
+  {
+    std::vector<double> min_x0 = cell_min_x(mesh0);
+    std::vector<std::int32_t> cells0(min_x0.size());
+    std::iota(cells0.begin(), cells0.end(), 0);
+    mesh::MeshTags<double> tags0(mesh0.topology(), 2, std::move(cells0),
+                                 std::move(min_x0));
+    mesh::MeshTags<double> tags1 = mesh::migrate_meshtags(tags0, mesh0, mesh1);
+
+    std::vector<double> min_x1 = cell_min_x(mesh1);
+    REQUIRE(tags1.indices().size() == min_x1.size());
+    for (std::size_t i = 0; i < tags1.indices().size(); ++i)
+    {
+      CHECK(tags1.indices()[i] == static_cast<std::int32_t>(i));
+      CHECK(tags1.values()[i] == min_x1[i]);
+    }
+  }
+}
+} // namespace
+
+TEST_CASE("Load imbalance", "[load_imbalance]")
+{
+  CHECK_NOTHROW(test_load_imbalance());
+}
+
+TEST_CASE("Rebalance mesh", "[rebalance]")
+{
+  CHECK_NOTHROW(test_rebalance());
+  CHECK_NOTHROW(test_rebalance_weighted());
+}
+
+TEST_CASE("Migrate MeshTags", "[migrate_meshtags]")
+{
+  CHECK_NOTHROW(test_migrate_meshtags());
+}
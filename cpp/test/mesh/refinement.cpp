@@ -0,0 +1,320 @@
+// Copyright (C) 2026 agent
+//
+// This file is part of DOLFINx (https://www.fenicsproject.org)
+//
+// SPDX-License-Identifier:    LGPL-3.0-or-later
+//
+// Unit tests for Plaza mesh refinement
+
+#include <algorithm>
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <dolfinx/common/IndexMap.h>
+#include <dolfinx/common/MPI.h>
+#include <dolfinx/graph/AdjacencyList.h>
+#include <dolfinx/la/Vector.h>
+#include <dolfinx/mesh/Mesh.h>
+#include <dolfinx/mesh/Topology.h>
+#include <dolfinx/mesh/generation.h>
+#include <dolfinx/mesh/utils.h>
+#include <dolfinx/refinement/plaza.h>
+#include <dolfinx/refinement/utils.h>
+#include <span>
+#include <utility>
+#include <vector>
+
+using namespace dolfinx;
+
+namespace
+{
+/// Create a unit square/cube mesh on `comm`
+mesh::Mesh<double> create_mesh(MPI_Comm comm, mesh::CellType cell_type)
+{
+  return cell_type == mesh::CellType::triangle
+             ? mesh::create_rectangle(comm, {{{0.0, 0.0}, {1.0, 1.0}}},
+                                      {16, 16}, cell_type)
+             : mesh::create_box(comm, {{{0.0, 0.0, 0.0}, {1.0, 1.0, 1.0}}},
+                                {6, 6, 6}, cell_type);
+}
+
+/// Locate edges in a band through the domain, which is split between
+/// ranks
+std::vector<std::int32_t> locate_band(const mesh::Mesh<double>& mesh)
+{
+  return mesh::locate_entities(
+      mesh, 1,
+      [](auto x)
+      {
+        std::vector<std::int8_t> marker(x.extent(1));
+        for (std::size_t p = 0; p < x.extent(1); ++p)
+          marker[p] = std::abs(x(0, p) - x(1, p)) < 0.1;
+        return marker;
+      });
+}
+
+/// Propagate edge markers with a sweep over all faces per round of
+/// communication, which is how plaza::impl::enforce_rules propagated
+/// markers before it propagated them to a local fixed point. Used as
+/// the reference for the number of rounds.
+std::int32_t enforce_rules_sweep(MPI_Comm comm,
+                                 const graph::AdjacencyList<int>& shared_edges,
+                                 std::span<std::int8_t> marked_edges,
+                                 const mesh::Topology& topology,
+                                 std::span<const std::int32_t> long_edge)
+{
+  auto map_e = topology.index_map(1);
+  auto map_f = topology.index_map(2);
+  auto f_to_e = topology.connectivity(2, 1);
+  const std::int32_t num_faces = map_f->size_local() + map_f->num_ghosts();
+
+  int indegree(-1), outdegree(-2), weighted(-1);
+  MPI_Dist_graph_neighbors_count(comm, &indegree, &outdegree, &weighted);
+  std::vector<std::vector<std::int32_t>> marked_for_update(indegree);
+
+  std::int32_t num_rounds = 0;
+  std::int32_t update_count = 1;
+  while (update_count > 0)
+  {
+    update_count = 0;
+    refinement::update_logical_edgefunction(comm, marked_for_update,
+                                            marked_edges, *map_e);
+    for (auto& edges : marked_for_update)
+      edges.clear();
+
+    for (std::int32_t f = 0; f < num_faces; ++f)
+    {
+      const std::int32_t long_e = long_edge[f];
+      auto edges = f_to_e->links(f);
+      if (!marked_edges[long_e]
+          and std::any_of(edges.begin(), edges.end(),
+                          [&marked_edges](auto e) { return marked_edges[e]; }))
+      {
+        marked_edges[long_e] = true;
+        for (int rank : shared_edges.links(long_e))
+          marked_for_update[rank].push_back(long_e);
+        ++update_count;
+      }
+    }
+
+    MPI_Allreduce(MPI_IN_PLACE, &update_count, 1, MPI_INT32_T, MPI_SUM, comm);
+    ++num_rounds;
+  }
+
+  return num_rounds;
+}
+
+/// Mark `edges` and propagate the markers with
+/// plaza::impl::enforce_rules and with enforce_rules_sweep, set up as
+/// in plaza::compute_refinement_data. Returns the markers and the
+/// number of rounds of communication of each.
+std::pair<std::array<std::vector<std::int8_t>, 2>,
+          std::array<std::int32_t, 2>>
+propagate_markers(const mesh::Mesh<double>& mesh,
+                  std::span<const std::int32_t> edges,
+                  std::span<const std::int32_t> long_edge)
+{
+  auto topology = mesh.topology();
+  auto map_e = topology->index_map(1);
+
+  // Sharing ranks of each edge, as neighbourhood ranks
+  graph::AdjacencyList<int> edge_ranks = map_e->index_to_dest_ranks();
+  std::vector<int> ranks(edge_ranks.array().begin(), edge_ranks.array().end());
+  std::ranges::sort(ranks);
+  ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+  for (int& r : edge_ranks.array())
+    r = std::distance(ranks.begin(), std::ranges::lower_bound(ranks, r));
+  MPI_Comm comm;
+  MPI_Dist_graph_create_adjacent(mesh.comm(), ranks.size(), ranks.data(),
+                                 MPI_UNWEIGHTED, ranks.size(), ranks.data(),
+                                 MPI_UNWEIGHTED, MPI_INFO_NULL, false, &comm);
+
+  std::vector<std::int8_t> marked(map_e->size_local() + map_e->num_ghosts(),
+                                  false);
+  std::vector<std::vector<std::int32_t>> marked_for_update(ranks.size());
+  for (std::int32_t e : edges)
+  {
+    marked[e] = true;
+    for (int rank : edge_ranks.links(e))
+      marked_for_update[rank].push_back(e);
+  }
+  refinement::update_logical_edgefunction(comm, marked_for_update, marked,
+                                          *map_e);
+
+  std::array<std::vector<std::int8_t>, 2> markers = {marked, marked};
+  std::array<std::int32_t, 2> num_rounds
+      = {refinement::plaza::impl::enforce_rules(comm, edge_ranks, markers[0],
+                                                *topology, long_edge),
+         enforce_rules_sweep(comm, edge_ranks, markers[1], *topology,
+                             long_edge)};
+  MPI_Comm_free(&comm);
+
+  return {std::move(markers), num_rounds};
+}
+
+/// Check that every rank that shares an edge has the same marker for
+/// it, and that the longest edge of every face with a marked edge is
+/// marked, i.e. that refinement creates no hanging vertices
+void check_conforming(const mesh::Topology& topology,
+                      std::span<const std::int8_t> marked,
+                      std::span<const std::int32_t> long_edge)
+{
+  auto map_e = topology.index_map(1);
+  const std::int32_t num_owned = map_e->size_local();
+
+  // Ghosts have the marker of the owner
+  la::Vector<std::int8_t> v(map_e, 1);
+  std::ranges::copy(marked, v.mutable_array().begin());
+  v.scatter_fwd();
+  CHECK(std::ranges::equal(v.array(), marked));
+
+  // No ghost is marked if the owned edge is not
+  std::ranges::copy(marked, v.mutable_array().begin());
+  v.scatter_rev([](auto a, auto b) { return std::max(a, b); });
+  CHECK(std::ranges::equal(v.array().first(num_owned),
+                           marked.first(num_owned)));
+
+  auto f_to_e = topology.connectivity(2, 1);
+  for (std::int32_t f = 0; f < f_to_e->num_nodes(); ++f)
+  {
+    auto edges = f_to_e->links(f);
+    if (std::any_of(edges.begin(), edges.end(),
+                    [&marked](auto e) { return marked[e]; }))
+    {
+      CHECK(marked[long_edge[f]]);
+    }
+  }
+}
+
+void test_refine_parallel(mesh::CellType cell_type)
+{
+  auto mesh = create_mesh(MPI_COMM_WORLD, cell_type);
+  mesh.topology()->create_entities(1);
+  const std::vector<std::int32_t> edges = locate_band(mesh);
+  const auto [long_edge, edge_ratio_ok]
+      = refinement::plaza::impl::face_long_edge(mesh);
+
+  // Both algorithms propagate to the same conforming set of markers,
+  // and propagation to a local fixed point does not need more rounds
+  // of communication
+  auto [markers, num_rounds] = propagate_markers(mesh, edges, long_edge);
+  CHECK(markers[0] == markers[1]);
+  CHECK(num_rounds[0] <= num_rounds[1]);
+  check_conforming(*mesh.topology(), markers[0], long_edge);
+
+  // The refined mesh has the same number of cells as the mesh refined
+  // on one rank
+  auto cells = std::get<0>(refinement::plaza::compute_refinement_data(
+      mesh, edges, refinement::plaza::Option::none));
+  std::int64_t num_cells = cells.num_nodes();
+  MPI_Allreduce(MPI_IN_PLACE, &num_cells, 1, MPI_INT64_T, MPI_SUM,
+                mesh.comm());
+
+  auto mesh_serial = create_mesh(MPI_COMM_SELF, cell_type);
+  mesh_serial.topology()->create_entities(1);
+  auto cells_serial = std::get<0>(refinement::plaza::compute_refinement_data(
+      mesh_serial, locate_band(mesh_serial), refinement::plaza::Option::none));
+  CHECK(num_cells == cells_serial.num_nodes());
+  CHECK(num_cells > mesh.topology()->index_map(mesh.topology()->dim())
+                        ->size_global());
+}
+
+/// With the longest edge of each face chosen as the edge shared with
+/// the highest numbered lower face, markers propagate from face to
+/// face in decreasing order. A sweep in increasing order then
+/// propagates a marker by one face per round, while propagation to a
+/// local fixed point only needs a round for each time a marker
+/// crosses to another rank.
+void test_propagation_rounds(mesh::CellType cell_type)
+{
+  auto mesh = create_mesh(MPI_COMM_WORLD, cell_type);
+  auto topology = mesh.topology();
+  topology->create_entities(1);
+  topology->create_entities(2);
+  topology->create_connectivity(2, 1);
+  topology->create_connectivity(1, 2);
+  auto f_to_e = topology->connectivity(2, 1);
+  auto e_to_f = topology->connectivity(1, 2);
+
+  std::vector<std::int32_t> long_edge(f_to_e->num_nodes());
+  for (std::int32_t f = 0; f < f_to_e->num_nodes(); ++f)
+  {
+    auto edges = f_to_e->links(f);
+    long_edge[f] = edges.front();
+    std::int32_t g_max = -1;
+    for (std::int32_t e : edges)
+    {
+      for (std::int32_t g : e_to_f->links(e))
+      {
+        if (g < f and g > g_max)
+        {
+          g_max = g;
+          long_edge[f] = e;
+        }
+      }
+    }
+  }
+
+  const std::vector<std::int32_t> edges = locate_band(mesh);
+  auto [markers, num_rounds] = propagate_markers(mesh, edges, long_edge);
+  CHECK(markers[0] == markers[1]);
+  CHECK(num_rounds[0] < num_rounds[1]);
+  check_conforming(*topology, markers[0], long_edge);
+}
+
+void test_refine_threads(mesh::CellType cell_type)
+{
+  auto mesh
+      = cell_type == mesh::CellType::triangle
+            ? mesh::create_rectangle(MPI_COMM_WORLD, {{{0.0, 0.0}, {1.0, 1.0}}},
+                                     {8, 8}, cell_type)
+            : mesh::create_box(MPI_COMM_WORLD,
+                               {{{0.0, 0.0, 0.0}, {1.0, 1.0, 1.0}}},
+                               {4, 4, 4}, cell_type);
+  mesh.topology()->create_entities(1);
+
+  // Mark edges close to a corner. Propagation of markers to longest
+  // edges reaches beyond the marked region.
+  std::vector<std::int32_t> edges = mesh::locate_entities(
+      mesh, 1,
+      [](auto x)
+      {
+        std::vector<std::int8_t> marker(x.extent(1));
+        for (std::size_t p = 0; p < x.extent(1); ++p)
+          marker[p] = x(0, p) + x(1, p) < 0.3;
+        return marker;
+      });
+
+  auto [cells0, x0, xshape0, parent_cell0, parent_facet0]
+      = refinement::plaza::compute_refinement_data(
+          mesh, edges, refinement::plaza::Option::parent_cell_and_facet, 1);
+  auto [cells1, x1, xshape1, parent_cell1, parent_facet1]
+      = refinement::plaza::compute_refinement_data(
+          mesh, edges, refinement::plaza::Option::parent_cell_and_facet, 3);
+  CHECK(cells0.array() == cells1.array());
+  CHECK(x0 == x1);
+  CHECK(parent_cell0 == parent_cell1);
+  CHECK(parent_facet0 == parent_facet1);
+
+  // Marked cells are split, so the refined mesh has more cells
+  std::int64_t num_cells = parent_cell0.size();
+  MPI_Allreduce(MPI_IN_PLACE, &num_cells, 1, MPI_INT64_T, MPI_SUM,
+                mesh.comm());
+  const int tdim = mesh.topology()->dim();
+  CHECK(num_cells > mesh.topology()->index_map(tdim)->size_global());
+}
+} // namespace
+
+TEST_CASE("Plaza refinement in parallel", "[refinement]")
+{
+  CHECK_NOTHROW(test_refine_parallel(mesh::CellType::triangle));
+  CHECK_NOTHROW(test_refine_parallel(mesh::CellType::tetrahedron));
+  CHECK_NOTHROW(test_propagation_rounds(mesh::CellType::triangle));
+  CHECK_NOTHROW(test_propagation_rounds(mesh::CellType::tetrahedron));
+}
+
+TEST_CASE("Plaza refinement with threads", "[refinement]")
+{
+  CHECK_NOTHROW(test_refine_threads(mesh::CellType::triangle));
+  CHECK_NOTHROW(test_refine_threads(mesh::CellType::tetrahedron));
+}
@@ -0,0 +1,129 @@
+// Copyright (C) 2026 agent
+//
+// This file is part of DOLFINx (https://www.fenicsproject.org)
+//
+// SPDX-License-Identifier:    LGPL-3.0-or-later
+//
+// Unit tests for the geometric multigrid solver
+
+#include "poisson.h"
+#include <basix/finite-element.h>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <dolfinx/fem/Constant.h>
+#include <dolfinx/fem/DirichletBC.h>
+#include <dolfinx/fem/Form.h>
+#include <dolfinx/fem/FunctionSpace.h>
+#include <dolfinx/fem/assembler.h>
+#include <dolfinx/fem/utils.h>
+#include <dolfinx/la/MatrixCSR.h>
+#include <dolfinx/la/SparsityPattern.h>
+#include <dolfinx/la/Vector.h>
+#include <dolfinx/mesh/generation.h>
+#include <dolfinx/mesh/utils.h>
+#include <dolfinx/multigrid/GeometricMultigrid.h>
+#include <dolfinx/multigrid/MeshHierarchy.h>
+#include <dolfinx/multigrid/transfer.h>
+#include <memory>
+#include <vector>
+
+using namespace dolfinx;
+
+namespace
+{
+/// Assemble the Poisson operator with homogeneous Dirichlet conditions
+/// on the boundary. Returns the operator and the constrained dofs.
+std::pair<std::shared_ptr<la::MatrixCSR<double>>, std::vector<std::int32_t>>
+create_operator(std::shared_ptr<const fem::FunctionSpace<double>> V)
+{
+  auto mesh = V->mesh();
+  const int tdim = mesh->topology()->dim();
+  mesh->topology_mutable()->create_connectivity(tdim - 1, tdim);
+  const std::vector<std::int32_t> facets
+      = mesh::exterior_facet_indices(*mesh->topology());
+  const std::vector<std::int32_t> dofs = fem::locate_dofs_topological(
+      *mesh->topology(), *V->dofmap(), tdim - 1, facets);
+  auto bc = std::make_shared<const fem::DirichletBC<double>>(0.0, dofs, V);
+
+  auto kappa = std::make_shared<fem::Constant<double>>(1.0);
+  auto a = std::make_shared<fem::Form<double, double>>(
+      fem::create_form<double, double>(*form_poisson_a, {V, V}, {},
+                                       {{"kappa", kappa}}, {}));
+
+  la::SparsityPattern sp = fem::create_sparsity_pattern(*a);
+  sp.finalize();
+  auto A = std::make_shared<la::MatrixCSR<double>>(sp);
+  fem::assemble_matrix(A->mat_add_values(), *a, {bc});
+  A->scatter_rev();
+  fem::set_diagonal<double>(A->mat_set_values(), *V, {bc});
+  return {A, dofs};
+}
+
+void test_multigrid(multigrid::SmootherType smoother, std::int64_t coarse_size)
+{
+  auto mesh = std::make_shared<mesh::Mesh<double>>(mesh::create_box(
+      MPI_COMM_WORLD, {{{0.0, 0.0, 0.0}, {1.0, 1.0, 1.0}}}, {2, 2, 2},
+      mesh::CellType::tetrahedron,
+      mesh::create_cell_partitioner(mesh::GhostMode::none)));
+  multigrid::MeshHierarchy<double> hierarchy(mesh, 2);
+
+  basix::FiniteElement e = basix::create_element<double>(
+      basix::element::family::P, basix::cell::type::tetrahedron, 2,
+      basix::element::lagrange_variant::unset,
+      basix::element::dpc_variant::unset, false);
+  std::vector<std::shared_ptr<const fem::FunctionSpace<double>>> V;
+  std::vector<std::shared_ptr<la::MatrixCSR<double>>> A;
+  std::vector<std::int32_t> bc_dofs;
+  for (int i = 0; i < hierarchy.num_levels(); ++i)
+  {
+    V.push_back(std::make_shared<fem::FunctionSpace<double>>(
+        fem::create_functionspace(hierarchy.mesh(i), e)));
+    auto [Ai, dofs] = create_operator(V.back());
+    A.push_back(Ai);
+    bc_dofs = dofs;
+  }
+
+  multigrid::MultigridOptions options;
+  options.smoother = smoother;
+  options.coarse_max_size = coarse_size;
+  if (smoother == multigrid::SmootherType::jacobi)
+  {
+    options.pre_smooth = 3;
+    options.post_smooth = 3;
+  }
+  multigrid::GeometricMultigrid<double> mg(
+      A, multigrid::create_transfer_operators<double, double>(hierarchy, V),
+      options);
+  CHECK(mg.num_levels() == 3);
+
+  // Create right-hand side b = A x0 from a known solution x0 that
+  // satisfies the boundary condition
+  auto map = A.back()->index_map(1);
+  la::Vector<double> x0(map, 1), b(map, 1), x(map, 1);
+  const std::int64_t offset = map->local_range()[0];
+  std::span<double> _x0 = x0.mutable_array();
+  for (std::int32_t i = 0; i < map->size_local(); ++i)
+    _x0[i] = std::sin(double(offset + i));
+  for (std::int32_t dof : bc_dofs)
+    if (dof < map->size_local())
+      _x0[dof] = 0;
+  b.set(0.0);
+  A.back()->mult(x0, b);
+
+  x.set(0.0);
+  auto [num_it, rnorm] = mg.solve(b, x, 1e-8, 50);
+  CHECK(num_it < 50);
+  CHECK(rnorm < 1e-8);
+
+  std::span<const double> _x = x.array();
+  for (std::int32_t i = 0; i < map->size_local(); ++i)
+    CHECK(std::abs(_x[i] - _x0[i]) < 1e-4);
+}
+} // namespace
+
+TEST_CASE("Geometric multigrid", "[multigrid]")
+{
+  CHECK_NOTHROW(test_multigrid(multigrid::SmootherType::chebyshev, 5000));
+  CHECK_NOTHROW(test_multigrid(multigrid::SmootherType::jacobi, 5000));
+  CHECK_NOTHROW(test_multigrid(multigrid::SmootherType::chebyshev, 0));
+}
@@ -0,0 +1,117 @@
+// Copyright (C) 2026 agent
+//
+// This file is part of DOLFINx (https://www.fenicsproject.org)
+//
+// SPDX-License-Identifier:    LGPL-3.0-or-later
+//
+// Unit tests for multigrid transfer operators
+
+#include <basix/finite-element.h>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <dolfinx/fem/Function.h>
+#include <dolfinx/fem/FunctionSpace.h>
+#include <dolfinx/fem/utils.h>
+#include <dolfinx/la/Vector.h>
+#include <dolfinx/mesh/generation.h>
+#include <dolfinx/mesh/utils.h>
+#include <dolfinx/multigrid/MeshHierarchy.h>
+#include <dolfinx/multigrid/transfer.h>
+#include <memory>
+#include <vector>
+
+using namespace dolfinx;
+
+namespace
+{
+template <typename T>
+void test_transfer(int degree, std::vector<std::size_t> value_shape)
+{
+  auto mesh = std::make_shared<mesh::Mesh<T>>(mesh::create_rectangle<T>(
+      MPI_COMM_WORLD, {{{0.0, 0.0}, {1.0, 1.0}}}, {4, 3},
+      mesh::CellType::triangle,
+      mesh::create_cell_partitioner(mesh::GhostMode::none)));
+  multigrid::MeshHierarchy<T> hierarchy(mesh, 2);
+  REQUIRE(hierarchy.num_levels() == 3);
+
+  basix::FiniteElement e = basix::create_element<T>(
+      basix::element::family::P, basix::cell::type::triangle, degree,
+      basix::element::lagrange_variant::unset,
+      basix::element::dpc_variant::unset, false);
+  std::vector<std::shared_ptr<const fem::FunctionSpace<T>>> V;
+  for (int i = 0; i < hierarchy.num_levels(); ++i)
+  {
+    V.push_back(std::make_shared<fem::FunctionSpace<T>>(
+        fem::create_functionspace(hierarchy.mesh(i), e, value_shape)));
+  }
+
+  // A polynomial of the element degree is reproduced exactly on the
+  // finer levels
+  const std::size_t bs = V[0]->dofmap()->bs();
+  auto f = [bs, degree](auto x)
+      -> std::pair<std::vector<T>, std::vector<std::size_t>>
+  {
+    std::vector<T> f(bs * x.extent(1));
+    for (std::size_t p = 0; p < x.extent(1); ++p)
+    {
+      for (std::size_t k = 0; k < bs; ++k)
+      {
+        T v = 1 + (k + 1) * x(0, p) - 2 * x(1, p);
+        if (degree > 1)
+          v += x(0, p) * x(1, p);
+        f[k * x.extent(1) + p] = v;
+      }
+    }
+    return {f, bs == 1 ? std::vector<std::size_t>{x.extent(1)}
+                       : std::vector<std::size_t>{bs, x.extent(1)}};
+  };
+
+  std::vector<multigrid::TransferOperator<T, T>> transfer
+      = multigrid::create_transfer_operators<T, T>(hierarchy, V);
+  REQUIRE(transfer.size() == 2);
+
+  std::vector<fem::Function<T>> u;
+  u.reserve(V.size());
+  u.emplace_back(V[0]);
+  u[0].interpolate(f);
+  for (std::size_t i = 0; i < transfer.size(); ++i)
+  {
+    u.emplace_back(V[i + 1]);
+    transfer[i].interpolate(u[i + 1], u[i]);
+
+    fem::Function<T> v(V[i + 1]);
+    v.interpolate(f);
+    std::span<const T> x1 = u[i + 1].x()->array();
+    std::span<const T> y1 = v.x()->array();
+    for (std::size_t j = 0; j < x1.size(); ++j)
+      CHECK(x1[j] == Catch::Approx(y1[j]).margin(1e-5));
+  }
+
+  // The restriction is the transpose of the prolongation, i.e. (R y,
+  // x) = (y, P x)
+  la::Vector<T> x(V[1]->dofmap()->index_map, bs);
+  la::Vector<T> y(V[2]->dofmap()->index_map, bs);
+  std::span<T> _x = x.mutable_array();
+  for (std::size_t i = 0; i < _x.size(); ++i)
+    _x[i] = std::sin(T(i));
+  std::span<T> _y = y.mutable_array();
+  for (std::size_t i = 0; i < _y.size(); ++i)
+    _y[i] = std::cos(T(i));
+
+  la::Vector<T> Px(V[2]->dofmap()->index_map, bs);
+  la::Vector<T> Ry(V[1]->dofmap()->index_map, bs);
+  transfer[1].prolong(x, Px);
+  transfer[1].restrict_to(y, Ry);
+  CHECK(la::inner_product(Ry, x)
+        == Catch::Approx(la::inner_product(y, Px)).epsilon(1e-4));
+}
+} // namespace
+
+TEMPLATE_TEST_CASE("Multigrid transfer", "[multigrid]", double, float)
+{
+  CHECK_NOTHROW(test_transfer<TestType>(1, {}));
+  CHECK_NOTHROW(test_transfer<TestType>(2, {}));
+  CHECK_NOTHROW(test_transfer<TestType>(1, {2}));
+}
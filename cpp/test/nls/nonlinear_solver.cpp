@@ -0,0 +1,124 @@
+// Copyright (C) 2026 agent
+//
+// This file is part of DOLFINx (https://www.fenicsproject.org)
+//
+// SPDX-License-Identifier:    LGPL-3.0-or-later
+//
+// Unit tests for the PETSc-free nonlinear solver
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <dolfinx/common/IndexMap.h>
+#include <dolfinx/la/Vector.h>
+#include <dolfinx/nls/NonlinearSolver.h>
+#include <memory>
+#include <vector>
+
+using namespace dolfinx;
+
+namespace
+{
+/// Solve F(x) = 3 x + x^3 / 10 + s(x) / N - c = 0, where s(x) is the
+/// sum of the entries of x and N is the global size. The Jacobian
+/// J = D + 1 1^T / N, with D diagonal, is solved matrix-free using the
+/// Sherman-Morrison formula.
+template <typename T>
+void test_solver(nls::NonlinearMethod method, bool use_jacobian, double beta,
+                 int memory = 5, T x0 = 0)
+{
+  auto map = std::make_shared<common::IndexMap>(MPI_COMM_WORLD, 20);
+  const T N = map->size_global();
+  const std::int64_t offset = map->local_range()[0];
+  const std::int32_t n = map->size_local();
+
+  std::vector<T> c(n);
+  for (std::int32_t i = 0; i < n; ++i)
+    c[i] = 1 + std::sin(T(offset + i));
+
+  auto sum = [](const la::Vector<T>& x)
+  {
+    la::Vector<T> one(x.index_map(), 1);
+    one.set(1);
+    return la::inner_product(one, x);
+  };
+
+  nls::NonlinearSolver<la::Vector<T>> solver(method);
+  solver.setF(
+      [&](const la::Vector<T>& x, la::Vector<T>& b)
+      {
+        const T s = sum(x);
+        std::span<const T> _x = x.array();
+        std::span<T> _b = b.mutable_array();
+        for (std::int32_t i = 0; i < n; ++i)
+          _b[i] = 3 * _x[i] + _x[i] * _x[i] * _x[i] / 10 + s / N - c[i];
+      });
+
+  std::vector<T> d(n);
+  la::Vector<T> dinv_one(map, 1);
+  if (use_jacobian)
+  {
+    solver.setJ(
+        [&](const la::Vector<T>& x)
+        {
+          std::span<const T> _x = x.array();
+          for (std::int32_t i = 0; i < n; ++i)
+            d[i] = 3 + 3 * _x[i] * _x[i] / 10;
+        });
+    solver.set_linear_solver(
+        [&](const la::Vector<T>& b, la::Vector<T>& dx)
+        {
+          std::span<const T> _b = b.array();
+          std::span<T> _dx = dx.mutable_array();
+          std::span<T> _w = dinv_one.mutable_array();
+          for (std::int32_t i = 0; i < n; ++i)
+          {
+            _dx[i] = _b[i] / d[i];
+            _w[i] = 1 / d[i];
+          }
+          const T a = sum(dx) / (N + sum(dinv_one));
+          for (std::int32_t i = 0; i < n; ++i)
+            _dx[i] -= a * _w[i];
+          return 1;
+        });
+  }
+
+  solver.relaxation_parameter = beta;
+  solver.memory = memory;
+  solver.rtol = std::is_same_v<T, float> ? 1e-5 : 1e-10;
+  solver.atol = 0;
+  solver.max_it = 100;
+  solver.report = false;
+
+  la::Vector<T> x(map, 1);
+  x.set(x0);
+  auto [num_it, converged] = solver.solve(x);
+  CHECK(converged);
+  if (method == nls::NonlinearMethod::newton)
+    CHECK(num_it < 10);
+  CHECK(solver.residual() <= solver.rtol * solver.residual0());
+  if (use_jacobian)
+    CHECK(solver.jacobian_updates() > 0);
+
+  // Broyden restarts with a new Jacobian at least every memory + 1
+  // steps
+  if (method == nls::NonlinearMethod::broyden and use_jacobian)
+    CHECK(solver.jacobian_updates() >= (num_it + memory) / (memory + 1));
+}
+} // namespace
+
+TEMPLATE_TEST_CASE("Nonlinear solver", "[nls]", double, float)
+{
+  using nls::NonlinearMethod;
+  CHECK_NOTHROW(test_solver<TestType>(NonlinearMethod::newton, true, 1.0));
+  CHECK_NOTHROW(test_solver<TestType>(NonlinearMethod::broyden, true, 1.0));
+
+  // Short memory and a distant initial guess force several restarts
+  CHECK_NOTHROW(
+      test_solver<TestType>(NonlinearMethod::broyden, true, 1.0, 1, 10));
+  CHECK_NOTHROW(
+      test_solver<TestType>(NonlinearMethod::broyden, true, 1.0, 2, 10));
+
+  CHECK_NOTHROW(test_solver<TestType>(NonlinearMethod::anderson, true, 1.0));
+  CHECK_NOTHROW(test_solver<TestType>(NonlinearMethod::anderson, false, 0.2));
+}
@@ -6,12 +6,20 @@
 //
 // Unit tests for Distributed la::Vector
 
+#include <algorithm>
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <complex>
 #include <dolfinx/common/IndexMap.h>
 #include <dolfinx/common/MPI.h>
+#include <dolfinx/common/Timer.h>
+#include <dolfinx/common/timing.h>
 #include <dolfinx/la/Vector.h>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
 
 using namespace dolfinx;
 
@@ -54,10 +62,124 @@ void test_vector()
   CHECK(la::norm(v, la::Norm::linf) == static_cast<T>(mpi_size - 1));
 }
 
+template <typename T>
+void test_vector_scatter_shm()
+{
+  using scatter_type = typename la::Vector<T>::scatter_type;
+
+  const int mpi_size = dolfinx::MPI::size(MPI_COMM_WORLD);
+  const int mpi_rank = dolfinx::MPI::rank(MPI_COMM_WORLD);
+  const int next = (mpi_rank + 1) % mpi_size;
+  constexpr int size_local = 20;
+
+  // Ghost some entries owned by the next process
+  const int num_ghosts = mpi_size > 1 ? 5 : 0;
+  std::vector<std::int64_t> ghosts(num_ghosts);
+  for (int i = 0; i < num_ghosts; ++i)
+    ghosts[i] = next * size_local + 2 * i;
+  const std::vector<int> owners(ghosts.size(), next);
+  auto index_map = std::make_shared<common::IndexMap>(
+      MPI_COMM_WORLD, size_local, ghosts, owners);
+
+  // w is a copy of v, and shares the scatterer of v
+  la::Vector<T> v(index_map, 2);
+  std::fill(v.mutable_array().begin(), v.mutable_array().end(), mpi_rank);
+  la::Vector<T> w(v);
+  std::fill(w.mutable_array().begin(), w.mutable_array().end(), -1);
+
+  // A ghost update of w while a shared memory ghost update of v is in
+  // progress must not complete the update of v
+  v.scatter_fwd_begin(scatter_type::shm);
+  w.scatter_fwd();
+
+  // The shared memory window is shared by w, so a second shared memory
+  // ghost update cannot be started until the update of v is complete
+  if (mpi_size > 1)
+    CHECK_THROWS(w.scatter_fwd_begin(scatter_type::shm));
+  v.scatter_fwd_end();
+  std::span<const T> x = v.array();
+  CHECK(std::all_of(std::next(x.begin(), 2 * size_local), x.end(),
+                    [next](auto a) { return a == static_cast<T>(next); }));
+  std::span<const T> y = w.array();
+  CHECK(std::all_of(y.begin(), y.end(),
+                    [](auto a) { return a == static_cast<T>(-1); }));
+
+  // Accumulate ghost values on the owner through shared memory, and
+  // check that the vector can switch back to neighbourhood collectives
+  std::fill(v.mutable_array().begin(), v.mutable_array().end(), 1);
+  v.scatter_rev(std::plus<T>(), scatter_type::shm);
+  v.scatter_rev(std::plus<T>());
+  T sum = std::reduce(x.begin(), std::next(x.begin(), 2 * size_local));
+  CHECK(sum == static_cast<T>(2 * size_local + 4 * num_ghosts));
+
+  // Repeated shared memory ghost updates reuse the window once the
+  // ghosting ranks have read the previous data
+  for (int k = 0; k < 4; ++k)
+  {
+    std::fill(v.mutable_array().begin(), v.mutable_array().end(),
+              mpi_rank + k);
+    v.scatter_fwd(scatter_type::shm);
+    CHECK(std::all_of(std::next(x.begin(), 2 * size_local), x.end(),
+                      [next, k](auto a)
+                      { return a == static_cast<T>(next + k); }));
+  }
+}
+
 } // namespace
 
 TEMPLATE_TEST_CASE("Linear Algebra Vector", "[la_vector]", double,
                    std::complex<double>)
 {
   CHECK_NOTHROW(test_vector<TestType>());
+  CHECK_NOTHROW(test_vector_scatter_shm<TestType>());
+}
+
+TEST_CASE("Benchmark Vector ghost updates", "[!benchmark]")
+{
+  // Scatters are collective, so use a fixed number of repetitions and
+  // report the timings (max over ranks). Run with ranks on one and on
+  // several compute nodes to compare the communication patterns.
+  using scatter_type = la::Vector<double>::scatter_type;
+  const int mpi_size = dolfinx::MPI::size(MPI_COMM_WORLD);
+  const int mpi_rank = dolfinx::MPI::rank(MPI_COMM_WORLD);
+  const int size_local = 1000000;
+  const int num_ghosts = mpi_size > 1 ? 20000 : 0;
+  const int num_repeats = 50;
+
+  // Ghost entries owned by the previous and the next rank
+  std::vector<std::int64_t> ghosts;
+  std::vector<int> owners;
+  for (int r :
+       {(mpi_rank + mpi_size - 1) % mpi_size, (mpi_rank + 1) % mpi_size})
+  {
+    for (int i = 0; i < num_ghosts / 2; ++i)
+    {
+      ghosts.push_back(std::int64_t(r) * size_local + 7 * i);
+      owners.push_back(r);
+    }
+  }
+  auto map = std::make_shared<common::IndexMap>(MPI_COMM_WORLD, size_local,
+                                                ghosts, owners);
+  la::Vector<double> x(map, 1);
+  x.set(1.0);
+
+  for (auto [type, name] : {std::pair{scatter_type::neighbor, "neighbor"},
+                            std::pair{scatter_type::p2p, "p2p"},
+                            std::pair{scatter_type::shm, "shm"}})
+  {
+    x.scatter_fwd(type);
+    x.scatter_rev(std::plus<double>(), type);
+    for (int i = 0; i < num_repeats; ++i)
+    {
+      common::Timer t(std::string("Vector: scatter_fwd (") + name + ")");
+      x.scatter_fwd(type);
+    }
+    for (int i = 0; i < num_repeats; ++i)
+    {
+      common::Timer t(std::string("Vector: scatter_rev (") + name + ")");
+      x.scatter_rev(std::plus<double>(), type);
+    }
+  }
+
+  list_timings(MPI_COMM_WORLD, {TimingType::wall});
 }
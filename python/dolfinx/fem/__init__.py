@@ -26,6 +26,7 @@ from dolfinx.fem.bcs import (
     DirichletBC,
     bcs_by_block,
     dirichletbc,
+    locate_boundary_dofs_geometrical,
     locate_dofs_geometrical,
     locate_dofs_topological,
 )
@@ -45,6 +46,7 @@ from dolfinx.fem.function import (
     Expression,
     Function,
     FunctionSpace,
+    InterpolationPlan,
     functionspace,
 )
 from dolfinx.geometry import PointOwnershipData as _PointOwnershipData
@@ -147,11 +149,13 @@ __all__ = [
     "form",
     "IntegralType",
     "create_vector",
+    "locate_boundary_dofs_geometrical",
     "locate_dofs_geometrical",
     "locate_dofs_topological",
     "extract_function_spaces",
     "transpose_dofmap",
     "create_interpolation_data",
+    "InterpolationPlan",
     "CoordinateElement",
     "coordinate_element",
     "form_cpp_class",
@@ -25,6 +25,7 @@ from dolfinx import cpp as _cpp
 def locate_dofs_geometrical(
     V: typing.Union[dolfinx.fem.FunctionSpace, typing.Iterable[dolfinx.fem.FunctionSpace]],
     marker: typing.Callable,
+    cells: typing.Optional[numpy.typing.NDArray[np.int32]] = None,
 ) -> np.ndarray:
     """Locate degrees-of-freedom geometrically using a marker function.
 
@@ -35,6 +36,10 @@ def locate_dofs_geometrical(
             shape ``(gdim, num_points)`` and returns an array of
             booleans of length ``num_points``, evaluating to ``True``
             for entities whose degree-of-freedom should be returned.
+        cells: Indices of cells (local to the process). If provided,
+            the marker is evaluated only at the degrees-of-freedom in
+            the closure of these cells. Not supported if ``V`` is a
+            list of function spaces.
 
     Returns:
         An array of degree-of-freedom indices (local to the process) for
@@ -47,6 +52,9 @@ def locate_dofs_geometrical(
         Returned degree-of-freedom indices are unique and ordered by the
         first column.
     """
+    if cells is not None:
+        _cells = np.asarray(cells, dtype=np.int32)
+        return _cpp.fem.locate_dofs_geometrical(V._cpp_object, marker, _cells)  # type: ignore
     try:
         return _cpp.fem.locate_dofs_geometrical(V._cpp_object, marker)  # type: ignore
     except AttributeError:
@@ -54,6 +62,41 @@ def locate_dofs_geometrical(
         return _cpp.fem.locate_dofs_geometrical(_V, marker)
 
 
+def locate_boundary_dofs_geometrical(
+    V: dolfinx.fem.FunctionSpace, marker: typing.Callable
+) -> np.ndarray:
+    """Locate boundary degrees-of-freedom geometrically using a marker
+    function.
+
+    The marker is evaluated only at the degrees-of-freedom of cells
+    attached to an exterior facet. The facet-to-cell connectivity of
+    the mesh is computed if it has not already been computed.
+
+    Note:
+        The result is the same as :func:`locate_dofs_geometrical` if the
+        marker marks points on the boundary only.
+
+    Note:
+        This function is collective.
+
+    Args:
+        V: Function space in which to search for degree-of-freedom
+            indices.
+        marker: A function that takes an array of points ``x`` with
+            shape ``(gdim, num_points)`` and returns an array of
+            booleans of length ``num_points``, evaluating to ``True``
+            for entities whose degree-of-freedom should be returned.
+
+    Returns:
+        An array of sorted degree-of-freedom indices (local to the
+        process) for boundary degrees-of-freedom whose coordinate
+        evaluates to True for the marker function.
+    """
+    tdim = V.mesh.topology.dim
+    V.mesh.topology.create_connectivity(tdim - 1, tdim)
+    return _cpp.fem.locate_boundary_dofs_geometrical(V._cpp_object, marker)
+
+
 def locate_dofs_topological(
     V: typing.Union[dolfinx.fem.FunctionSpace, typing.Iterable[dolfinx.fem.FunctionSpace]],
     entity_dim: int,
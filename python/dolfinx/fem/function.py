@@ -278,6 +278,49 @@ class Expression:
         return np.dtype(self._cpp_object.dtype)
 
 
+class InterpolationPlan:
+    """Precomputed data for repeated interpolation of functions between
+    non-matching meshes."""
+
+    _cpp_object: typing.Union[
+        _cpp.fem.InterpolationPlan_complex64,
+        _cpp.fem.InterpolationPlan_complex128,
+        _cpp.fem.InterpolationPlan_float32,
+        _cpp.fem.InterpolationPlan_float64,
+    ]
+
+    def __init__(
+        self,
+        V_to: FunctionSpace,
+        V_from: FunctionSpace,
+        interpolation_data: PointOwnershipData,
+        dtype: npt.DTypeLike = default_scalar_type,
+    ):
+        """Create an interpolation plan.
+
+        Args:
+            V_to: Function space to interpolate into.
+            V_from: Function space to interpolate from.
+            interpolation_data: Data needed to interpolate from
+                ``V_from`` to ``V_to``. Created by
+                :func:`dolfinx.fem.create_interpolation_data`.
+            dtype: Scalar type of the functions.
+        """
+        if np.issubdtype(dtype, np.complex64):
+            plantype = _cpp.fem.InterpolationPlan_complex64
+        elif np.issubdtype(dtype, np.complex128):
+            plantype = _cpp.fem.InterpolationPlan_complex128
+        elif np.issubdtype(dtype, np.float32):
+            plantype = _cpp.fem.InterpolationPlan_float32
+        elif np.issubdtype(dtype, np.float64):
+            plantype = _cpp.fem.InterpolationPlan_float64
+        else:
+            raise NotImplementedError(f"Type {dtype} not supported.")
+        self._cpp_object = plantype(
+            V_from._cpp_object, V_to.mesh._cpp_object, interpolation_data._cpp_object
+        )
+
+
 class Function(ufl.Coefficient):
     """A finite element function that is represented by a function space
     (domain, element and dofmap) and a vector holding the
@@ -395,7 +438,10 @@ class Function(ufl.Coefficient):
         return u
 
     def interpolate_nonmatching(
-        self, u0: Function, cells: npt.NDArray[np.int32], interpolation_data: PointOwnershipData
+        self,
+        u0: Function,
+        cells: npt.NDArray[np.int32],
+        interpolation_data: typing.Union[PointOwnershipData, InterpolationPlan],
     ) -> None:
         """Interpolate a Function defined on one mesh to a function defined on a different mesh.
 
@@ -405,7 +451,8 @@ class Function(ufl.Coefficient):
                 cells are interpolated over.
             interpolation_data: Data needed to interpolate functions
                 defined on other meshes. Created by
-                :func:`dolfinx.fem.create_interpolation_data`.
+                :func:`dolfinx.fem.create_interpolation_data`, or an
+                :class:`InterpolationPlan` for repeated interpolation.
         """
         self._cpp_object.interpolate(u0._cpp_object, cells, interpolation_data._cpp_object)  # type: ignore
 
@@ -7,9 +7,9 @@
 
 from dolfinx import cpp as _cpp
 from dolfinx.io import gmshio
-from dolfinx.io.utils import VTKFile, XDMFFile, distribute_entity_data
+from dolfinx.io.utils import MeshPolicy, VTKFile, XDMFFile, distribute_entity_data
 
-__all__ = ["gmshio", "distribute_entity_data", "VTKFile", "XDMFFile"]
+__all__ = ["gmshio", "distribute_entity_data", "MeshPolicy", "VTKFile", "XDMFFile"]
 
 if _cpp.common.has_adios2:
     # FidesWriter and VTXWriter require ADIOS2
@@ -18,12 +18,20 @@ import basix
 import basix.ufl
 import ufl
 from dolfinx import cpp as _cpp
+from dolfinx.cpp.io import MeshPolicy
 from dolfinx.cpp.io import perm_gmsh as cell_perm_gmsh
 from dolfinx.cpp.io import perm_vtk as cell_perm_vtk
 from dolfinx.fem import Function
 from dolfinx.mesh import GhostMode, Mesh, MeshTags
 
-__all__ = ["VTKFile", "XDMFFile", "cell_perm_gmsh", "cell_perm_vtk", "distribute_entity_data"]
+__all__ = [
+    "MeshPolicy",
+    "VTKFile",
+    "XDMFFile",
+    "cell_perm_gmsh",
+    "cell_perm_vtk",
+    "distribute_entity_data",
+]
 
 
 def _extract_cpp_objects(functions: typing.Union[Mesh, Function, tuple[Function], list[Function]]):
@@ -194,6 +202,12 @@ class VTKFile(_cpp.io.VTKFile):
     geometry description. XDMF is the preferred format for geometry
     order <= 2.
 
+    Data arrays are written as ASCII by default. Pass one of
+    ``VTKFile.Encoding`` (``binary``, ``base64``, ``zlib`` or ``lz4``)
+    as the ``encoding`` argument to write appended binary data. The
+    compressed encodings are available only if DOLFINx was built with
+    the compression library, see ``VTKFile.has_encoding``.
+
     """
 
     def __enter__(self):
@@ -12,7 +12,7 @@ import numpy.typing as npt
 
 from dolfinx import cpp as _cpp
 from dolfinx.cpp.common import IndexMap
-from dolfinx.cpp.la import BlockMode, InsertMode, Norm
+from dolfinx.cpp.la import BlockMode, InsertMode, Norm, ScatterType
 
 __all__ = [
     "orthonormalize",
@@ -22,6 +22,7 @@ __all__ = [
     "MatrixCSR",
     "Norm",
     "InsertMode",
+    "ScatterType",
     "Vector",
     "create_petsc_vector",
 ]
@@ -268,18 +269,35 @@ class Vector:
             self._petsc_x = create_petsc_vector_wrap(self)
         return self._petsc_x
 
-    def scatter_forward(self) -> None:
-        """Update ghost entries."""
-        self._cpp_object.scatter_forward()
+    def scatter_forward(self, type: ScatterType = ScatterType.neighbor) -> None:
+        """Update ghost entries.
 
-    def scatter_reverse(self, mode: InsertMode) -> None:
+        Args:
+            type: MPI communication pattern.
+
+        Note:
+            With ``ScatterType.shm`` a shared memory window is created
+            for the ghost scatters of the vector. The window is freed
+            (``MPI_Win_free``) when the vector and all its copies have
+            been destroyed, and freeing it is collective over the ranks
+            on a compute node. Destroy such a vector at the same point
+            on all ranks, e.g. ``del x`` followed by ``gc.collect()``.
+            If it is left to the garbage collector, which can run at
+            different points on different ranks, the program can
+            deadlock.
+        """
+        self._cpp_object.scatter_forward(type)
+
+    def scatter_reverse(self, mode: InsertMode, type: ScatterType = ScatterType.neighbor) -> None:
         """Scatter ghost entries to owner.
 
         Args:
             mode: Control how scattered values are set/accumulated by
                 owner.
+            type: MPI communication pattern. See :meth:`scatter_forward`
+                for the destruction requirements of ``ScatterType.shm``.
         """
-        self._cpp_object.scatter_reverse(mode)
+        self._cpp_object.scatter_reverse(mode, type)
 
 
 def vector(map, bs=1, dtype: npt.DTypeLike = np.float64) -> Vector:
@@ -22,6 +22,7 @@ from dolfinx import default_real_type
 from dolfinx.cpp.mesh import (
     CellType,
     DiagonalType,
+    GeometricPartitionMethod,
     GhostMode,
     build_dual_graph,
     cell_dim,
@@ -46,12 +47,14 @@ __all__ = [
     "meshtags",
     "CellType",
     "GhostMode",
+    "GeometricPartitionMethod",
     "build_dual_graph",
     "cell_dim",
     "compute_midpoints",
     "exterior_facet_indices",
     "compute_incident_entities",
     "create_cell_partitioner",
+    "create_geometric_partitioner",
     "create_interval",
     "create_unit_interval",
     "create_rectangle",
@@ -362,6 +365,32 @@ def refine_plaza(
     return Mesh(mesh1, mesh._ufl_domain), cells, facets
 
 
+def create_geometric_partitioner(
+    x: npt.NDArray[np.floating],
+    method: GeometricPartitionMethod = GeometricPartitionMethod.hilbert,
+) -> typing.Callable:
+    """Create a cell partitioner that partitions the cell midpoints.
+
+    The partitioner uses recursive coordinate bisection or a Hilbert
+    space-filling curve. It does not build the mesh dual graph or use a
+    graph partitioning library, and is therefore much cheaper than the
+    default partitioner. It does not compute ghost cells.
+
+    Args:
+        x: Mesh geometry ('node' coordinates) on this rank, i.e. the
+            same data that is passed to :func:`create_mesh`.
+        method: Partitioning method.
+
+    Returns:
+        Cell partitioning function that can be passed to
+        :func:`create_mesh`.
+    """
+    x = np.asarray(x, order="C")
+    if x.dtype not in (np.float32, np.float64):
+        x = x.astype(np.float64)
+    return _cpp.mesh.create_geometric_partitioner(x, method)
+
+
 def create_mesh(
     comm: _MPI.Comm,
     cells: npt.NDArray[np.int64],
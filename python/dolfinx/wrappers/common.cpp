@@ -111,6 +111,10 @@ void common(nb::module_& m)
            &dolfinx::common::IndexMap::index_to_dest_ranks)
       .def("imbalance", &dolfinx::common::IndexMap::imbalance,
            "Imbalance of the current IndexMap.")
+      .def("node_ghost_volume",
+           &dolfinx::common::IndexMap::node_ghost_volume,
+           nb::arg("node_size") = -1,
+           "Number of ghosts owned on the same and on other compute nodes.")
       .def_prop_ro(
           "ghosts",
           [](const dolfinx::common::IndexMap& self)
@@ -142,14 +146,15 @@ void common(nb::module_& m)
       .def(
           "global_to_local",
           [](const dolfinx::common::IndexMap& self,
-             nb::ndarray<const std::int64_t, nb::ndim<1>, nb::c_contig> global)
+             nb::ndarray<const std::int64_t, nb::ndim<1>, nb::c_contig> global,
+             int num_threads)
           {
             std::vector<std::int32_t> local(global.size());
             self.global_to_local(std::span(global.data(), global.size()),
-                                 local);
+                                 local, num_threads);
             return dolfinx_wrappers::as_nbarray(std::move(local));
           },
-          nb::arg("global"));
+          nb::arg("global"), nb::arg("num_threads") = 1);
   // dolfinx::common::Timer
   nb::class_<dolfinx::common::Timer>(m, "Timer", "Timer class")
       .def(nb::init<>())
@@ -62,6 +62,27 @@ struct geom_type<T, std::void_t<typename T::value_type>>
   typedef typename T::value_type value_type;
 };
 
+/// Python marking function for dof locators. It takes points with
+/// shape (3, num_points) and returns a boolean array of length
+/// num_points.
+template <typename T>
+using marker_fn = std::function<nb::ndarray<bool, nb::ndim<1>, nb::c_contig>(
+    nb::ndarray<const T, nb::ndim<2>, nb::numpy>)>;
+
+/// Wrap a Python marking function for the C++ dof locators
+template <typename T>
+auto wrap_marker(const marker_fn<T>& marker)
+{
+  return [&marker](auto x)
+  {
+    nb::ndarray<const T, nb::ndim<2>, nb::numpy> x_view(
+        x.data_handle(), {x.extent(0), x.extent(1)}, nb::handle());
+    auto marked = marker(x_view);
+    return std::vector<std::int8_t>(marked.data(),
+                                    marked.data() + marked.size());
+  };
+}
+
 template <typename T>
 void declare_function_space(nb::module_& m, std::string type)
 {
@@ -368,6 +389,20 @@ void declare_objects(nb::module_& m, const std::string& type)
                    &dolfinx::fem::DirichletBC<T, U>::function_space)
       .def_prop_ro("value", &dolfinx::fem::DirichletBC<T, U>::value);
 
+  // dolfinx::fem::InterpolationPlan
+  std::string pyclass_name_plan = std::string("InterpolationPlan_") + type;
+  nb::class_<dolfinx::fem::InterpolationPlan<T, U>>(
+      m, pyclass_name_plan.c_str(),
+      "Precomputed data for interpolation between non-matching meshes")
+      .def(nb::init<const dolfinx::fem::FunctionSpace<U>&,
+                    const dolfinx::mesh::Mesh<U>&,
+                    const dolfinx::geometry::PointOwnershipData<U>&>(),
+           nb::arg("V"), nb::arg("mesh1"), nb::arg("interpolation_data"))
+      .def_prop_ro("num_src_points",
+                   &dolfinx::fem::InterpolationPlan<T, U>::num_src_points)
+      .def_prop_ro("num_dest_points",
+                   &dolfinx::fem::InterpolationPlan<T, U>::num_dest_points);
+
   // dolfinx::fem::Function
   std::string pyclass_name_function = std::string("Function_") + type;
   nb::class_<dolfinx::fem::Function<T, U>>(m, pyclass_name_function.c_str(),
@@ -427,6 +462,19 @@ void declare_objects(nb::module_& m, const std::string& type)
           },
           nb::arg("u"), nb::arg("cells"), nb::arg("interpolation_data"),
           "Interpolate a finite element function on non-matching meshes")
+      .def(
+          "interpolate",
+          [](dolfinx::fem::Function<T, U>& self,
+             const dolfinx::fem::Function<T, U>& u,
+             nb::ndarray<const std::int32_t, nb::ndim<1>, nb::c_contig> cells,
+             const dolfinx::fem::InterpolationPlan<T, U>& plan)
+          {
+            dolfinx::fem::interpolate(
+                self, u, std::span(cells.data(), cells.size()), plan);
+          },
+          nb::arg("u"), nb::arg("cells"), nb::arg("plan"),
+          "Interpolate a finite element function on non-matching meshes "
+          "using a precomputed plan")
       .def(
           "interpolate_ptr",
           [](dolfinx::fem::Function<T, U>& self, std::uintptr_t addr,
@@ -1039,22 +1087,12 @@ void declare_real_functions(nb::module_& m)
       "locate_dofs_geometrical",
       [](const std::vector<
              std::shared_ptr<const dolfinx::fem::FunctionSpace<T>>>& V,
-         std::function<nb::ndarray<bool, nb::ndim<1>, nb::c_contig>(
-             nb::ndarray<const T, nb::ndim<2>, nb::numpy>)>
-             marker)
+         const marker_fn<T>& marker)
       {
         if (V.size() != 2)
           throw std::runtime_error("Expected two function spaces.");
 
-        auto _marker = [&marker](auto x)
-        {
-          nb::ndarray<const T, nb::ndim<2>, nb::numpy> x_view(
-              x.data_handle(), {x.extent(0), x.extent(1)}, nb::handle());
-          auto marked = marker(x_view);
-          return std::vector<std::int8_t>(marked.data(),
-                                          marked.data() + marked.size());
-        };
-
+        auto _marker = wrap_marker<T>(marker);
         std::array<std::vector<std::int32_t>, 2> dofs
             = dolfinx::fem::locate_dofs_geometrical<T>({*V[0], *V[1]}, _marker);
         return std::array<nb::ndarray<std::int32_t, nb::numpy>, 2>(
@@ -1064,24 +1102,33 @@ void declare_real_functions(nb::module_& m)
       nb::arg("V"), nb::arg("marker"));
   m.def(
       "locate_dofs_geometrical",
-      [](const dolfinx::fem::FunctionSpace<T>& V,
-         std::function<nb::ndarray<bool, nb::ndim<1>, nb::c_contig>(
-             nb::ndarray<const T, nb::ndim<2>, nb::numpy>)>
-             marker)
+      [](const dolfinx::fem::FunctionSpace<T>& V, const marker_fn<T>& marker)
       {
-        auto _marker = [&marker](auto x)
-        {
-          nb::ndarray<const T, nb::ndim<2>, nb::numpy> x_view(
-              x.data_handle(), {x.extent(0), x.extent(1)}, nb::handle());
-          auto marked = marker(x_view);
-          return std::vector<std::int8_t>(marked.data(),
-                                          marked.data() + marked.size());
-        };
-
+        auto _marker = wrap_marker<T>(marker);
         return dolfinx_wrappers::as_nbarray(
             dolfinx::fem::locate_dofs_geometrical(V, _marker));
       },
       nb::arg("V"), nb::arg("marker"));
+  m.def(
+      "locate_dofs_geometrical",
+      [](const dolfinx::fem::FunctionSpace<T>& V, const marker_fn<T>& marker,
+         nb::ndarray<const std::int32_t, nb::ndim<1>, nb::c_contig> cells)
+      {
+        return dolfinx_wrappers::as_nbarray(
+            dolfinx::fem::locate_dofs_geometrical(
+                V, wrap_marker<T>(marker),
+                std::span(cells.data(), cells.size())));
+      },
+      nb::arg("V"), nb::arg("marker"), nb::arg("cells"));
+  m.def(
+      "locate_boundary_dofs_geometrical",
+      [](const dolfinx::fem::FunctionSpace<T>& V, const marker_fn<T>& marker)
+      {
+        auto _marker = wrap_marker<T>(marker);
+        return dolfinx_wrappers::as_nbarray(
+            dolfinx::fem::locate_boundary_dofs_geometrical(V, _marker));
+      },
+      nb::arg("V"), nb::arg("marker"));
 
   m.def(
       "interpolation_coords",
@@ -14,6 +14,7 @@
 #include <dolfinx/io/VTKFile.h>
 #include <dolfinx/io/XDMFFile.h>
 #include <dolfinx/io/cells.h>
+#include <dolfinx/io/utils.h>
 #include <dolfinx/io/vtk_utils.h>
 #include <dolfinx/io/xdmf_utils.h>
 #include <dolfinx/mesh/Mesh.h>
@@ -327,14 +328,29 @@ void io(nb::module_& m)
 
   // dolfinx::io::VTKFile
   nb::class_<dolfinx::io::VTKFile> vtk_file(m, "VTKFile");
+
+  nb::enum_<dolfinx::io::VTKFile::Encoding>(vtk_file, "Encoding")
+      .value("ascii", dolfinx::io::VTKFile::Encoding::ascii)
+      .value("binary", dolfinx::io::VTKFile::Encoding::binary)
+      .value("base64", dolfinx::io::VTKFile::Encoding::base64)
+      .value("zlib", dolfinx::io::VTKFile::Encoding::zlib)
+      .value("lz4", dolfinx::io::VTKFile::Encoding::lz4);
+
   vtk_file
       .def(
           "__init__",
           [](dolfinx::io::VTKFile* v, MPICommWrapper comm,
-             std::filesystem::path filename, std::string mode)
-          { new (v) dolfinx::io::VTKFile(comm.get(), filename, mode); },
-          nb::arg("comm"), nb::arg("filename"), nb::arg("mode"))
-      .def("close", &dolfinx::io::VTKFile::close);
+             std::filesystem::path filename, std::string mode,
+             dolfinx::io::VTKFile::Encoding encoding)
+          {
+            new (v)
+                dolfinx::io::VTKFile(comm.get(), filename, mode, encoding);
+          },
+          nb::arg("comm"), nb::arg("filename"), nb::arg("mode"),
+          nb::arg("encoding") = dolfinx::io::VTKFile::Encoding::ascii)
+      .def("close", &dolfinx::io::VTKFile::close)
+      .def_static("has_encoding", &dolfinx::io::VTKFile::has_encoding,
+                  nb::arg("encoding"));
 
   vtk_real_fn<float>(vtk_file);
   vtk_real_fn<double>(vtk_file);
@@ -343,14 +359,17 @@ void io(nb::module_& m)
   vtk_scalar_fn<std::complex<float>, float>(vtk_file);
   vtk_scalar_fn<std::complex<double>, double>(vtk_file);
 
+  nb::enum_<dolfinx::io::MeshPolicy>(m, "MeshPolicy")
+      .value("update", dolfinx::io::MeshPolicy::update)
+      .value("reuse", dolfinx::io::MeshPolicy::reuse);
+
 #ifdef HAS_ADIOS2
   nb::enum_<dolfinx::io::FidesMeshPolicy>(m, "FidesMeshPolicy")
       .value("update", dolfinx::io::FidesMeshPolicy::update)
       .value("reuse", dolfinx::io::FidesMeshPolicy::reuse);
 
-  nb::enum_<dolfinx::io::VTXMeshPolicy>(m, "VTXMeshPolicy")
-      .value("update", dolfinx::io::VTXMeshPolicy::update)
-      .value("reuse", dolfinx::io::VTXMeshPolicy::reuse);
+  // io::VTXMeshPolicy is an alias of io::MeshPolicy
+  m.attr("VTXMeshPolicy") = m.attr("MeshPolicy");
 #endif
 
   declare_vtx_writer<float>(m, "float32");
@@ -9,6 +9,7 @@
 #include "numpy_dtype.h"
 #include <complex>
 #include <dolfinx/common/IndexMap.h>
+#include <dolfinx/common/Scatterer.h>
 #include <dolfinx/la/MatrixCSR.h>
 #include <dolfinx/la/SparsityPattern.h>
 #include <dolfinx/la/Vector.h>
@@ -59,25 +60,32 @@ void declare_objects(nb::module_& m, const std::string& type)
                                              nb::handle());
           },
           nb::rv_policy::reference_internal)
-      .def("scatter_forward", &dolfinx::la::Vector<T>::scatter_fwd)
+      .def(
+          "scatter_forward",
+          [](dolfinx::la::Vector<T>& self,
+             dolfinx::common::Scatterer<>::type type)
+          { self.scatter_fwd(type); },
+          nb::arg("type") = dolfinx::common::Scatterer<>::type::neighbor)
       .def(
           "scatter_reverse",
-          [](dolfinx::la::Vector<T>& self, PyInsertMode mode)
+          [](dolfinx::la::Vector<T>& self, PyInsertMode mode,
+             dolfinx::common::Scatterer<>::type type)
           {
             switch (mode)
             {
             case PyInsertMode::add: // Add
-              self.scatter_rev(std::plus<T>());
+              self.scatter_rev(std::plus<T>(), type);
               break;
             case PyInsertMode::insert: // Insert
-              self.scatter_rev([](T /*a*/, T b) { return b; });
+              self.scatter_rev([](T /*a*/, T b) { return b; }, type);
               break;
             default:
               throw std::runtime_error("InsertMode not recognized.");
               break;
             }
           },
-          nb::arg("mode"));
+          nb::arg("mode"),
+          nb::arg("type") = dolfinx::common::Scatterer<>::type::neighbor);
 
   // dolfinx::la::MatrixCSR
   std::string pyclass_matrix_name = std::string("MatrixCSR_") + type;
@@ -215,6 +223,14 @@ void la(nb::module_& m)
       .value("add", PyInsertMode::add)
       .value("insert", PyInsertMode::insert);
 
+  nb::enum_<dolfinx::common::Scatterer<>::type>(m, "ScatterType")
+      .value("neighbor", dolfinx::common::Scatterer<>::type::neighbor,
+             "MPI neighbourhood collectives")
+      .value("p2p", dolfinx::common::Scatterer<>::type::p2p,
+             "MPI point-to-point communication")
+      .value("shm", dolfinx::common::Scatterer<>::type::shm,
+             "Shared memory for ranks on the same compute node");
+
   nb::enum_<dolfinx::la::BlockMode>(m, "BlockMode")
       .value("compact", dolfinx::la::BlockMode::compact)
       .value("expanded", dolfinx::la::BlockMode::expanded);
@@ -18,6 +18,7 @@
 #include <dolfinx/mesh/Topology.h>
 #include <dolfinx/mesh/cell_types.h>
 #include <dolfinx/mesh/generation.h>
+#include <dolfinx/mesh/geometricpartition.h>
 #include <dolfinx/mesh/graphbuild.h>
 #include <dolfinx/mesh/topologycomputation.h>
 #include <dolfinx/mesh/utils.h>
@@ -365,6 +366,20 @@ void declare_mesh(nb::module_& m, std::string type)
       nb::arg("comm"), nb::arg("cells"), nb::arg("element"),
       nb::arg("x").noconvert(), nb::arg("partitioner").none(),
       "Helper function for creating meshes.");
+  m.def(
+      "create_geometric_partitioner",
+      [](nb::ndarray<const T, nb::c_contig> x,
+         dolfinx::mesh::GeometricPartitionMethod method)
+          -> PythonCellPartitionFunction
+      {
+        std::size_t shape1 = x.ndim() == 1 ? 1 : x.shape(1);
+        return create_cell_partitioner_py(
+            dolfinx::mesh::create_geometric_partitioner(
+                std::span(x.data(), x.size()), {x.shape(0), shape1},
+                method));
+      },
+      nb::arg("x").noconvert(), nb::arg("method"),
+      "Create a cell partitioner that partitions the cell midpoints.");
   m.def(
       "create_submesh",
       [](const dolfinx::mesh::Mesh<T>& mesh, int dim,
@@ -559,6 +574,12 @@ void mesh(nb::module_& m)
       .value("shared_facet", dolfinx::mesh::GhostMode::shared_facet)
       .value("shared_vertex", dolfinx::mesh::GhostMode::shared_vertex);
 
+  // dolfinx::mesh::GeometricPartitionMethod enums
+  nb::enum_<dolfinx::mesh::GeometricPartitionMethod>(
+      m, "GeometricPartitionMethod")
+      .value("rcb", dolfinx::mesh::GeometricPartitionMethod::rcb)
+      .value("hilbert", dolfinx::mesh::GeometricPartitionMethod::hilbert);
+
   // dolfinx::mesh::TopologyComputation
   m.def(
       "compute_entities",
@@ -392,7 +392,33 @@ void petsc_nls_module(nb::module_& m)
       .def_rw("convergence_criterion",
               &dolfinx::nls::petsc::NewtonSolver::convergence_criterion,
               "Convergence criterion, either 'residual' (default) or "
-              "'incremental'");
+              "'incremental'")
+      .def_rw("jacobian_reuse",
+              &dolfinx::nls::petsc::NewtonSolver::jacobian_reuse,
+              "Maximum number of iterations the Jacobian is re-used")
+      .def_rw("jacobian_reuse_rate",
+              &dolfinx::nls::petsc::NewtonSolver::jacobian_reuse_rate,
+              "Residual reduction ratio above which the Jacobian is updated")
+      .def_rw("reuse_preconditioner",
+              &dolfinx::nls::petsc::NewtonSolver::reuse_preconditioner,
+              "Re-use only the preconditioner")
+      .def_rw("eisenstat_walker",
+              &dolfinx::nls::petsc::NewtonSolver::eisenstat_walker,
+              "Use Eisenstat-Walker linear solver tolerances")
+      .def_rw("ew_eta0", &dolfinx::nls::petsc::NewtonSolver::ew_eta0)
+      .def_rw("ew_eta_max", &dolfinx::nls::petsc::NewtonSolver::ew_eta_max)
+      .def_rw("ew_gamma", &dolfinx::nls::petsc::NewtonSolver::ew_gamma)
+      .def_rw("ew_alpha", &dolfinx::nls::petsc::NewtonSolver::ew_alpha)
+      .def_rw("line_search", &dolfinx::nls::petsc::NewtonSolver::line_search,
+              "Use a backtracking line search")
+      .def_rw("line_search_max_it",
+              &dolfinx::nls::petsc::NewtonSolver::line_search_max_it)
+      .def_rw("line_search_c1",
+              &dolfinx::nls::petsc::NewtonSolver::line_search_c1)
+      .def_prop_ro("jacobian_updates",
+                   &dolfinx::nls::petsc::NewtonSolver::jacobian_updates)
+      .def_prop_ro("krylov_iterations",
+                   &dolfinx::nls::petsc::NewtonSolver::krylov_iterations);
 }
 
 } // namespace
@@ -154,6 +154,88 @@ def test_basic_assembly(mode, dtype):
     assert 4 * normA == pytest.approx(A.squared_norm())
 
 
+@pytest.mark.parametrize("space", ["scalar", "blocked", "mixed"])
+def test_assembly_bcs_constrained_cells(space):
+    """Test that matrix assembly and lifting with boundary conditions,
+    which check for constrained dofs on cells with a constrained dof
+    only, give the same result as zeroing the rows and columns of a
+    matrix assembled without boundary conditions"""
+    mesh = create_unit_square(MPI.COMM_WORLD, 6, 5, ghost_mode=GhostMode.shared_facet)
+    tdim = mesh.topology.dim
+    mesh.topology.create_connectivity(tdim - 1, tdim)
+    left = locate_entities_boundary(mesh, tdim - 1, lambda x: np.isclose(x[0], 0.0))
+    right = locate_entities_boundary(mesh, tdim - 1, lambda x: np.isclose(x[0], 1.0))
+
+    def g_fn(x):
+        return 1.0 + x[1] ** 2
+
+    if space == "scalar":
+        V = functionspace(mesh, ("Lagrange", 2))
+        g = Function(V)
+        g.interpolate(g_fn)
+        bcs = [dirichletbc(g, locate_dofs_topological(V, tdim - 1, left))]
+    elif space == "blocked":
+        # Condition on one component of a blocked space, and on all
+        # components
+        V = functionspace(mesh, ("Lagrange", 2, (tdim,)))
+        V1, _ = V.sub(1).collapse()
+        g = Function(V1)
+        g.interpolate(g_fn)
+        dofs = locate_dofs_topological((V.sub(1), V1), tdim - 1, left)
+        dofs_right = locate_dofs_topological(V, tdim - 1, right)
+        value = np.array([2.0, -1.0], dtype=default_real_type)
+        bcs = [dirichletbc(g, dofs, V.sub(1)), dirichletbc(value, dofs_right, V)]
+    else:
+        P2 = element("Lagrange", mesh.basix_cell(), 2, shape=(tdim,), dtype=default_real_type)
+        P1 = element("Lagrange", mesh.basix_cell(), 1, dtype=default_real_type)
+        V = functionspace(mesh, mixed_element([P2, P1]))
+        V00, _ = V.sub(0).sub(0).collapse()
+        g = Function(V00)
+        g.interpolate(g_fn)
+        dofs = locate_dofs_topological((V.sub(0).sub(0), V00), tdim - 1, left)
+        dofs_right = locate_dofs_topological(V.sub(1), tdim - 1, right)
+        bcs = [
+            dirichletbc(g, dofs, V.sub(0).sub(0)),
+            dirichletbc(default_real_type(3.0), dofs_right, V.sub(1)),
+        ]
+
+    u, v = ufl.TrialFunction(V), ufl.TestFunction(V)
+    a = inner(ufl.grad(u), ufl.grad(v)) * dx + inner(u, v) * ds
+    a += inner(ufl.avg(u), ufl.avg(v)) * dS
+    a = form(a)
+
+    # Markers for constrained dofs (local, unrolled)
+    bs = V.dofmap.index_map_bs
+    imap = V.dofmap.index_map
+    marker = np.zeros(bs * (imap.size_local + imap.num_ghosts), dtype=bool)
+    for bc in bcs:
+        marker[bc.dof_indices()[0]] = True
+    assert MPI.COMM_WORLD.allreduce(np.count_nonzero(marker), op=MPI.SUM) > 0
+
+    # Process contributions (including ghost rows) with and without
+    # boundary conditions
+    A0 = fem.assemble_matrix(a).to_scipy(ghosted=True).toarray()
+    A = fem.assemble_matrix(a, bcs, diagonal=0.0).to_scipy(ghosted=True).toarray()
+    A0_bc = A0.copy()
+    A0_bc[marker, :] = 0.0
+    A0_bc[:, marker] = 0.0
+    assert np.allclose(A, A0_bc)
+
+    # Lifting, b <- b - scale * A (g - x0), with the values (g - x0) on
+    # ghost dofs taken from the owner
+    x0 = la.vector(imap, bs)
+    x0.array[:] = np.arange(x0.array.size) % 7
+    x0.scatter_forward()
+    w = la.vector(imap, bs)
+    fem.set_bc(w.array, bcs, x0.array)
+    w.scatter_forward()
+
+    scale = 2.0
+    b = np.zeros(w.array.size, dtype=w.array.dtype)
+    fem.apply_lifting(b, [a], bcs=[bcs], x0=[x0.array], scale=scale)
+    assert np.allclose(b, -scale * A0 @ w.array)
+
+
 def nest_matrix_norm(A):
     """Return norm of a MatNest matrix"""
     assert A.getType() == "nest"
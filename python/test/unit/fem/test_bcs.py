@@ -23,6 +23,7 @@ from dolfinx.fem import (
     dirichletbc,
     form,
     functionspace,
+    locate_boundary_dofs_geometrical,
     locate_dofs_geometrical,
     locate_dofs_topological,
     set_bc,
@@ -67,6 +68,60 @@ def test_locate_dofs_geometrical():
         assert np.isclose(coords_V[dofs[0][1]], [0, 0, 0]).all()
 
 
+@pytest.mark.parametrize("degree", [1, 3])
+def test_locate_boundary_dofs_geometrical(degree):
+    """Test that locate_boundary_dofs_geometrical finds the same boundary
+    dofs as locate_dofs_geometrical, including after the geometry has
+    moved"""
+    mesh = create_unit_square(MPI.COMM_WORLD, 7, 5)
+    V = functionspace(mesh, ("Lagrange", degree, (2,)))
+    n = V.dofmap.index_map.size_local
+
+    def check(markers):
+        for marker in markers:
+            dofs = locate_dofs_geometrical(V, marker)
+            dofs_b = locate_boundary_dofs_geometrical(V, marker)
+            assert np.array_equal(np.sort(dofs[dofs < n]), dofs_b[dofs_b < n])
+
+    check(
+        [
+            lambda x: np.isclose(x[0], 0.0),
+            lambda x: np.isclose(x[1], 1.0),
+            lambda x: np.logical_or(np.isclose(x[0], 1.0), np.isclose(x[1], 0.0)),
+        ]
+    )
+
+    # The boundary dofs are stored on the space, but their coordinates
+    # follow the geometry
+    mesh.geometry.x[:, 0] *= 2.0
+    check([lambda x: np.isclose(x[0], 2.0), lambda x: np.isclose(x[0], 0.0)])
+
+
+@pytest.mark.parametrize("degree", [1, 2])
+def test_locate_dofs_geometrical_cells(degree):
+    """Test locating dofs geometrically in the closure of a subset of
+    cells"""
+    mesh = create_unit_square(MPI.COMM_WORLD, 6, 4)
+    V = functionspace(mesh, ("Lagrange", degree))
+    tdim = mesh.topology.dim
+    num_cells = mesh.topology.index_map(tdim).size_local
+    num_cells += mesh.topology.index_map(tdim).num_ghosts
+
+    def marker(x):
+        return x[0] < 0.5 + 1.0e-10
+
+    # All cells gives the same dofs as searching the whole space
+    cells = np.arange(num_cells, dtype=np.int32)
+    dofs = locate_dofs_geometrical(V, marker)
+    assert np.array_equal(np.sort(dofs), locate_dofs_geometrical(V, marker, cells))
+
+    # Subset of cells gives the marked dofs in the closure of the cells
+    cells = cells[::2]
+    dofs_c = locate_dofs_geometrical(V, marker, cells)
+    cell_dofs = np.unique(V.dofmap.list[cells])
+    assert np.array_equal(np.intersect1d(dofs, cell_dofs), dofs_c)
+
+
 def test_overlapping_bcs():
     """Test that, when boundaries condition overlap, the last provided
     boundary condition is applied"""
@@ -19,6 +19,7 @@ from dolfinx import default_real_type, default_scalar_type
 from dolfinx.fem import (
     Expression,
     Function,
+    InterpolationPlan,
     assemble_scalar,
     create_interpolation_data,
     form,
@@ -948,6 +949,35 @@ def test_nonmatching_mesh_interpolation(xtype, cell_type0, cell_type1):
     assert np.isclose(assemble_scalar(form(residual, dtype=xtype)), 0)
 
 
+@pytest.mark.parametrize("family", ["Lagrange", "N1curl"])
+def test_nonmatching_mesh_interpolation_plan(family):
+    """Check that interpolation with a plan matches interpolation with
+    the interpolation data, including re-use of the plan"""
+    mesh0 = create_unit_cube(MPI.COMM_WORLD, 3, 4, 2, cell_type=CellType.tetrahedron)
+    mesh1 = create_unit_cube(MPI.COMM_WORLD, 4, 3, 5, cell_type=CellType.hexahedron)
+    V0 = functionspace(mesh0, (family, 2, (3,)) if family == "Lagrange" else (family, 2))
+    V1 = functionspace(mesh1, ("Discontinuous Lagrange", 2, (3,)))
+
+    cell_map1 = mesh1.topology.index_map(mesh1.topology.dim)
+    cells1 = np.arange(cell_map1.size_local + cell_map1.num_ghosts, dtype=np.int32)
+    interpolation_data = create_interpolation_data(V1, V0, cells1, padding=1e-14)
+    plan = InterpolationPlan(V1, V0, interpolation_data)
+
+    u0 = Function(V0)
+    u1 = Function(V1)
+    u1_plan = Function(V1)
+    tol = 1e3 * np.finfo(default_real_type).eps
+    for f in [
+        lambda x: (x[1] ** 2, x[0] * x[2], x[2] + 0.4),
+        lambda x: (x[0], 2 * x[1] * x[2], -(x[0] ** 2)),
+    ]:
+        u0.interpolate(f)
+        u0.x.scatter_forward()
+        u1.interpolate_nonmatching(u0, cells1, interpolation_data)
+        u1_plan.interpolate_nonmatching(u0, cells1, plan)
+        assert np.allclose(u1_plan.x.array, u1.x.array, rtol=tol, atol=tol)
+
+
 @pytest.mark.parametrize("xtype", [np.float64])
 def test_nonmatching_mesh_single_cell_overlap_interpolation(xtype):
     # mesh2 is contained by a single cell of mesh1. Here we test
@@ -4,6 +4,9 @@
 #
 # SPDX-License-Identifier:    LGPL-3.0-or-later
 
+import base64
+import xml.etree.ElementTree as ET
+import zlib
 from pathlib import Path
 
 from mpi4py import MPI
@@ -450,3 +453,112 @@ def test_vtk_mesh():
     mesh = create_unit_square(comm, 2 * comm.size, 2 * comm.size)
     V = functionspace(mesh, ("Lagrange", 1))
     vtk_mesh(V)
+
+
+def _read_vtu_arrays(filename):
+    """Read all data arrays in a VTU file, decoding appended data"""
+    raw = Path(filename).read_bytes()
+    start = raw.find(b"<AppendedData")
+    if start == -1:
+        root, data, encoding = ET.fromstring(raw), b"", None
+    else:
+        tag_end = raw.index(b">", start)
+        encoding = ET.fromstring(raw[start:tag_end] + b"/>").get("encoding")
+        data = raw[raw.index(b"_", tag_end) + 1 : raw.rindex(b"</AppendedData>")]
+        root = ET.fromstring(raw[:start] + b"</VTKFile>")
+
+    dtypes = {
+        "Float64": np.float64,
+        "Int8": np.int8,
+        "Int32": np.int32,
+        "Int64": np.int64,
+        "UInt8": np.uint8,
+    }
+    n = np.dtype(np.uint64).itemsize
+    compressor = root.get("compressor")
+    arrays = {}
+    for parent in root.iter():
+        for node in parent.findall("DataArray"):
+            dtype = dtypes[node.get("type")]
+            key = (parent.tag, node.get("Name"))
+            if node.get("format") == "ascii":
+                arrays[key] = np.array((node.text or "").split(), dtype=np.float64).astype(dtype)
+            elif encoding == "base64":
+                # Header and data are encoded as one stream
+                offset = int(node.get("offset"))
+                header = base64.b64decode(data[offset : offset + 12])[:n]
+                size = int(np.frombuffer(header, np.uint64)[0])
+                block = base64.b64decode(data[offset : offset + 4 * ((n + size + 2) // 3)])
+                arrays[key] = np.frombuffer(block[n:], dtype)
+            elif compressor is not None:
+                offset = int(node.get("offset"))
+                num_blocks, block_size, last_size = np.frombuffer(
+                    data[offset : offset + 3 * n], np.uint64
+                )
+                pos = offset + (3 + int(num_blocks)) * n
+                values = b""
+                for i, size in enumerate(np.frombuffer(data[offset + 3 * n : pos], np.uint64)):
+                    block = data[pos : pos + int(size)]
+                    if compressor == "vtkZLibDataCompressor":
+                        values += zlib.decompress(block)
+                    else:
+                        import lz4.block
+
+                        usize = block_size if i + 1 < num_blocks else last_size
+                        values += lz4.block.decompress(block, uncompressed_size=int(usize))
+                    pos += int(size)
+                arrays[key] = np.frombuffer(values, dtype)
+            else:
+                offset = int(node.get("offset"))
+                size = int(np.frombuffer(data[offset : offset + n], np.uint64)[0])
+                arrays[key] = np.frombuffer(data[offset + n : offset + n + size], dtype)
+    return arrays
+
+
+@pytest.mark.parametrize(
+    "encoding",
+    [
+        VTKFile.Encoding.binary,
+        VTKFile.Encoding.base64,
+        VTKFile.Encoding.zlib,
+        VTKFile.Encoding.lz4,
+    ],
+)
+def test_save_encoding(tempdir, encoding):
+    if not VTKFile.has_encoding(encoding):
+        pytest.skip(f"DOLFINx has not been built with {encoding.name}")
+    if encoding == VTKFile.Encoding.lz4:
+        pytest.importorskip("lz4.block")
+
+    comm = MPI.COMM_WORLD
+    mesh = create_unit_square(comm, 6, 5)
+    u = Function(functionspace(mesh, ("Lagrange", 2, (2,))))
+    u.interpolate(lambda x: np.vstack((x[0], x[1] * x[1])))
+    u.name = "u"
+
+    arrays = []
+    for name, enc in [("ascii", VTKFile.Encoding.ascii), (encoding.name, encoding)]:
+        filename = Path(tempdir, f"encoding_{name}.pvd")
+        with VTKFile(comm, filename, "w", enc) as vtk:
+            vtk.write_mesh(mesh, 0.0)
+            vtk.write_function(u, 1.0)
+        files = sorted(Path(tempdir).glob(f"encoding_{name}_p{comm.rank}_*.vtu"))
+        assert len(files) == 2
+        arrays.append([_read_vtu_arrays(f) for f in files])
+
+    for ref, data in zip(*arrays):
+        assert ref.keys() == data.keys()
+        for key, values in ref.items():
+            assert values.dtype == data[key].dtype
+            assert np.allclose(values, data[key], rtol=1e-14)
+
+
+def test_unavailable_encoding(tempdir):
+    """Opening a file with a compressed encoding that DOLFINx has not
+    been built with raises an error"""
+    compressed = [VTKFile.Encoding.zlib, VTKFile.Encoding.lz4]
+    missing = [e for e in compressed if not VTKFile.has_encoding(e)]
+    if not missing:
+        pytest.skip("DOLFINx has been built with all compressors")
+    with pytest.raises(RuntimeError):
+        VTKFile(MPI.COMM_WORLD, Path(tempdir, "missing.pvd"), "w", missing[0])
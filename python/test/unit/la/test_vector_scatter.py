@@ -5,6 +5,8 @@
 # SPDX-License-Identifier:    LGPL-3.0-or-later
 """Unit tests for the KrylovSolver interface"""
 
+import gc
+
 from mpi4py import MPI
 
 import numpy as np
@@ -15,6 +17,8 @@ from dolfinx import default_real_type, la
 from dolfinx.fem import Function, functionspace
 from dolfinx.mesh import create_unit_square
 
+scatter_types = [la.ScatterType.neighbor, la.ScatterType.p2p, la.ScatterType.shm]
+
 
 @pytest.mark.parametrize(
     "e",
@@ -23,7 +27,8 @@ from dolfinx.mesh import create_unit_square
         element("Lagrange", "triangle", 1, shape=(2,), dtype=default_real_type),
     ],
 )
-def test_scatter_forward(e):
+@pytest.mark.parametrize("scatter_type", scatter_types)
+def test_scatter_forward(e, scatter_type):
     mesh = create_unit_square(MPI.COMM_WORLD, 5, 5)
     V = functionspace(mesh, e)
     u = Function(V)
@@ -33,13 +38,13 @@ def test_scatter_forward(e):
 
     # Forward scatter should have no effect
     w0 = u.x.array.copy()
-    u.x.scatter_forward()
+    u.x.scatter_forward(scatter_type)
     assert np.allclose(w0, u.x.array)
 
     # Fill local array with the mpi rank
     u.x.array.fill(MPI.COMM_WORLD.rank)
     w0 = u.x.array.copy()
-    u.x.scatter_forward()
+    u.x.scatter_forward(scatter_type)
 
     # Now the ghosts should have the value of the rank of the owning
     # process
@@ -48,6 +53,11 @@ def test_scatter_forward(e):
     local_size = u.function_space.dofmap.index_map.size_local * bs
     assert np.allclose(u.x.array[local_size:], ghost_owners)
 
+    # Destroy the vector on all ranks, as freeing the shared memory
+    # window is collective
+    del u
+    gc.collect()
+
 
 @pytest.mark.parametrize(
     "e",
@@ -56,7 +66,8 @@ def test_scatter_forward(e):
         element("Lagrange", "triangle", 1, shape=(2,), dtype=default_real_type),
     ],
 )
-def test_scatter_reverse(e):
+@pytest.mark.parametrize("scatter_type", scatter_types)
+def test_scatter_reverse(e, scatter_type):
     comm = MPI.COMM_WORLD
     mesh = create_unit_square(MPI.COMM_WORLD, 5, 5)
     V = functionspace(mesh, e)
@@ -67,7 +78,7 @@ def test_scatter_reverse(e):
 
     # Reverse scatter (insert) should have no effect
     w0 = u.x.array.copy()
-    u.x.scatter_reverse(la.InsertMode.insert)
+    u.x.scatter_reverse(la.InsertMode.insert, scatter_type)
     assert np.allclose(w0, u.x.array)
 
     # Fill with MPI rank, and sum all entries in the vector (including
@@ -76,7 +87,7 @@ def test_scatter_reverse(e):
     all_count0 = MPI.COMM_WORLD.allreduce(u.x.array.sum(), op=MPI.SUM)
 
     # Reverse scatter (add)
-    u.x.scatter_reverse(la.InsertMode.add)
+    u.x.scatter_reverse(la.InsertMode.add, scatter_type)
     num_ghosts = V.dofmap.index_map.num_ghosts
     ghost_count = MPI.COMM_WORLD.allreduce(num_ghosts * comm.rank, op=MPI.SUM)
 
@@ -85,6 +96,9 @@ def test_scatter_reverse(e):
     all_count1 = MPI.COMM_WORLD.allreduce(u.x.array.sum(), op=MPI.SUM)
     assert all_count1 == (all_count0 + bs * ghost_count)
 
+    del u
+    gc.collect()
+
 
 @pytest.mark.parametrize(
     "dtype",
@@ -20,10 +20,12 @@ from dolfinx.cpp.mesh import cell_num_vertices
 from dolfinx.io import XDMFFile
 from dolfinx.mesh import (
     CellType,
+    GeometricPartitionMethod,
     GhostMode,
     compute_midpoints,
     create_box,
     create_cell_partitioner,
+    create_geometric_partitioner,
     create_mesh,
 )
 
@@ -240,3 +242,43 @@ def test_mixed_topology_partitioning():
     count_mpi = MPI.COMM_WORLD.allreduce(counts)
 
     assert count_mpi.sum() == 14080
+
+
+@pytest.mark.parametrize(
+    "method", [GeometricPartitionMethod.rcb, GeometricPartitionMethod.hilbert]
+)
+def test_geometric_partitioner(method):
+    """Create a mesh on rank 0 and distribute it using the midpoints of
+    the cells."""
+    comm = MPI.COMM_WORLD
+    n = 8
+    if comm.rank == 0:
+        x = np.array(
+            [[i, j, k] for k in range(n + 1) for j in range(n + 1) for i in range(n + 1)],
+            dtype=default_real_type,
+        )
+        x /= n
+
+        def v(i, j, k):
+            return (k * (n + 1) + j) * (n + 1) + i
+
+        cells = np.array(
+            [
+                [v(i + a, j + b, k + c) for c in range(2) for b in range(2) for a in range(2)]
+                for k in range(n)
+                for j in range(n)
+                for i in range(n)
+            ],
+            dtype=np.int64,
+        )
+    else:
+        x = np.zeros((0, 3), dtype=default_real_type)
+        cells = np.zeros((0, 8), dtype=np.int64)
+
+    domain = ufl.Mesh(element("Lagrange", "hexahedron", 1, shape=(3,), dtype=default_real_type))
+    mesh = create_mesh(comm, cells, x, domain, create_geometric_partitioner(x, method))
+
+    # Check that the number of cells on each rank is balanced
+    num_cells = mesh.topology.index_map(3).size_local
+    assert comm.allreduce(num_cells) == n**3
+    assert abs(num_cells - n**3 / comm.size) <= np.ceil(np.log2(comm.size)) + 1
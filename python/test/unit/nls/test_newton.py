@@ -101,6 +101,34 @@ class NonlinearPDE_SNESProblem:
         J.assemble()
 
 
+def create_nonlinear_problem():
+    """Create the nonlinear PDE problem used to test solver options."""
+    from petsc4py import PETSc
+
+    mesh = create_unit_square(MPI.COMM_WORLD, 12, 5)
+    V = functionspace(mesh, ("Lagrange", 1))
+    u = Function(V)
+    v = TestFunction(V)
+    F = inner(5.0, v) * dx - ufl.sqrt(u * u) * inner(grad(u), grad(v)) * dx - inner(u, v) * dx
+    bc = dirichletbc(
+        PETSc.ScalarType(1.0),
+        locate_dofs_geometrical(V, lambda x: np.isclose(x[0], 0.0) | np.isclose(x[0], 1.0)),
+        V,
+    )
+    return u, NonlinearPDEProblem(F, u, bc)
+
+
+def create_newton_solver(problem):
+    """Create a Newton solver for a NonlinearPDEProblem."""
+    solver = _cpp.nls.petsc.NewtonSolver(MPI.COMM_WORLD)
+    solver.setF(problem.F, problem.vector())
+    solver.setJ(problem.J, problem.matrix())
+    solver.set_form(problem.form)
+    solver.atol = 1.0e-8
+    solver.rtol = 1.0e2 * np.finfo(default_real_type).eps
+    return solver
+
+
 @pytest.mark.petsc4py
 class TestNLS:
     def test_linear_pde(self):
@@ -187,6 +215,112 @@ class TestNLS:
         assert converged
         assert n > 0 and n < 6
 
+    def test_jacobian_reuse(self):
+        """Test re-use of the Jacobian by the Newton solver"""
+        u, problem = create_nonlinear_problem()
+        solver = create_newton_solver(problem)
+        ksp = solver.krylov_solver
+        ksp.setType("preonly")
+        ksp.getPC().setType("lu")
+
+        # The Jacobian is updated at every iteration by default
+        u.x.array[:] = 0.9
+        n0, converged = solver.solve(u.x.petsc_vec)
+        assert converged
+        assert solver.jacobian_updates == n0
+
+        # Re-use the Jacobian for up to three iterations, and update it
+        # only if the residual norm increases
+        solver.jacobian_reuse = 3
+        solver.jacobian_reuse_rate = 1.0
+        u.x.array[:] = 0.9
+        n1, converged = solver.solve(u.x.petsc_vec)
+        assert converged
+        assert n1 >= n0
+        assert (n1 + 3) // 4 <= solver.jacobian_updates < n1
+
+    def test_reuse_preconditioner(self):
+        """Test re-use of the preconditioner by the Newton solver"""
+        u, problem = create_nonlinear_problem()
+        solver = create_newton_solver(problem)
+        ksp = solver.krylov_solver
+        ksp.setType("gmres")
+        ksp.getPC().setType("jacobi")
+        ksp.setTolerances(rtol=1.0e2 * np.finfo(default_real_type).eps, max_it=1000)
+
+        u.x.array[:] = 0.9
+        n0, converged = solver.solve(u.x.petsc_vec)
+        assert converged
+
+        # The Jacobian is updated at every iteration, so the convergence
+        # of the Newton iterations is not affected
+        solver.jacobian_reuse = 3
+        solver.jacobian_reuse_rate = 1.0
+        solver.reuse_preconditioner = True
+        u.x.array[:] = 0.9
+        n1, converged = solver.solve(u.x.petsc_vec)
+        assert converged
+        assert n1 <= n0 + 1
+        assert solver.jacobian_updates < n1
+
+    def test_eisenstat_walker(self):
+        """Test Eisenstat-Walker Krylov solver tolerances"""
+        u, problem = create_nonlinear_problem()
+        solver = create_newton_solver(problem)
+        ksp = solver.krylov_solver
+        ksp.setType("gmres")
+        ksp.getPC().setType("jacobi")
+        ksp_rtol = 1.0e2 * np.finfo(default_real_type).eps
+        ksp.setTolerances(rtol=ksp_rtol, max_it=1000)
+
+        u.x.array[:] = 0.9
+        _, converged = solver.solve(u.x.petsc_vec)
+        assert converged
+        num_krylov0 = solver.krylov_iterations
+
+        solver.eisenstat_walker = True
+        u.x.array[:] = 0.9
+        _, converged = solver.solve(u.x.petsc_vec)
+        assert converged
+        assert solver.krylov_iterations < num_krylov0
+
+        # The Krylov solver tolerance is restored after the solve
+        assert np.isclose(ksp.getTolerances()[0], ksp_rtol)
+
+    def test_line_search(self):
+        """Test backtracking line search on a problem for which full
+        Newton steps overshoot"""
+        from petsc4py import PETSc
+
+        # F(u) = atan(u) on each cell. Newton iterations with full steps
+        # diverge for |u0| > 1.39.
+        mesh = create_unit_square(MPI.COMM_WORLD, 4, 4)
+        V = functionspace(mesh, ("DG", 0))
+        u = Function(V)
+        v = TestFunction(V)
+        F = inner(ufl.atan(u), v) * dx
+        bc = dirichletbc(PETSc.ScalarType(0.0), np.array([], dtype=np.int32), V)
+        problem = NonlinearPDEProblem(F, u, bc)
+
+        solver = create_newton_solver(problem)
+        ksp = solver.krylov_solver
+        ksp.setType("preonly")
+        ksp.getPC().setType("jacobi")
+        solver.error_on_nonconvergence = False
+
+        solver.max_it = 3
+        u.x.array[:] = 1.5
+        _, converged = solver.solve(u.x.petsc_vec)
+        assert not converged
+        assert np.all(np.abs(u.x.array) > 1.5)
+
+        solver.max_it = 10
+        solver.line_search = True
+        u.x.array[:] = 1.5
+        _, converged = solver.solve(u.x.petsc_vec)
+        assert converged
+        assert np.allclose(u.x.array, 0.0, atol=1.0e-6)
+
     def test_nonlinear_pde_snes(self):
         """Test Newton solver for a simple nonlinear PDE"""
         from petsc4py import PETSc